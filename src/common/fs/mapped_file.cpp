@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "common/fs/mapped_file.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+
+namespace Common::FS {
+
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    Open(path);
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : base{std::exchange(other.base, nullptr)}, size{std::exchange(other.size, 0)},
+      is_open{std::exchange(other.is_open, false)} {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    Close();
+    base = std::exchange(other.base, nullptr);
+    size = std::exchange(other.size, 0);
+    is_open = std::exchange(other.is_open, false);
+    return *this;
+}
+
+void MappedFile::Open(const std::filesystem::path& path) {
+    Close();
+
+#ifdef _WIN32
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        return;
+    }
+    if (file_size.QuadPart == 0) {
+        CloseHandle(file);
+        is_open = true;
+        return;
+    }
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        LOG_ERROR(Common_Filesystem, "Failed to create file mapping of {}",
+                  PathToUTF8String(path));
+        return;
+    }
+    void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+        LOG_ERROR(Common_Filesystem, "Failed to map view of {}", PathToUTF8String(path));
+        return;
+    }
+    base = static_cast<const u8*>(view);
+    size = static_cast<size_t>(file_size.QuadPart);
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        return;
+    }
+    if (file_stat.st_size == 0) {
+        close(fd);
+        is_open = true;
+        return;
+    }
+    void* const view = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ,
+                            MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        LOG_ERROR(Common_Filesystem, "Failed to map {}", PathToUTF8String(path));
+        return;
+    }
+    base = static_cast<const u8*>(view);
+    size = static_cast<size_t>(file_stat.st_size);
+#endif
+
+    is_open = true;
+}
+
+void MappedFile::Close() {
+    if (base) {
+#ifdef _WIN32
+        UnmapViewOfFile(base);
+#else
+        munmap(const_cast<u8*>(base), size);
+#endif
+    }
+    base = nullptr;
+    size = 0;
+    is_open = false;
+}
+
+} // namespace Common::FS
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+
+#include "common/common_types.h"
+
+namespace Common::FS {
+
+/**
+ * Read-only memory mapping of an entire file.
+ * The mapping stays valid until the object is closed or destroyed, regardless of what happens to
+ * the file handle used to create it.
+ */
+class MappedFile final {
+public:
+    MappedFile();
+
+    /**
+     * Maps the file at path into memory for reading.
+     *
+     * @param path Filesystem path
+     */
+    explicit MappedFile(const std::filesystem::path& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * Maps the file at path into memory for reading, closing any previous mapping.
+     *
+     * @param path Filesystem path
+     */
+    void Open(const std::filesystem::path& path);
+
+    /// Unmaps the file, if mapped.
+    void Close();
+
+    /**
+     * Checks whether the file is mapped.
+     * Empty files are considered mapped and expose an empty span.
+     *
+     * @returns True if the file is mapped, false otherwise.
+     */
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return is_open;
+    }
+
+    /// Returns the mapped contents of the file.
+    [[nodiscard]] std::span<const u8> Data() const noexcept {
+        return {base, size};
+    }
+
+private:
+    const u8* base{};
+    size_t size{};
+    bool is_open{};
+};
+
+} // namespace Common::FS
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
@@ -279,6 +279,11 @@ struct Values {
                                            true,
                                            &use_custom_cpu_ticks};
 
+    SwitchableSetting<bool> cpu_translation_cache{linkage, false, "cpu_translation_cache",
+                                                  Category::Cpu};
+    SwitchableSetting<bool> cpu_tiered_compilation{linkage, false, "cpu_tiered_compilation",
+                                                   Category::Cpu};
+
     SwitchableSetting<bool> cpu_debug_mode{linkage, false, "cpu_debug_mode", Category::CpuDebug};
 
     Setting<bool> cpuopt_page_tables{linkage, true, "cpuopt_page_tables", Category::CpuDebug};
@@ -291,6 +296,8 @@ struct Values {
                                              Category::CpuDebug};
     Setting<bool> cpuopt_const_prop{linkage, true, "cpuopt_const_prop", Category::CpuDebug};
     Setting<bool> cpuopt_misc_ir{linkage, true, "cpuopt_misc_ir", Category::CpuDebug};
+    Setting<bool> cpuopt_trace_formation{linkage, false, "cpuopt_trace_formation",
+                                         Category::CpuDebug};
     Setting<bool> cpuopt_reduce_misalign_checks{linkage, true, "cpuopt_reduce_misalign_checks",
                                                 Category::CpuDebug};
     SwitchableSetting<bool> cpuopt_fastmem{linkage, true, "cpuopt_fastmem", Category::CpuDebug};
@@ -514,6 +521,9 @@ struct Values {
                                                   Category::RendererAdvanced};
     SwitchableSetting<bool> use_asynchronous_shaders{linkage, false, "use_asynchronous_shaders",
                                                      Category::RendererAdvanced};
+    SwitchableSetting<bool> use_asynchronous_texture_decode{linkage, false,
+                                                            "use_asynchronous_texture_decode",
+                                                            Category::RendererAdvanced};
     SwitchableSetting<bool> use_fast_gpu_time{linkage,
                                               true,
                                               "use_fast_gpu_time",
@@ -586,6 +596,10 @@ struct Values {
                                                     linkage, false, "disable_shader_loop_safety_checks", Category::RendererDebug};
     Setting<bool> enable_renderdoc_hotkey{linkage, false, "renderdoc_hotkey",
                                           Category::RendererDebug};
+    Setting<bool> null_renderer_translate_shaders{linkage, false, "null_renderer_translate_shaders",
+                                                  Category::RendererDebug};
+    Setting<bool> shader_compile_statistics{linkage, false, "shader_compile_statistics",
+                                            Category::RendererDebug};
     SwitchableSetting<bool> disable_buffer_reorder{linkage, false, "disable_buffer_reorder",
                                          Category::RendererDebug,
                                          Specialization::Default,
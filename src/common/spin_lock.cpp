@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -17,7 +20,7 @@
 #endif
 #endif
 
-namespace {
+namespace Common {
 
 void ThreadPause() {
 #if __x86_64__
@@ -29,10 +32,6 @@ void ThreadPause() {
 #endif
 }
 
-} // Anonymous namespace
-
-namespace Common {
-
 void SpinLock::lock() {
     while (lck.test_and_set(std::memory_order_acquire)) {
         ThreadPause();
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -34,6 +37,11 @@ std::vector<u8> CompressDataZSTDDefault(const u8* source, std::size_t source_siz
 std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed) {
     const std::size_t decompressed_size =
         ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+    if (decompressed_size == ZSTD_CONTENTSIZE_ERROR ||
+        decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+        // Not a valid frame or the frame does not record its size
+        return {};
+    }
     std::vector<u8> decompressed(decompressed_size);
 
     const std::size_t uncompressed_result_size = ZSTD_decompress(
@@ -46,4 +54,11 @@ std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed) {
     return decompressed;
 }
 
+std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed, std::size_t expected_size) {
+    if (ZSTD_getFrameContentSize(compressed.data(), compressed.size()) != expected_size) {
+        return {};
+    }
+    return DecompressDataZSTD(compressed);
+}
+
 } // namespace Common::Compression
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -42,4 +45,16 @@ namespace Common::Compression {
  */
 [[nodiscard]] std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed);
 
+/**
+ * Decompresses a source memory region with Zstandard, only when it decompresses to expected_size
+ * bytes. The size is checked before allocating, so corrupted data can't request huge buffers.
+ *
+ * @param compressed    the compressed source memory region.
+ * @param expected_size the size of the uncompressed data.
+ *
+ * @return the decompressed data, or an empty vector when the sizes don't match.
+ */
+[[nodiscard]] std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed,
+                                                 std::size_t expected_size);
+
 } // namespace Common::Compression
@@ -254,6 +254,7 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
     // Multi-process state
     config.processor_id = std::uint8_t(m_core_index);
     config.global_monitor = &m_exclusive_monitor.monitor;
+    config.translation_cache = m_translation_cache;
 
     // System registers
     config.tpidrro_el0 = &m_cb->m_tpidrro_el0;
@@ -276,6 +277,11 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
     config.code_cache_size = std::uint32_t(512_MiB);
 #endif
 
+    // Tiered compilation
+    if (Settings::values.cpu_tiered_compilation) {
+        config.tiered_compilation_threshold = 256;
+    }
+
     // Allow memory fault handling to work
     if (m_system.DebuggerEnabled()) {
         config.check_halt_on_memory_access = true;
@@ -310,6 +316,9 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
         if (!Settings::values.cpuopt_misc_ir) {
             config.optimizations &= ~Dynarmic::OptimizationFlag::MiscIROpt;
         }
+        if (Settings::values.cpuopt_trace_formation) {
+            config.optimizations |= Dynarmic::OptimizationFlag::TraceFormation;
+        }
         if (!Settings::values.cpuopt_reduce_misalign_checks) {
             config.only_detect_misalignment_via_page_table_on_page_boundary = false;
         }
@@ -416,9 +425,10 @@ void ArmDynarmic64::RewindBreakpointInstruction() {
 }
 
 ArmDynarmic64::ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProcess* process,
-                             DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index)
+                             DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index,
+                             Dynarmic::A64::TranslationCache* translation_cache)
     : ArmInterface{uses_wall_clock}, m_system{system}, m_exclusive_monitor{exclusive_monitor},
-      m_cb(std::make_unique<DynarmicCallbacks64>(*this, process)), m_core_index{core_index} {
+      m_translation_cache{translation_cache}, m_cb(std::make_unique<DynarmicCallbacks64>(*this, process)), m_core_index{core_index} {
     auto& page_table = process->GetPageTable().GetBasePageTable();
     auto& page_table_impl = page_table.GetImpl();
     m_jit = MakeJit(&page_table_impl, page_table.GetAddressSpaceWidth());
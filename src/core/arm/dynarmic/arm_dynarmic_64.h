@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -17,6 +20,10 @@ namespace Core::Memory {
 class Memory;
 }
 
+namespace Dynarmic::A64 {
+class TranslationCache;
+}
+
 namespace Core {
 
 class DynarmicCallbacks64;
@@ -26,7 +33,8 @@ class System;
 class ArmDynarmic64 final : public ArmInterface {
 public:
     ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProcess* process,
-                  DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index);
+                  DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index,
+                  Dynarmic::A64::TranslationCache* translation_cache = nullptr);
     ~ArmDynarmic64() override;
 
     Architecture GetArchitecture() const override {
@@ -55,6 +63,7 @@ protected:
 private:
     System& m_system;
     DynarmicExclusiveMonitor& m_exclusive_monitor;
+    Dynarmic::A64::TranslationCache* m_translation_cache;
 
 private:
     friend class DynarmicCallbacks64;
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
+#include "common/fs/path_util.h"
+#include "common/hex_util.h"
+#include "common/logging/log.h"
+#include "core/arm/dynarmic/dynarmic_translation_cache.h"
+
+namespace Core {
+
+DynarmicTranslationCache::DynarmicTranslationCache() = default;
+
+DynarmicTranslationCache::~DynarmicTranslationCache() = default;
+
+void DynarmicTranslationCache::Load(u64 program_id, std::span<const u8> build_id) {
+    m_path = Common::FS::GetEdenPath(Common::FS::EdenPath::ShaderDir) /
+             fmt::format("{:016x}", program_id) /
+             fmt::format("dynarmic_a64_{}.bin", Common::HexToString(build_id, false));
+
+    const Common::FS::MappedFile file{m_path};
+    if (!file.IsOpen()) {
+        m_cache.Clear();
+        return;
+    }
+    if (!m_cache.Deserialize(file.Data())) {
+        LOG_WARNING(Core_ARM, "Discarding incompatible translation cache {}",
+                    Common::FS::PathToUTF8String(m_path));
+        return;
+    }
+    LOG_INFO(Core_ARM, "Loaded {} translated blocks", m_cache.Size());
+}
+
+void DynarmicTranslationCache::Save() const {
+    if (m_path.empty() || m_cache.Size() == 0) {
+        return;
+    }
+    if (!Common::FS::CreateParentDirs(m_path)) {
+        LOG_ERROR(Core_ARM, "Failed to create translation cache directory");
+        return;
+    }
+    const std::vector<u8> data = m_cache.Serialize();
+    Common::FS::IOFile file{m_path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen() || file.WriteSpan(std::span<const u8>{data}) != data.size()) {
+        LOG_ERROR(Core_ARM, "Failed to write translation cache {}",
+                  Common::FS::PathToUTF8String(m_path));
+        return;
+    }
+    LOG_INFO(Core_ARM, "Saved {} translated blocks", m_cache.Size());
+}
+
+} // namespace Core
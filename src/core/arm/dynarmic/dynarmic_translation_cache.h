@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+
+#include <dynarmic/interface/A64/translation_cache.h>
+
+#include "common/common_types.h"
+
+namespace Core {
+
+/// Translated 64-bit guest code shared by the JITs of an application process. The contents are
+/// kept on disk next to the shader cache, keyed by program id and build id.
+class DynarmicTranslationCache {
+public:
+    DynarmicTranslationCache();
+    ~DynarmicTranslationCache();
+
+    /// Replaces the contents with the blocks previously saved for the given program build.
+    void Load(u64 program_id, std::span<const u8> build_id);
+
+    /// Writes the contents back to disk, does nothing if Load was never called.
+    void Save() const;
+
+    Dynarmic::A64::TranslationCache& Get() {
+        return m_cache;
+    }
+
+private:
+    Dynarmic::A64::TranslationCache m_cache;
+    std::filesystem::path m_path;
+};
+
+} // namespace Core
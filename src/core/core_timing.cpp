@@ -1,10 +1,13 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
 #include <mutex>
 #include <string>
 #include <tuple>
@@ -25,6 +28,9 @@ namespace Core::Timing {
 
 constexpr s64 MAX_SLICE_LENGTH = 10000;
 
+/// Unscheduled events are swept out of the wheel once they make up this share of it.
+constexpr size_t DEAD_EVENT_SWEEP_MIN = 64;
+
 std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callback) {
     return std::make_shared<EventType>(std::move(callback), std::move(name));
 }
@@ -34,20 +40,250 @@ struct CoreTiming::Event {
     u64 fifo_order;
     std::weak_ptr<EventType> type;
     s64 reschedule_time;
-    heap_t::handle_type handle{};
+    /// Value of the type's sequence number when this event was scheduled.
+    size_t sequence_number;
+    std::atomic<bool> cancelled{};
+
+    /// Links the event into the inbox, which keeps it alive until it is drained.
+    Event* inbox_next{};
+    std::shared_ptr<Event> inbox_self;
 
     // Sort by time, unless the times are the same, in which case sort by
     // the order added to the queue
-    friend bool operator>(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
-    }
-
     friend bool operator<(const Event& left, const Event& right) {
         return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
     }
 };
 
-CoreTiming::CoreTiming() : clock{Common::CreateOptimalClock()} {}
+/**
+ * Hierarchical timer wheel with ticks of roughly a microsecond. Level 0 has one slot per tick,
+ * every level above covers a whole rotation of the level below in each of its slots and is
+ * cascaded downwards when time reaches the slot. Events too far away for the top level wait
+ * in an overflow list. Occupancy bitmaps let idle stretches be skipped in a few steps.
+ */
+class CoreTiming::TimerWheel {
+public:
+    TimerWheel() {
+        for (size_t level = 0; level < NUM_LEVELS; ++level) {
+            levels[level].slots.resize(size_t{1} << LEVEL_BITS[level]);
+        }
+    }
+
+    size_t Size() const {
+        return size;
+    }
+
+    /// Moves the wheel forward to time without firing anything, only valid when empty.
+    void Rebase(s64 time) {
+        current_tick = std::max(current_tick, ToTick(time));
+    }
+
+    void Insert(std::shared_ptr<Event>&& evt) {
+        ++size;
+        Place(std::move(evt));
+    }
+
+    /// Advances the wheel up to now, appending every event due at or before now to batch.
+    void CollectDue(s64 now, std::vector<std::shared_ptr<Event>>& batch) {
+        const u64 target = ToTick(now);
+        while (true) {
+            TakeCurrentSlot(now, batch);
+            if (current_tick >= target) {
+                return;
+            }
+            current_tick = std::min(NextOccupiedTick(), target);
+            Cascade();
+        }
+    }
+
+    /// Returns the time of the next event, or a lower bound of it when it has not been
+    /// cascaded down to the first level yet.
+    std::optional<s64> NextEventTime() const {
+        s64 result = std::numeric_limits<s64>::max();
+        const Level& first = levels[0];
+        if (const auto dist = FindOccupied(first, SlotIndex(0, current_tick), first.Count())) {
+            for (const auto& evt : first.slots[SlotIndex(0, current_tick + *dist)]) {
+                result = std::min(result, evt->time);
+            }
+        }
+        for (size_t level = 1; level < NUM_LEVELS; ++level) {
+            if (const auto start = NextSlotStart(level)) {
+                result = std::min(result, static_cast<s64>(*start << TICK_SHIFT));
+            }
+        }
+        for (const auto& evt : overflow) {
+            result = std::min(result, evt->time);
+        }
+        if (result == std::numeric_limits<s64>::max()) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+    /// Removes every event matching pred, returns how many were removed.
+    template <typename Pred>
+    size_t EraseIf(Pred&& pred) {
+        size_t removed = 0;
+        const auto erase = [&](std::vector<std::shared_ptr<Event>>& events) {
+            removed += std::erase_if(events, [&](const auto& evt) { return pred(*evt); });
+        };
+        for (Level& level : levels) {
+            for (size_t index = 0; index < level.slots.size(); ++index) {
+                erase(level.slots[index]);
+                if (level.slots[index].empty()) {
+                    level.SetOccupied(index, false);
+                }
+            }
+        }
+        erase(overflow);
+        size -= removed;
+        return removed;
+    }
+
+    void Clear() {
+        for (Level& level : levels) {
+            for (auto& slot : level.slots) {
+                slot.clear();
+            }
+            level.occupied.fill(0);
+        }
+        overflow.clear();
+        size = 0;
+    }
+
+private:
+    static constexpr u32 TICK_SHIFT = 10;
+    static constexpr size_t NUM_LEVELS = 5;
+    static constexpr std::array<u32, NUM_LEVELS> LEVEL_BITS{8, 6, 6, 6, 6};
+    static constexpr std::array<u32, NUM_LEVELS> LEVEL_SHIFT{0, 8, 14, 20, 26};
+
+    struct Level {
+        std::vector<std::vector<std::shared_ptr<Event>>> slots;
+        std::array<u64, 4> occupied{};
+
+        u64 Count() const {
+            return slots.size();
+        }
+
+        void SetOccupied(u64 index, bool value) {
+            const u64 bit = u64{1} << (index % 64);
+            occupied[index / 64] = value ? occupied[index / 64] | bit : occupied[index / 64] & ~bit;
+        }
+    };
+
+    static u64 ToTick(s64 time) {
+        return time <= 0 ? 0 : static_cast<u64>(time) >> TICK_SHIFT;
+    }
+
+    static u64 SlotIndex(size_t level, u64 tick) {
+        return (tick >> LEVEL_SHIFT[level]) & ((u64{1} << LEVEL_BITS[level]) - 1);
+    }
+
+    /// Distance from first to the next occupied slot in circular order, looking at count slots.
+    static std::optional<u64> FindOccupied(const Level& level, u64 first, u64 count) {
+        const u64 mask = level.Count() - 1;
+        for (u64 dist = 0; dist < count;) {
+            const u64 index = (first + dist) & mask;
+            const u64 word = level.occupied[index / 64] >> (index % 64);
+            if (word != 0) {
+                dist += std::countr_zero(word);
+                return dist < count ? std::optional{dist} : std::nullopt;
+            }
+            dist += 64 - index % 64;
+        }
+        return std::nullopt;
+    }
+
+    /// First tick of the next occupied slot of a level above the first one.
+    std::optional<u64> NextSlotStart(size_t level) const {
+        const Level& lvl = levels[level];
+        const u64 current = current_tick >> LEVEL_SHIFT[level];
+        const auto dist = FindOccupied(lvl, (current + 1) & (lvl.Count() - 1), lvl.Count() - 1);
+        if (!dist) {
+            return std::nullopt;
+        }
+        return (current + 1 + *dist) << LEVEL_SHIFT[level];
+    }
+
+    /// Next tick at which the wheel has work to do, either firing or cascading.
+    u64 NextOccupiedTick() const {
+        u64 result = std::numeric_limits<u64>::max();
+        const Level& first = levels[0];
+        if (const auto dist =
+                FindOccupied(first, SlotIndex(0, current_tick + 1), first.Count() - 1)) {
+            result = current_tick + 1 + *dist;
+        }
+        for (size_t level = 1; level < NUM_LEVELS; ++level) {
+            if (const auto start = NextSlotStart(level)) {
+                result = std::min(result, *start);
+            }
+        }
+        if (!overflow.empty()) {
+            const u64 top_shift = LEVEL_SHIFT.back();
+            result = std::min(result, ((current_tick >> top_shift) + 1) << top_shift);
+        }
+        return result;
+    }
+
+    void Place(std::shared_ptr<Event>&& evt) {
+        const u64 tick = std::max(ToTick(evt->time), current_tick);
+        for (size_t level = 0; level < NUM_LEVELS; ++level) {
+            const u64 distance = (tick >> LEVEL_SHIFT[level]) - (current_tick >> LEVEL_SHIFT[level]);
+            if (distance < levels[level].Count()) {
+                const u64 index = SlotIndex(level, tick);
+                levels[level].slots[index].push_back(std::move(evt));
+                levels[level].SetOccupied(index, true);
+                return;
+            }
+        }
+        overflow.push_back(std::move(evt));
+    }
+
+    void TakeCurrentSlot(s64 now, std::vector<std::shared_ptr<Event>>& batch) {
+        const u64 index = SlotIndex(0, current_tick);
+        auto& slot = levels[0].slots[index];
+        if (slot.empty()) {
+            return;
+        }
+        const auto due = std::ranges::partition(slot, [now](const auto& evt) {
+            return evt->time > now;
+        });
+        size -= static_cast<size_t>(due.size());
+        std::ranges::move(due, std::back_inserter(batch));
+        slot.erase(due.begin(), due.end());
+        levels[0].SetOccupied(index, !slot.empty());
+    }
+
+    /// Redistributes the slots that start at the current tick into the levels below.
+    void Cascade() {
+        const u64 top_shift = LEVEL_SHIFT.back();
+        if (!overflow.empty() && (current_tick & ((u64{1} << top_shift) - 1)) == 0) {
+            auto events = std::exchange(overflow, {});
+            for (auto& evt : events) {
+                Place(std::move(evt));
+            }
+        }
+        for (size_t level = NUM_LEVELS - 1; level > 0; --level) {
+            if ((current_tick & ((u64{1} << LEVEL_SHIFT[level]) - 1)) != 0) {
+                continue;
+            }
+            const u64 index = SlotIndex(level, current_tick);
+            auto events = std::exchange(levels[level].slots[index], {});
+            levels[level].SetOccupied(index, false);
+            for (auto& evt : events) {
+                Place(std::move(evt));
+            }
+        }
+    }
+
+    std::array<Level, NUM_LEVELS> levels;
+    std::vector<std::shared_ptr<Event>> overflow;
+    u64 current_tick = 0;
+    size_t size = 0;
+};
+
+CoreTiming::CoreTiming()
+    : clock{Common::CreateOptimalClock()}, wheel{std::make_unique<TimerWheel>()} {}
 
 CoreTiming::~CoreTiming() {
     Reset();
@@ -73,8 +309,11 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
 }
 
 void CoreTiming::ClearPendingEvents() {
-    std::scoped_lock lock{advance_lock, basic_lock};
-    event_queue.clear();
+    std::scoped_lock lock{advance_lock};
+    DrainInbox();
+    wheel->Clear();
+    pending_events = 0;
+    dead_events = 0;
     event.Set();
 }
 
@@ -112,57 +351,72 @@ bool CoreTiming::IsRunning() const {
 }
 
 bool CoreTiming::HasPendingEvents() const {
-    std::scoped_lock lock{basic_lock};
-    return !(wait_set && event_queue.empty());
+    return !(wait_set && pending_events == 0);
 }
 
-void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
-                               const std::shared_ptr<EventType>& event_type, bool absolute_time) {
-    {
-        std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
+CoreTiming::EventHandle CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
+                                                  const std::shared_ptr<EventType>& event_type,
+                                                  bool absolute_time) {
+    const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
+    return PushEvent(next_time.count(), 0, event_type);
+}
 
-        auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
-        (*h).handle = h;
+CoreTiming::EventHandle CoreTiming::ScheduleLoopingEvent(
+    std::chrono::nanoseconds start_time, std::chrono::nanoseconds resched_time,
+    const std::shared_ptr<EventType>& event_type, bool absolute_time) {
+    const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
+    return PushEvent(next_time.count(), resched_time.count(), event_type);
+}
+
+CoreTiming::EventHandle CoreTiming::PushEvent(s64 time, s64 reschedule_time,
+                                              const std::shared_ptr<EventType>& event_type) {
+    auto evt = std::make_shared<Event>();
+    evt->time = time;
+    evt->fifo_order = event_fifo_id.fetch_add(1, std::memory_order_relaxed);
+    evt->type = event_type;
+    evt->reschedule_time = reschedule_time;
+    evt->sequence_number = event_type->sequence_number.load(std::memory_order_acquire);
+
+    EventHandle handle;
+    handle.event = evt;
+
+    ++pending_events;
+    Event* const node = evt.get();
+    node->inbox_self = std::move(evt);
+    node->inbox_next = inbox.load(std::memory_order_relaxed);
+    while (!inbox.compare_exchange_weak(node->inbox_next, node, std::memory_order_release,
+                                        std::memory_order_relaxed)) {
     }
 
     event.Set();
+    return handle;
 }
 
-void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
-                                      std::chrono::nanoseconds resched_time,
-                                      const std::shared_ptr<EventType>& event_type,
-                                      bool absolute_time) {
-    {
-        std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
-
-        auto h{event_queue.emplace(
-            Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
-        (*h).handle = h;
+void CoreTiming::DrainInbox() {
+    Event* node = inbox.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+        Event* const next = node->inbox_next;
+        wheel->Insert(std::move(node->inbox_self));
+        node = next;
     }
-
-    event.Set();
 }
 
 void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
                                  UnscheduleEventType type) {
-    {
-        std::scoped_lock lk{basic_lock};
-
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
-            const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
-                to_remove.push_back(itr->handle);
-            }
-        }
+    // Events scheduled before this point no longer match the type and are dropped when reached
+    event_type->sequence_number.fetch_add(1, std::memory_order_acq_rel);
+    ++dead_events;
 
-        for (auto& h : to_remove) {
-            event_queue.erase(h);
-        }
+    // Force any in-progress events to finish
+    if (type == UnscheduleEventType::Wait) {
+        std::scoped_lock lk{advance_lock};
+    }
+}
 
-        event_type->sequence_number++;
+void CoreTiming::UnscheduleEvent(const EventHandle& handle, UnscheduleEventType type) {
+    if (const auto evt = handle.event.lock()) {
+        evt->cancelled.store(true, std::memory_order_release);
+        ++dead_events;
     }
 
     // Force any in-progress events to finish
@@ -171,6 +425,11 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
     }
 }
 
+bool CoreTiming::IsDead(const Event& evt, const EventType& event_type) {
+    return evt.cancelled.load(std::memory_order_acquire) ||
+           evt.sequence_number != event_type.sequence_number.load(std::memory_order_acquire);
+}
+
 static u64 GetNextTickCount(u64 next_ticks) {
     if (Settings::values.use_custom_cpu_ticks.GetValue()) {
         return Settings::values.cpu_ticks.GetValue();
@@ -222,62 +481,72 @@ u64 CoreTiming::GetGPUTicks() const {
 }
 
 std::optional<s64> CoreTiming::Advance() {
-    std::scoped_lock lock{advance_lock, basic_lock};
+    std::scoped_lock lock{advance_lock};
     global_timer = GetGlobalTimeNs().count();
+    if (wheel->Size() == 0) {
+        wheel->Rebase(global_timer);
+    }
+    DrainInbox();
 
-    while (!event_queue.empty() && event_queue.top().time <= global_timer) {
-        const Event& evt = event_queue.top();
-
-        if (const auto event_type{evt.type.lock()}) {
-            const auto evt_time = evt.time;
-            const auto evt_sequence_num = event_type->sequence_number;
-
-            if (evt.reschedule_time == 0) {
-                event_queue.pop();
-
-                basic_lock.unlock();
-
-                event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time});
+    while (true) {
+        wheel->CollectDue(global_timer, due_events);
+        if (due_events.empty()) {
+            break;
+        }
+        // Everything that became due since the last pass fires as one batch, in order
+        std::ranges::sort(due_events, [](const auto& left, const auto& right) {
+            return *left < *right;
+        });
+        for (auto& evt : due_events) {
+            FireEvent(std::move(evt));
+        }
+        due_events.clear();
 
-                basic_lock.lock();
-            } else {
-                basic_lock.unlock();
+        DrainInbox();
+        global_timer = GetGlobalTimeNs().count();
+    }
 
-                const auto new_schedule_time{event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time})};
+    if (dead_events.load(std::memory_order_relaxed) > wheel->Size() / 2 + DEAD_EVENT_SWEEP_MIN) {
+        dead_events = 0;
+        pending_events -= wheel->EraseIf([this](const Event& evt) {
+            const auto event_type = evt.type.lock();
+            return !event_type || IsDead(evt, *event_type);
+        });
+    }
 
-                basic_lock.lock();
+    return wheel->NextEventTime();
+}
 
-                if (evt_sequence_num != event_type->sequence_number) {
-                    // Heap handle is invalidated after external modification.
-                    continue;
-                }
+void CoreTiming::FireEvent(std::shared_ptr<Event>&& evt) {
+    const auto event_type{evt->type.lock()};
+    if (!event_type || IsDead(*evt, *event_type)) {
+        --pending_events;
+        return;
+    }
 
-                const auto next_schedule_time{new_schedule_time.has_value()
-                                                  ? new_schedule_time.value().count()
-                                                  : evt.reschedule_time};
+    const auto evt_time = evt->time;
+    const auto new_schedule_time{event_type->callback(
+        evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time})};
 
-                // If this event was scheduled into a pause, its time now is going to be way
-                // behind. Re-set this event to continue from the end of the pause.
-                auto next_time{evt.time + next_schedule_time};
-                if (evt.time < pause_end_time) {
-                    next_time = pause_end_time + next_schedule_time;
-                }
+    if (evt->reschedule_time == 0 || IsDead(*evt, *event_type)) {
+        --pending_events;
+        return;
+    }
 
-                event_queue.update(evt.handle, Event{next_time, event_fifo_id++, evt.type,
-                                                     next_schedule_time, evt.handle});
-            }
-        }
+    const auto next_schedule_time{new_schedule_time.has_value() ? new_schedule_time.value().count()
+                                                                : evt->reschedule_time};
 
-        global_timer = GetGlobalTimeNs().count();
+    // If this event was scheduled into a pause, its time now is going to be way
+    // behind. Re-set this event to continue from the end of the pause.
+    auto next_time{evt->time + next_schedule_time};
+    if (evt->time < pause_end_time) {
+        next_time = pause_end_time + next_schedule_time;
     }
 
-    if (!event_queue.empty()) {
-        return event_queue.top().time;
-    } else {
-        return std::nullopt;
-    }
+    evt->time = next_time;
+    evt->fifo_order = event_fifo_id.fetch_add(1, std::memory_order_relaxed);
+    evt->reschedule_time = next_schedule_time;
+    wheel->Insert(std::move(evt));
 }
 
 void CoreTiming::ThreadLoop() {
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -11,8 +14,7 @@
 #include <optional>
 #include <string>
 #include <thread>
-
-#include <boost/heap/fibonacci_heap.hpp>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/thread.h"
@@ -34,8 +36,8 @@ struct EventType {
     /// A pointer to the name of the event.
     const std::string name;
     /// A monotonic sequence number, incremented when this event is
-    /// changed externally.
-    size_t sequence_number;
+    /// changed externally. Scheduled events with an older number are dropped.
+    std::atomic<size_t> sequence_number;
 };
 
 enum class UnscheduleEventType {
@@ -54,9 +56,29 @@ enum class UnscheduleEventType {
  * So to schedule a new event on a regular basis:
  * inside callback:
  *   ScheduleEvent(period_in_ns - ns_late, callback, "whatever")
+ *
+ * Pending events are kept in a hierarchical timer wheel owned by whoever is advancing the
+ * timing. Other threads never touch the wheel, they push new events into a lock-free inbox
+ * that is drained on the next Advance, and unscheduling only marks events as dead.
  */
 class CoreTiming {
+    struct Event;
+
 public:
+    /// Refers to a single scheduled event, looping events keep the same handle for every
+    /// iteration.
+    class EventHandle {
+    public:
+        /// Returns true if the event may still fire.
+        bool IsPending() const {
+            return !event.expired();
+        }
+
+    private:
+        friend class CoreTiming;
+        std::weak_ptr<Event> event;
+    };
+
     CoreTiming();
     ~CoreTiming();
 
@@ -96,19 +118,25 @@ public:
     bool HasPendingEvents() const;
 
     /// Schedules an event in core timing
-    void ScheduleEvent(std::chrono::nanoseconds ns_into_future,
-                       const std::shared_ptr<EventType>& event_type, bool absolute_time = false);
+    EventHandle ScheduleEvent(std::chrono::nanoseconds ns_into_future,
+                              const std::shared_ptr<EventType>& event_type,
+                              bool absolute_time = false);
 
     /// Schedules an event which will automatically re-schedule itself with the given time, until
     /// unscheduled
-    void ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
-                              std::chrono::nanoseconds resched_time,
-                              const std::shared_ptr<EventType>& event_type,
-                              bool absolute_time = false);
+    EventHandle ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
+                                     std::chrono::nanoseconds resched_time,
+                                     const std::shared_ptr<EventType>& event_type,
+                                     bool absolute_time = false);
 
+    /// Unschedules every pending event of the given type.
     void UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
                          UnscheduleEventType type = UnscheduleEventType::Wait);
 
+    /// Unschedules the single event referred to by handle.
+    void UnscheduleEvent(const EventHandle& handle,
+                         UnscheduleEventType type = UnscheduleEventType::Wait);
+
     void AddTicks(u64 ticks_to_add);
 
     void ResetTicks();
@@ -139,13 +167,19 @@ public:
 #endif
 
 private:
-    struct Event;
+    class TimerWheel;
 
     static void ThreadEntry(CoreTiming& instance);
     void ThreadLoop();
 
     void Reset();
 
+    EventHandle PushEvent(s64 time, s64 reschedule_time,
+                          const std::shared_ptr<EventType>& event_type);
+    void DrainInbox();
+    void FireEvent(std::shared_ptr<Event>&& evt);
+    static bool IsDead(const Event& evt, const EventType& event_type);
+
     std::unique_ptr<Common::WallClock> clock;
 
     s64 global_timer = 0;
@@ -154,15 +188,20 @@ private:
     s64 timer_resolution_ns;
 #endif
 
-    using heap_t =
-        boost::heap::fibonacci_heap<CoreTiming::Event, boost::heap::compare<std::greater<>>>;
+    /// Only accessed with advance_lock held.
+    std::unique_ptr<TimerWheel> wheel;
+    std::vector<std::shared_ptr<Event>> due_events;
 
-    heap_t event_queue;
-    u64 event_fifo_id = 0;
+    /// Intrusive list of scheduled events not inserted into the wheel yet.
+    std::atomic<Event*> inbox{};
+    std::atomic<u64> event_fifo_id = 0;
+    /// Events in the inbox or the wheel, including ones that were unscheduled but not dropped.
+    std::atomic<size_t> pending_events = 0;
+    /// Rough count of unscheduled events still in the wheel, used to decide when to sweep.
+    std::atomic<size_t> dead_events = 0;
 
     Common::Event event{};
     Common::Event pause_event{};
-    mutable std::mutex basic_lock;
     std::mutex advance_lock;
     std::unique_ptr<std::jthread> timer_thread;
     std::atomic<bool> paused{};
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -6,6 +9,7 @@
 #include "common/settings.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
+#include "core/arm/dynarmic/dynarmic_translation_cache.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/k_scoped_resource_reservation.h"
@@ -175,11 +179,17 @@ void KProcess::Finalize() {
         m_resource_limit->Close();
     }
 
+    // Keep the translated code for the next run.
+    if (m_translation_cache) {
+        m_translation_cache->Save();
+    }
+
     // Clear expensive resources, as the destructor is not called for guest objects.
     for (auto& interface : m_arm_interfaces) {
         interface.reset();
     }
     m_exclusive_monitor.reset();
+    m_translation_cache.reset();
 
     // Perform inherited finalization.
     KSynchronizationObject::Finalize();
@@ -997,6 +1007,12 @@ Result KProcess::Run(s32 priority, size_t stack_size) {
         main_thread->RequestSuspend(SuspendType::Debug);
     }
 
+    // Restore code translated by a previous run, the modules are loaded by now.
+    if (m_translation_cache) {
+        m_translation_cache->Load(this->GetProgramId(),
+                                  m_kernel.System().GetApplicationProcessBuildID());
+    }
+
     // Run our thread.
     R_TRY(main_thread->Run());
 
@@ -1276,10 +1292,14 @@ void KProcess::InitializeInterfaces() {
     } else
 #endif
         if (this->Is64Bit()) {
+        if (this->IsApplication() && Settings::values.cpu_translation_cache.GetValue()) {
+            m_translation_cache = std::make_unique<Core::DynarmicTranslationCache>();
+        }
         for (size_t i = 0; i < Core::Hardware::NUM_CPU_CORES; i++) {
             m_arm_interfaces[i] = std::make_unique<Core::ArmDynarmic64>(
                 m_kernel.System(), m_kernel.IsMulticore(), this,
-                static_cast<Core::DynarmicExclusiveMonitor&>(*m_exclusive_monitor), i);
+                static_cast<Core::DynarmicExclusiveMonitor&>(*m_exclusive_monitor), i,
+                m_translation_cache ? &m_translation_cache->Get() : nullptr);
         }
     } else {
         for (size_t i = 0; i < Core::Hardware::NUM_CPU_CORES; i++) {
@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dynarmic/backend/a64_translation_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+#include <boost/icl/interval_set.hpp>
+
+#include "dynarmic/common/variant_util.h"
+#include "dynarmic/frontend/A64/a64_location_descriptor.h"
+#include "dynarmic/interface/A64/config.h"
+#include "dynarmic/ir/serialization.h"
+#include "dynarmic/ir/terminal.h"
+
+namespace Dynarmic::A64 {
+
+namespace {
+
+constexpr u64 FILE_MAGIC = 0x3143'5434'3641'5944ULL;  // "DYA64TC1"
+
+/// Upper bound on the guest code covered by a single block, larger blocks are not cached.
+constexpr u64 MAX_BLOCK_BYTES = 64 * 1024;
+
+template<typename T>
+void Append(std::vector<u8>& out, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const size_t offset = out.size();
+    out.resize(offset + sizeof(T));
+    std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+template<typename T>
+bool Extract(std::span<const u8>& data, T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (data.size() < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, data.data(), sizeof(T));
+    data = data.subspan(sizeof(T));
+    return true;
+}
+
+/// Interpret terminals make the backend hand instructions past the end of the block to the
+/// interpreter, those instructions are part of the block's translation too.
+u64 InterpretedEnd(const IR::Terminal& terminal) {
+    return Common::VisitVariant<u64>(terminal, [](const auto& term) -> u64 {
+        using T = std::decay_t<decltype(term)>;
+        if constexpr (std::is_same_v<T, IR::Term::Interpret>) {
+            return LocationDescriptor{term.next}.PC() + term.num_instructions * 4;
+        } else if constexpr (std::is_same_v<T, IR::Term::If> || std::is_same_v<T, IR::Term::CheckBit>) {
+            return (std::max)(InterpretedEnd(term.then_), InterpretedEnd(term.else_));
+        } else if constexpr (std::is_same_v<T, IR::Term::CheckHalt>) {
+            return InterpretedEnd(term.else_);
+        } else {
+            return 0;
+        }
+    });
+}
+
+}  // Anonymous namespace
+
+u64 TranslationConfigHash(const UserConfig& conf, u64 backend_options) {
+    u64 hash = 0xcbf29ce484222325ULL;
+    const auto mix = [&hash](u64 value) {
+        hash = (hash ^ value) * 0x100000001b3ULL;
+        hash ^= hash >> 29;
+    };
+    mix(backend_options);
+    mix(conf.define_unpredictable_behaviour);
+    mix(conf.wall_clock_cntpct);
+    mix(conf.hook_data_cache_operations);
+    mix(conf.dczid_el0);
+    mix(conf.check_halt_on_memory_access);
+    mix(conf.HasOptimization(OptimizationFlag::GetSetElimination));
+    mix(conf.HasOptimization(OptimizationFlag::ConstProp));
+    mix(conf.HasOptimization(OptimizationFlag::MiscIROpt));
+    mix(conf.HasOptimization(OptimizationFlag::TraceFormation));
+    return hash;
+}
+
+std::optional<IR::Block> TranslationCache::Impl::Find(IR::LocationDescriptor location, u64 config_hash,
+                                                      UserCallbacks* callbacks) const {
+    std::shared_lock lock{mutex};
+    const auto it = entries.find(location.Value());
+    if (it == entries.end() || it->second.config_hash != config_hash) {
+        return std::nullopt;
+    }
+    const Entry& entry = it->second;
+    for (size_t i = 0; i < entry.code.size(); ++i) {
+        const std::optional<u32> word = callbacks->MemoryReadCode(entry.start_pc + i * 4);
+        if (word != entry.code[i]) {
+            return std::nullopt;
+        }
+    }
+    return IR::DeserializeBlock(entry.ir);
+}
+
+void TranslationCache::Impl::Insert(const IR::Block& block, u64 config_hash,
+                                    UserCallbacks* callbacks) {
+    const LocationDescriptor location{block.Location()};
+    if (location.SingleStepping()) {
+        return;
+    }
+    const u64 start_pc = location.PC();
+    const u64 end_pc = (std::max)(LocationDescriptor{block.EndLocation()}.PC(),
+                                  InterpretedEnd(block.GetTerminal()));
+    if (end_pc <= start_pc || end_pc - start_pc > MAX_BLOCK_BYTES) {
+        return;
+    }
+
+    Entry entry{
+        .config_hash = config_hash,
+        .start_pc = start_pc,
+        .code = std::vector<u32>((end_pc - start_pc) / 4),
+        .ir = {},
+    };
+    for (size_t i = 0; i < entry.code.size(); ++i) {
+        const std::optional<u32> word = callbacks->MemoryReadCode(start_pc + i * 4);
+        if (!word) {
+            return;
+        }
+        entry.code[i] = *word;
+    }
+    IR::SerializeBlock(block, entry.ir);
+
+    std::unique_lock lock{mutex};
+    AddEntry(location.UniqueHash(), std::move(entry));
+}
+
+void TranslationCache::Impl::InvalidateCacheRange(u64 start_address, size_t length) {
+    if (length == 0) {
+        return;
+    }
+    boost::icl::interval_set<u64> ranges;
+    ranges.add(boost::icl::discrete_interval<u64>::closed(start_address, start_address + length - 1));
+
+    std::unique_lock lock{mutex};
+    for (const IR::LocationDescriptor location : block_ranges.InvalidateRanges(ranges)) {
+        entries.erase(location.Value());
+    }
+}
+
+bool TranslationCache::Impl::Deserialize(std::span<const u8> data) {
+    std::unique_lock lock{mutex};
+    entries.clear();
+    block_ranges.ClearCache();
+
+    u64 magic, fingerprint;
+    u32 count;
+    if (!Extract(data, magic) || magic != FILE_MAGIC || !Extract(data, fingerprint)
+        || fingerprint != IR::SerializationFingerprint() || !Extract(data, count)) {
+        return false;
+    }
+    for (u32 i = 0; i < count; ++i) {
+        u64 location;
+        u32 code_size, ir_size;
+        Entry entry{};
+        if (!Extract(data, location) || !Extract(data, entry.config_hash)
+            || !Extract(data, entry.start_pc) || !Extract(data, code_size)
+            || code_size == 0 || code_size > MAX_BLOCK_BYTES / 4
+            || data.size() < code_size * sizeof(u32)) {
+            entries.clear();
+            block_ranges.ClearCache();
+            return false;
+        }
+        entry.code.resize(code_size);
+        std::memcpy(entry.code.data(), data.data(), code_size * sizeof(u32));
+        data = data.subspan(code_size * sizeof(u32));
+        if (!Extract(data, ir_size) || data.size() < ir_size) {
+            entries.clear();
+            block_ranges.ClearCache();
+            return false;
+        }
+        entry.ir.assign(data.begin(), data.begin() + ir_size);
+        data = data.subspan(ir_size);
+        AddEntry(location, std::move(entry));
+    }
+    return true;
+}
+
+std::vector<u8> TranslationCache::Impl::Serialize() const {
+    std::shared_lock lock{mutex};
+    std::vector<u8> out;
+    Append(out, FILE_MAGIC);
+    Append(out, IR::SerializationFingerprint());
+    Append(out, static_cast<u32>(entries.size()));
+    for (const auto& [location, entry] : entries) {
+        Append(out, location);
+        Append(out, entry.config_hash);
+        Append(out, entry.start_pc);
+        Append(out, static_cast<u32>(entry.code.size()));
+        const size_t code_offset = out.size();
+        out.resize(code_offset + entry.code.size() * sizeof(u32));
+        std::memcpy(out.data() + code_offset, entry.code.data(), entry.code.size() * sizeof(u32));
+        Append(out, static_cast<u32>(entry.ir.size()));
+        out.insert(out.end(), entry.ir.begin(), entry.ir.end());
+    }
+    return out;
+}
+
+void TranslationCache::Impl::Clear() {
+    std::unique_lock lock{mutex};
+    entries.clear();
+    block_ranges.ClearCache();
+}
+
+size_t TranslationCache::Impl::Size() const {
+    std::shared_lock lock{mutex};
+    return entries.size();
+}
+
+void TranslationCache::Impl::AddEntry(u64 location, Entry&& entry) {
+    const u64 end_pc = entry.start_pc + entry.code.size() * 4 - 1;
+    block_ranges.AddRange(boost::icl::discrete_interval<u64>::closed(entry.start_pc, end_pc),
+                          IR::LocationDescriptor{location});
+    entries.insert_or_assign(location, std::move(entry));
+}
+
+TranslationCache::TranslationCache()
+        : impl(std::make_unique<Impl>()) {}
+
+TranslationCache::~TranslationCache() = default;
+
+bool TranslationCache::Deserialize(std::span<const std::uint8_t> data) {
+    return impl->Deserialize(data);
+}
+
+std::vector<std::uint8_t> TranslationCache::Serialize() const {
+    return impl->Serialize();
+}
+
+void TranslationCache::Clear() {
+    impl->Clear();
+}
+
+std::size_t TranslationCache::Size() const {
+    return impl->Size();
+}
+
+}  // namespace Dynarmic::A64
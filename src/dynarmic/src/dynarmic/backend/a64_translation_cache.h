@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <vector>
+
+#include <ankerl/unordered_dense.h>
+
+#include "dynarmic/backend/block_range_information.h"
+#include "dynarmic/common/common_types.h"
+#include "dynarmic/interface/A64/translation_cache.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/location_descriptor.h"
+
+namespace Dynarmic::A64 {
+
+struct UserCallbacks;
+struct UserConfig;
+
+/// Hashes every configuration option that changes the IR produced for a block.
+/// backend_options identifies backend specific passes such as polyfills.
+u64 TranslationConfigHash(const UserConfig& conf, u64 backend_options);
+
+struct TranslationCache::Impl {
+    /// Returns a copy of the block at location, provided it was translated with the same
+    /// configuration and the guest code it covers has not changed since.
+    std::optional<IR::Block> Find(IR::LocationDescriptor location, u64 config_hash,
+                                  UserCallbacks* callbacks) const;
+
+    /// Stores a fully optimized block. Single stepping blocks and blocks whose guest code
+    /// cannot be read back are not cached.
+    void Insert(const IR::Block& block, u64 config_hash, UserCallbacks* callbacks);
+
+    /// Drops every block overlapping [start_address, start_address + length).
+    void InvalidateCacheRange(u64 start_address, size_t length);
+
+    bool Deserialize(std::span<const u8> data);
+    std::vector<u8> Serialize() const;
+    void Clear();
+    size_t Size() const;
+
+private:
+    struct Entry {
+        u64 config_hash;
+        u64 start_pc;
+        std::vector<u32> code;  ///< Guest instructions the block was translated from
+        std::vector<u8> ir;     ///< Serialized optimized IR
+    };
+
+    void AddEntry(u64 location, Entry&& entry);
+
+    mutable std::shared_mutex mutex;
+    ankerl::unordered_dense::map<u64, Entry> entries;
+    Backend::BlockRangeInformation<u64> block_ranges;
+};
+
+}  // namespace Dynarmic::A64
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2022 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -5,6 +8,7 @@
 
 #include "dynarmic/backend/arm64/a64_address_space.h"
 
+#include "dynarmic/backend/a64_translation_cache.h"
 #include "dynarmic/backend/arm64/a64_jitstate.h"
 #include "dynarmic/backend/arm64/abi.h"
 #include "dynarmic/backend/arm64/devirtualize.h"
@@ -323,14 +327,21 @@ static void* EmitExclusiveWrite128CallTrampoline(oaknut::CodeGenerator& code, co
 
 A64AddressSpace::A64AddressSpace(const A64::UserConfig& conf)
         : AddressSpace(conf.code_cache_size)
-        , conf(conf) {
+        , conf(conf)
+        , translation_config_hash(A64::TranslationConfigHash(conf, /*backend_options=*/2 << 8)) {
     EmitPrelude();
 }
 
 IR::Block A64AddressSpace::GenerateIR(IR::LocationDescriptor descriptor) const {
+    if (conf.translation_cache) {
+        if (auto cached_block = conf.translation_cache->GetImpl().Find(descriptor, translation_config_hash, conf.callbacks)) {
+            Optimization::VerificationPass(*cached_block);
+            return std::move(*cached_block);
+        }
+    }
+
     const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
-    IR::Block ir_block = A64::Translate(A64::LocationDescriptor{descriptor}, get_code,
-                                        {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
+    IR::Block ir_block = A64::Translate(A64::LocationDescriptor{descriptor}, get_code, A64::GenTranslationOptions(conf));
 
     Optimization::A64CallbackConfigPass(ir_block, conf);
     Optimization::NamingPass(ir_block);
@@ -346,6 +357,9 @@ IR::Block A64AddressSpace::GenerateIR(IR::LocationDescriptor descriptor) const {
         Optimization::A64MergeInterpretBlocksPass(ir_block, conf.callbacks);
     }
     Optimization::VerificationPass(ir_block);
+    if (conf.translation_cache) {
+        conf.translation_cache->GetImpl().Insert(ir_block, translation_config_hash, conf.callbacks);
+    }
 
     return ir_block;
 }
@@ -14,6 +14,7 @@
 #include <mcl/scope_exit.hpp>
 #include "dynarmic/common/common_types.h"
 
+#include "dynarmic/backend/a64_translation_cache.h"
 #include "dynarmic/backend/arm64/a64_address_space.h"
 #include "dynarmic/backend/arm64/a64_core.h"
 #include "dynarmic/backend/arm64/a64_jitstate.h"
@@ -70,6 +71,9 @@ struct Jit::Impl final {
     }
 
     void InvalidateCacheRange(std::uint64_t start_address, std::size_t length) {
+        if (conf.translation_cache) {
+            conf.translation_cache->GetImpl().InvalidateCacheRange(start_address, length);
+        }
         std::unique_lock lock{invalidation_mutex};
         invalid_cache_ranges.add(boost::icl::discrete_interval<u64>::closed(start_address, start_address + length - 1));
         HaltExecution(HaltReason::CacheInvalidation);
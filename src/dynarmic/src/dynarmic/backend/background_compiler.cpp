@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dynarmic/backend/background_compiler.h"
+
+#include <utility>
+
+namespace Dynarmic::Backend {
+
+BackgroundCompiler::BackgroundCompiler(CompileFunction compile_)
+        : compile(std::move(compile_)), worker([this] { WorkerLoop(); }) {}
+
+BackgroundCompiler::~BackgroundCompiler() {
+    {
+        std::scoped_lock lock{mutex};
+        stop = true;
+    }
+    work_cv.notify_one();
+    worker.join();
+}
+
+void BackgroundCompiler::Enqueue(IR::LocationDescriptor location) {
+    {
+        std::scoped_lock lock{mutex};
+        if (!requested.insert(location).second) {
+            return;
+        }
+        queue.push_back(location);
+    }
+    work_cv.notify_one();
+}
+
+std::vector<IR::Block> BackgroundCompiler::TakeCompiled() {
+    std::scoped_lock lock{mutex};
+    has_compiled.store(false, std::memory_order_relaxed);
+    // Installed blocks have no execution counter. Should their code be invalidated, they are
+    // emitted at tier 0 again and must be able to request another compilation.
+    for (const IR::Block& block : compiled) {
+        requested.erase(block.Location());
+    }
+    return std::exchange(compiled, {});
+}
+
+void BackgroundCompiler::Invalidate() {
+    {
+        std::scoped_lock lock{mutex};
+        ++epoch;
+        // These blocks are still hot, but their execution counters have already fired.
+        for (const IR::Block& block : compiled) {
+            queue.push_back(block.Location());
+        }
+        compiled.clear();
+        has_compiled.store(false, std::memory_order_relaxed);
+        if (queue.empty()) {
+            return;
+        }
+    }
+    work_cv.notify_one();
+}
+
+void BackgroundCompiler::WaitForIdle() {
+    std::unique_lock lock{mutex};
+    idle_cv.wait(lock, [this] { return queue.empty() && !busy; });
+}
+
+void BackgroundCompiler::WorkerLoop() {
+    std::unique_lock lock{mutex};
+    while (true) {
+        work_cv.wait(lock, [this] { return stop || !queue.empty(); });
+        if (stop) {
+            return;
+        }
+
+        const IR::LocationDescriptor location = queue.front();
+        queue.pop_front();
+        const u64 start_epoch = epoch;
+        busy = true;
+
+        lock.unlock();
+        IR::Block block = compile(location);
+        lock.lock();
+
+        busy = false;
+        if (epoch == start_epoch) {
+            compiled.push_back(std::move(block));
+            has_compiled.store(true, std::memory_order_release);
+        } else {
+            // Guest code changed while this block was being translated
+            queue.push_back(location);
+        }
+        if (queue.empty()) {
+            idle_cv.notify_all();
+        }
+    }
+}
+
+}  // namespace Dynarmic::Backend
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ankerl/unordered_dense.h>
+
+#include "dynarmic/common/common_types.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/location_descriptor.h"
+
+namespace Dynarmic::Backend {
+
+/// Retranslates hot blocks on a worker thread so the thread running guest code only has to
+/// emit them. Compiled blocks are handed back through TakeCompiled and must be installed by
+/// the owning Jit, as emitted code can only be modified from the thread that runs it.
+class BackgroundCompiler final {
+public:
+    using CompileFunction = std::function<IR::Block(IR::LocationDescriptor)>;
+
+    explicit BackgroundCompiler(CompileFunction compile);
+    ~BackgroundCompiler();
+
+    BackgroundCompiler(const BackgroundCompiler&) = delete;
+    BackgroundCompiler& operator=(const BackgroundCompiler&) = delete;
+
+    /// Queues location for compilation. Locations that are queued, being compiled or waiting to
+    /// be taken are ignored.
+    void Enqueue(IR::LocationDescriptor location);
+
+    /// Cheap check for whether TakeCompiled would return anything.
+    bool HasCompiled() const {
+        return has_compiled.load(std::memory_order_acquire);
+    }
+
+    /// Returns the blocks compiled since the last call.
+    std::vector<IR::Block> TakeCompiled();
+
+    /// Must be called when guest code may have changed. Blocks compiled from the old code are
+    /// dropped and their locations compiled again.
+    void Invalidate();
+
+    /// Blocks until every queued location has been compiled.
+    void WaitForIdle();
+
+private:
+    void WorkerLoop();
+
+    CompileFunction compile;
+
+    mutable std::mutex mutex;
+    std::condition_variable work_cv;
+    std::condition_variable idle_cv;
+    std::deque<IR::LocationDescriptor> queue;
+    std::vector<IR::Block> compiled;
+    ankerl::unordered_dense::set<IR::LocationDescriptor> requested;
+    u64 epoch = 0;
+    bool busy = false;
+    bool stop = false;
+    std::atomic<bool> has_compiled = false;
+
+    std::thread worker;
+};
+
+}  // namespace Dynarmic::Backend
@@ -68,7 +68,7 @@ A64EmitX64::A64EmitX64(BlockOfCode& code, A64::UserConfig conf, A64::Jit* jit_in
 
 A64EmitX64::~A64EmitX64() = default;
 
-A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) noexcept {
+A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block, bool profile) noexcept {
     if (conf.very_verbose_debugging_output) [[unlikely]] {
         std::puts(IR::DumpBlock(block).c_str());
     }
@@ -96,6 +96,10 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) noexcept {
     code.align();
     const auto* const entrypoint = code.getCurr();
 
+    if (profile) {
+        EmitExecutionCounter(ctx);
+    }
+
     DEBUG_ASSERT(block.GetCondition() == IR::Cond::AL);
     typedef void (EmitX64::*EmitHandlerFn)(EmitContext& context, IR::Inst* inst);
     constexpr EmitHandlerFn opcode_handlers[] = {
@@ -170,11 +174,17 @@ finish_this_inst:
     return RegisterBlock(descriptor, entrypoint, size);
 }
 
+void A64EmitX64::SetHotBlockCallback(HotBlockCallback callback, void* arg) {
+    hot_block_callback = callback;
+    hot_block_callback_arg = arg;
+}
+
 void A64EmitX64::ClearCache() {
     EmitX64::ClearCache();
     block_ranges.ClearCache();
     ClearFastDispatchTable();
     fastmem_patch_info.clear();
+    execution_counters.clear();
 }
 
 void A64EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges) {
@@ -256,6 +266,30 @@ void A64EmitX64::GenTerminalHandlers() {
     }
 }
 
+void A64EmitX64::EmitExecutionCounter(A64EmitContext& ctx) {
+    ASSERT(hot_block_callback && conf.tiered_compilation_threshold != 0);
+
+    // Counters must outlive the code referencing them, std::deque never moves its elements.
+    u32& counter = execution_counters.emplace_back(conf.tiered_compilation_threshold);
+    SharedLabel hot = GenSharedLabel(), end = GenSharedLabel();
+
+    // No guest state is held in host registers on block entry.
+    code.mov(rax, reinterpret_cast<u64>(&counter));
+    code.sub(dword[rax], 1);
+    code.jz(*hot, code.T_NEAR);
+    code.L(*end);
+
+    ctx.deferred_emits.emplace_back([this, hot, end, location = ctx.block.Location().Value()] {
+        code.L(*hot);
+        code.SwitchMxcsrOnExit();
+        code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(hot_block_callback_arg));
+        code.mov(code.ABI_PARAM2, location);
+        code.CallFunction(hot_block_callback);
+        code.SwitchMxcsrOnEntry();
+        code.jmp(*end, code.T_NEAR);
+    });
+}
+
 void A64EmitX64::EmitPushRSB(EmitContext& ctx, IR::Inst* inst) {
     if (!conf.HasOptimization(OptimizationFlag::ReturnStackBuffer)) {
         return;
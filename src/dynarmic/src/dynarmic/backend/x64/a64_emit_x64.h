@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2016 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -6,6 +9,7 @@
 #pragma once
 
 #include <array>
+#include <deque>
 #include <map>
 #include <optional>
 #include <tuple>
@@ -43,8 +47,13 @@ public:
     ~A64EmitX64() override;
 
     /// Emit host machine code for a basic block with intermediate representation `block`.
+    /// If `profile` is set the block counts its executions and reports its location to the
+    /// hot block callback after conf.tiered_compilation_threshold runs.
     /// @note block is modified.
-    BlockDescriptor Emit(IR::Block& block) noexcept;
+    BlockDescriptor Emit(IR::Block& block, bool profile = false) noexcept;
+
+    using HotBlockCallback = void (*)(void* arg, u64 location_descriptor);
+    void SetHotBlockCallback(HotBlockCallback callback, void* arg);
 
     void ClearCache() override;
 
@@ -63,6 +72,7 @@ protected:
     void GenMemory128Accessors();
     void GenFastmemFallbacks();
     void GenTerminalHandlers();
+    void EmitExecutionCounter(A64EmitContext& ctx);
 
     // Microinstruction emitters
     void EmitPushRSB(EmitContext& ctx, IR::Inst* inst);
@@ -135,6 +145,9 @@ protected:
     const void* terminal_handler_fast_dispatch_hint = nullptr;
     FastDispatchEntry& (*fast_dispatch_table_lookup)(u64) = nullptr;
     A64::Jit* jit_interface = nullptr;
+    std::deque<u32> execution_counters;
+    HotBlockCallback hot_block_callback = nullptr;
+    void* hot_block_callback_arg = nullptr;
     void (*memory_read_128)() = nullptr;
     void (*memory_write_128)() = nullptr;
     void (*memory_exclusive_write_128)() = nullptr;
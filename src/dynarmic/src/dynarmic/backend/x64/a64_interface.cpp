@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 /* This file is part of the dynarmic project.
@@ -15,6 +15,8 @@
 #include <mcl/bit_cast.hpp>
 #include <mcl/scope_exit.hpp>
 
+#include "dynarmic/backend/a64_translation_cache.h"
+#include "dynarmic/backend/background_compiler.h"
 #include "dynarmic/backend/x64/a64_emit_x64.h"
 #include "dynarmic/backend/x64/a64_jitstate.h"
 #include "dynarmic/backend/x64/block_of_code.h"
@@ -58,14 +60,26 @@ static Optimization::PolyfillOptions GenPolyfillOptions(const BlockOfCode& code)
     };
 }
 
+/// Distinguishes IR produced for this backend in a shared TranslationCache.
+static u64 GenTranslationBackendOptions(const Optimization::PolyfillOptions& polyfill) {
+    return (1 << 8) | (u64(polyfill.sha256) << 0) | (u64(polyfill.vector_multiply_widen) << 1);
+}
+
 struct Jit::Impl final {
 public:
     Impl(Jit* jit, UserConfig conf)
             : conf(conf)
             , block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this, conf), JitStateInfo{jit_state}, conf.code_cache_size, GenRCP(conf))
             , emitter(block_of_code, conf, jit)
-            , polyfill_options(GenPolyfillOptions(block_of_code)) {
+            , polyfill_options(GenPolyfillOptions(block_of_code))
+            , translation_config_hash(TranslationConfigHash(conf, GenTranslationBackendOptions(polyfill_options))) {
         ASSERT(conf.page_table_address_space_bits >= 12 && conf.page_table_address_space_bits <= 64);
+        if (conf.tiered_compilation_threshold != 0) {
+            background_compiler = std::make_unique<Backend::BackgroundCompiler>([this](IR::LocationDescriptor location) {
+                return CompileOptimizedBlock(location);
+            });
+            emitter.SetHotBlockCallback(&OnHotBlockThunk, this);
+        }
     }
 
     ~Impl() = default;
@@ -73,6 +87,7 @@ public:
     HaltReason Run() {
         ASSERT(!is_executing);
         PerformRequestedCacheInvalidation(static_cast<HaltReason>(Atomic::Load(&jit_state.halt_reason)));
+        InstallCompiledBlocks();
 
         is_executing = true;
         SCOPE_EXIT {
@@ -122,6 +137,9 @@ public:
     }
 
     void InvalidateCacheRange(u64 start_address, size_t length) {
+        if (conf.translation_cache) {
+            conf.translation_cache->GetImpl().InvalidateCacheRange(start_address, length);
+        }
         std::unique_lock lock{invalidation_mutex};
         const auto end_address = static_cast<u64>(start_address + length - 1);
         const auto range = boost::icl::discrete_interval<u64>::closed(start_address, end_address);
@@ -259,11 +277,19 @@ private:
         return GetBlock(A64::LocationDescriptor{GetCurrentLocation()}.SetSingleStepping(true));
     }
 
+    static void OnHotBlockThunk(void* thisptr, u64 location) {
+        Jit::Impl* this_ = static_cast<Jit::Impl*>(thisptr);
+        this_->background_compiler->Enqueue(IR::LocationDescriptor{location});
+    }
+
+    static constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
+
     CodePtr GetBlock(IR::LocationDescriptor current_location) {
+        InstallCompiledBlocks();
+
         if (auto block = emitter.GetBasicBlock(current_location))
             return block->entrypoint;
 
-        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
         if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
             // Immediately evacuate cache
             invalidate_entire_cache = true;
@@ -272,12 +298,37 @@ private:
         block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
 
         // JIT Compile
+        if (conf.translation_cache) {
+            if (auto cached_block = conf.translation_cache->GetImpl().Find(current_location, translation_config_hash, conf.callbacks)) {
+                Optimization::VerificationPass(*cached_block);
+                return emitter.Emit(*cached_block).entrypoint;
+            }
+        }
+        if (background_compiler && !A64::LocationDescriptor{current_location}.SingleStepping()) {
+            // Tier 0: emit quickly, the block is optimized in the background once it is hot
+            IR::Block ir_block = TranslateBlock(current_location);
+            Optimization::VerificationPass(ir_block);
+            return emitter.Emit(ir_block, true).entrypoint;
+        }
+        IR::Block ir_block = CompileOptimizedBlock(current_location);
+        return emitter.Emit(ir_block).entrypoint;
+    }
+
+    /// Translates a block and runs the passes required for it to be emitted.
+    IR::Block TranslateBlock(IR::LocationDescriptor location) const {
         const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
-        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code,
-                                            {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
+        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{location}, get_code, A64::GenTranslationOptions(conf));
         Optimization::PolyfillPass(ir_block, polyfill_options);
         Optimization::A64CallbackConfigPass(ir_block, conf);
+        // Names are stable across tiers as both run the same passes up to here.
         Optimization::NamingPass(ir_block);
+        return ir_block;
+    }
+
+    /// Translates and fully optimizes a block. Called from the background compiler thread
+    /// when tiered compilation is enabled.
+    IR::Block CompileOptimizedBlock(IR::LocationDescriptor location) const {
+        IR::Block ir_block = TranslateBlock(location);
         if (conf.HasOptimization(OptimizationFlag::GetSetElimination) && !conf.check_halt_on_memory_access) {
             Optimization::A64GetSetElimination(ir_block);
             Optimization::DeadCodeElimination(ir_block);
@@ -290,7 +341,27 @@ private:
             Optimization::A64MergeInterpretBlocksPass(ir_block, conf.callbacks);
         }
         Optimization::VerificationPass(ir_block);
-        return emitter.Emit(ir_block).entrypoint;
+        if (conf.translation_cache) {
+            conf.translation_cache->GetImpl().Insert(ir_block, translation_config_hash, conf.callbacks);
+        }
+        return ir_block;
+    }
+
+    /// Replaces tier 0 blocks with their optimized versions. Links to the old code are
+    /// repointed, stale RSB entries still point at the old code which remains valid.
+    void InstallCompiledBlocks() {
+        if (!background_compiler || !background_compiler->HasCompiled()) {
+            return;
+        }
+        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
+            // Installed once the cache has been evacuated
+            return;
+        }
+        for (IR::Block& ir_block : background_compiler->TakeCompiled()) {
+            block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
+            emitter.InvalidateBasicBlocks({ir_block.Location()});
+            emitter.Emit(ir_block);
+        }
     }
 
     void PerformRequestedCacheInvalidation(HaltReason hr) {
@@ -304,6 +375,9 @@ private:
             }
 
             jit_state.ResetRSB();
+            if (background_compiler) {
+                background_compiler->Invalidate();
+            }
             if (invalidate_entire_cache) {
                 block_of_code.ClearCache();
                 emitter.ClearCache();
@@ -322,10 +396,14 @@ private:
     BlockOfCode block_of_code;
     A64EmitX64 emitter;
     Optimization::PolyfillOptions polyfill_options;
+    const u64 translation_config_hash;
 
     bool invalidate_entire_cache = false;
     boost::icl::interval_set<u64> invalid_cache_ranges;
     std::mutex invalidation_mutex;
+
+    // Destroyed first, its worker uses the members above.
+    std::unique_ptr<Backend::BackgroundCompiler> background_compiler;
 };
 
 Jit::Jit(UserConfig conf)
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2018 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -5,20 +8,33 @@
 
 #include "dynarmic/frontend/A64/translate/a64_translate.h"
 
+#include <algorithm>
+
 #include "dynarmic/frontend/A64/a64_location_descriptor.h"
 #include "dynarmic/frontend/A64/decoder/a64.h"
 #include "dynarmic/frontend/A64/translate/impl/impl.h"
+#include "dynarmic/interface/A64/config.h"
 #include "dynarmic/ir/basic_block.h"
 #include "dynarmic/ir/terminal.h"
 
 namespace Dynarmic::A64 {
 
+TranslationOptions GenTranslationOptions(const UserConfig& conf) {
+    return TranslationOptions{
+        .define_unpredictable_behaviour = conf.define_unpredictable_behaviour,
+        .wall_clock_cntpct = conf.wall_clock_cntpct,
+        .max_followed_branches = conf.HasOptimization(OptimizationFlag::TraceFormation) ? TranslationOptions::trace_formation_branch_limit : 0,
+    };
+}
+
 IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, TranslationOptions options) {
     const bool single_step = descriptor.SingleStepping();
 
     IR::Block block{descriptor};
     TranslatorVisitor visitor{block, descriptor, std::move(options)};
 
+    // Followed backward branches can end translation before the furthest instruction
+    u64 end_pc = descriptor.PC();
     bool should_continue = true;
     do {
         const u64 pc = visitor.ir.current_location->PC();
@@ -33,7 +49,13 @@ IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory
             should_continue = visitor.RaiseException(Exception::NoExecuteFault);
         }
 
-        visitor.ir.current_location = visitor.ir.current_location->AdvancePC(4);
+        if (visitor.trace_next_pc) {
+            visitor.ir.current_location = visitor.ir.current_location->SetPC(*visitor.trace_next_pc);
+            visitor.trace_next_pc.reset();
+        } else {
+            visitor.ir.current_location = visitor.ir.current_location->AdvancePC(4);
+        }
+        end_pc = std::max(end_pc, pc + 4);
         block.CycleCount()++;
     } while (should_continue && !single_step);
 
@@ -43,7 +65,7 @@ IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory
 
     ASSERT_MSG(block.HasTerminal(), "Terminal has not been set");
 
-    block.SetEndLocation(*visitor.ir.current_location);
+    block.SetEndLocation(visitor.ir.current_location->SetPC(std::max(end_pc, visitor.ir.current_location->PC())));
 
     return block;
 }
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 /* This file is part of the dynarmic project.
@@ -21,6 +21,7 @@ class Block;
 namespace A64 {
 
 class LocationDescriptor;
+struct UserConfig;
 
 using MemoryReadCodeFuncType = std::function<std::optional<u32>(u64 vaddr)>;
 
@@ -38,8 +39,20 @@ struct TranslationOptions {
     /// If this is false, we treat the instruction as a NOP.
     /// If this is true, we emit an ExceptionRaised instruction.
     bool hook_hint_instructions = true;
+
+    /// Maximum number of unconditional direct branches (B, BL) per block whose targets are
+    /// translated into the same block instead of ending it. Only short forward branches and
+    /// backward branches into the block are followed, so the block still covers one contiguous
+    /// range of guest code.
+    size_t max_followed_branches = 0;
+
+    /// Value of max_followed_branches used when OptimizationFlag::TraceFormation is enabled.
+    static constexpr size_t trace_formation_branch_limit = 4;
 };
 
+/// Translation options used by the backends for a JIT with the given configuration.
+TranslationOptions GenTranslationOptions(const UserConfig& conf);
+
 /**
  * This function translates instructions in memory into our intermediate representation.
  * @param descriptor The starting location of the basic block. Includes information like PC, FPCR state, &c.
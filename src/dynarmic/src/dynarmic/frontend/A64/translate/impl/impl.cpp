@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2018 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -13,6 +16,27 @@
 
 namespace Dynarmic::A64 {
 
+/// Furthest a followed branch may skip ahead. Skipped code is still part of the block's range.
+constexpr u64 MAX_FOLLOWED_BRANCH_DISTANCE = 512;
+
+bool TranslatorVisitor::FollowBranch(u64 target) {
+    const u64 pc = ir.PC();
+    if (followed_branches >= options.max_followed_branches || ir.current_location->SingleStepping()) {
+        return false;
+    }
+    // The block must keep covering one contiguous range, so backward targets have to be code the
+    // block already covers. Such loops are unrolled at most max_followed_branches times.
+    const u64 block_start = LocationDescriptor{ir.block.Location()}.PC();
+    const bool is_forward = target > pc && target - pc <= MAX_FOLLOWED_BRANCH_DISTANCE;
+    const bool is_backward = target >= block_start && target < pc;
+    if (!is_forward && !is_backward) {
+        return false;
+    }
+    ++followed_branches;
+    trace_next_pc = target;
+    return true;
+}
+
 bool TranslatorVisitor::InterpretThisInstruction() {
     ir.SetTerm(IR::Term::Interpret(*ir.current_location));
     return false;
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2018 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -24,6 +27,14 @@ struct TranslatorVisitor final {
     A64::IREmitter ir;
     TranslationOptions options;
 
+    /// Where translation continues after a followed branch.
+    std::optional<u64> trace_next_pc;
+    size_t followed_branches = 0;
+
+    /// Returns true if translation may continue at the target of a direct branch at the
+    /// current location, in which case the caller must not set a terminal.
+    bool FollowBranch(u64 target);
+
     bool InterpretThisInstruction();
     bool UnpredictableInstruction();
     bool DecodeError();
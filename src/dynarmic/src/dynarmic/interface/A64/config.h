@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2018 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -17,6 +20,10 @@ namespace Dynarmic {
 class ExclusiveMonitor;
 }  // namespace Dynarmic
 
+namespace Dynarmic::A64 {
+class TranslationCache;
+}  // namespace Dynarmic::A64
+
 namespace Dynarmic {
 namespace A64 {
 
@@ -147,6 +154,10 @@ struct UserConfig {
 
     ExclusiveMonitor* global_monitor = nullptr;
 
+    /// Optional store of translated blocks that may be shared between Jits and persisted.
+    /// Blocks are looked up here before translating guest code and inserted after.
+    TranslationCache* translation_cache = nullptr;
+
     /// Pointer to where TPIDRRO_EL0 is stored. This pointer will be inserted into
     /// emitted code.
     const std::uint64_t* tpidrro_el0 = nullptr;
@@ -203,6 +214,13 @@ struct UserConfig {
     // Maximum size is limited by the maximum length of a x86_64 / arm64 jump.
     std::uint32_t code_cache_size = 128 * 1024 * 1024;  // bytes
 
+    /// Enables tiered compilation when non-zero. Blocks are first emitted without the IR
+    /// optimization passes and count their executions. Once a block has run this many times
+    /// it is retranslated with every enabled optimization on a background thread and the new
+    /// code replaces the old one. MemoryReadCode must be safe to call from any thread if this
+    /// is enabled. Currently only implemented by the x64 backend.
+    std::uint32_t tiered_compilation_threshold = 0;
+
     /// Determines if we should detect memory accesses via page_table that straddle are
     /// misaligned. Accesses that straddle page boundaries will fallback to the relevant
     /// memory callback.
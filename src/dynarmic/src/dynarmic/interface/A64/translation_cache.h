@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Dynarmic {
+namespace A64 {
+
+/**
+ * Stores optimized IR for translated basic blocks so it can outlive a Jit instance.
+ *
+ * Jits that point to the same cache through UserConfig::translation_cache share its
+ * blocks. The contents can be serialized to disk and restored on a later run to skip
+ * decoding and optimizing guest code again. A cached block is only reused when the guest
+ * code it was translated from is byte-identical and the Jit configuration produces the
+ * same IR, so stale data is harmless.
+ *
+ * All member functions are thread-safe.
+ */
+class TranslationCache final {
+public:
+    TranslationCache();
+    ~TranslationCache();
+
+    TranslationCache(const TranslationCache&) = delete;
+    TranslationCache& operator=(const TranslationCache&) = delete;
+
+    /**
+     * Replaces the contents of the cache with data produced by Serialize.
+     * @return false if the data was produced by an incompatible version or is corrupted, in
+     *         which case the cache is left empty.
+     */
+    bool Deserialize(std::span<const std::uint8_t> data);
+
+    /// Serializes the contents of the cache.
+    std::vector<std::uint8_t> Serialize() const;
+
+    /// Discards all blocks.
+    void Clear();
+
+    /// Number of cached blocks.
+    std::size_t Size() const;
+
+    /// Internal use only
+    struct Impl;
+    Impl& GetImpl() {
+        return *impl;
+    }
+
+private:
+    std::unique_ptr<Impl> impl;
+};
+
+}  // namespace A64
+}  // namespace Dynarmic
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2020 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -34,6 +37,11 @@ enum class OptimizationFlag : std::uint32_t {
     MiscIROpt = 0x00000020,
     /// Optimize for code speed rather than for code size (this serves well for tight loops)
     CodeSpeed = 0x00000040,
+    /// This is an IR optimization. Translation continues through short unconditional branches
+    /// that keep the block contiguous, so a single block covers several guest basic blocks and
+    /// the other IR optimizations see across them. Currently only affects the A64 frontend.
+    /// This is a safe optimization, but it is opt-in and not part of all_safe_optimizations.
+    TraceFormation = 0x00000080,
 
     /// This is an UNSAFE optimization that reduces accuracy of fused multiply-add operations.
     /// This unfuses fused instructions to improve performance on host CPUs without FMA support.
@@ -54,7 +62,7 @@ enum class OptimizationFlag : std::uint32_t {
 };
 
 constexpr OptimizationFlag no_optimizations = static_cast<OptimizationFlag>(0);
-constexpr OptimizationFlag all_safe_optimizations = static_cast<OptimizationFlag>(0x0000FFFF);
+constexpr OptimizationFlag all_safe_optimizations = static_cast<OptimizationFlag>(0x0000FF7F);
 
 constexpr OptimizationFlag operator~(OptimizationFlag f) {
     return static_cast<OptimizationFlag>(~static_cast<std::uint32_t>(f));
@@ -0,0 +1,474 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dynarmic/ir/serialization.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include <ankerl/unordered_dense.h>
+
+#include "dynarmic/common/variant_util.h"
+#include "dynarmic/frontend/A32/a32_types.h"
+#include "dynarmic/frontend/A64/a64_types.h"
+#include "dynarmic/ir/acc_type.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/cond.h"
+#include "dynarmic/ir/opcodes.h"
+#include "dynarmic/ir/type.h"
+
+namespace Dynarmic::IR {
+
+namespace {
+
+/// Bumped whenever the encoding below changes.
+constexpr u64 FORMAT_VERSION = 1;
+
+/// Terminals nest through If, CheckBit and CheckHalt; the translator never goes this deep.
+constexpr size_t MAX_TERMINAL_DEPTH = 16;
+
+enum class TerminalTag : u8 {
+    Invalid,
+    Interpret,
+    ReturnToDispatch,
+    LinkBlock,
+    LinkBlockFast,
+    PopRSBHint,
+    FastDispatchHint,
+    If,
+    CheckBit,
+    CheckHalt,
+};
+
+class Writer {
+public:
+    explicit Writer(std::vector<u8>& out_)
+            : out{out_} {}
+
+    template<typename T>
+    void Write(T value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const size_t offset = out.size();
+        out.resize(offset + sizeof(T));
+        std::memcpy(out.data() + offset, &value, sizeof(T));
+    }
+
+private:
+    std::vector<u8>& out;
+};
+
+class Reader {
+public:
+    explicit Reader(std::span<const u8> data_)
+            : data{data_} {}
+
+    template<typename T>
+    bool Read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (data.size() - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    bool AtEnd() const { return offset == data.size(); }
+
+private:
+    std::span<const u8> data;
+    size_t offset = 0;
+};
+
+void WriteTerminal(Writer& writer, const Terminal& terminal) {
+    Common::VisitVariant<void>(terminal, [&writer](const auto& term) {
+        using T = std::decay_t<decltype(term)>;
+        if constexpr (std::is_same_v<T, Term::Invalid>) {
+            writer.Write(TerminalTag::Invalid);
+        } else if constexpr (std::is_same_v<T, Term::Interpret>) {
+            writer.Write(TerminalTag::Interpret);
+            writer.Write(term.next.Value());
+            writer.Write(static_cast<u64>(term.num_instructions));
+        } else if constexpr (std::is_same_v<T, Term::ReturnToDispatch>) {
+            writer.Write(TerminalTag::ReturnToDispatch);
+        } else if constexpr (std::is_same_v<T, Term::LinkBlock>) {
+            writer.Write(TerminalTag::LinkBlock);
+            writer.Write(term.next.Value());
+        } else if constexpr (std::is_same_v<T, Term::LinkBlockFast>) {
+            writer.Write(TerminalTag::LinkBlockFast);
+            writer.Write(term.next.Value());
+        } else if constexpr (std::is_same_v<T, Term::PopRSBHint>) {
+            writer.Write(TerminalTag::PopRSBHint);
+        } else if constexpr (std::is_same_v<T, Term::FastDispatchHint>) {
+            writer.Write(TerminalTag::FastDispatchHint);
+        } else if constexpr (std::is_same_v<T, Term::If>) {
+            writer.Write(TerminalTag::If);
+            writer.Write(static_cast<u8>(term.if_));
+            WriteTerminal(writer, term.then_);
+            WriteTerminal(writer, term.else_);
+        } else if constexpr (std::is_same_v<T, Term::CheckBit>) {
+            writer.Write(TerminalTag::CheckBit);
+            WriteTerminal(writer, term.then_);
+            WriteTerminal(writer, term.else_);
+        } else {
+            static_assert(std::is_same_v<T, Term::CheckHalt>);
+            writer.Write(TerminalTag::CheckHalt);
+            WriteTerminal(writer, term.else_);
+        }
+    });
+}
+
+std::optional<Terminal> ReadTerminal(Reader& reader, size_t depth) {
+    TerminalTag tag;
+    if (depth > MAX_TERMINAL_DEPTH || !reader.Read(tag)) {
+        return std::nullopt;
+    }
+    u64 next;
+    switch (tag) {
+    case TerminalTag::Invalid:
+        return Term::Invalid{};
+    case TerminalTag::Interpret: {
+        u64 num_instructions;
+        if (!reader.Read(next) || !reader.Read(num_instructions)) {
+            return std::nullopt;
+        }
+        Term::Interpret term{LocationDescriptor{next}};
+        term.num_instructions = static_cast<size_t>(num_instructions);
+        return term;
+    }
+    case TerminalTag::ReturnToDispatch:
+        return Term::ReturnToDispatch{};
+    case TerminalTag::LinkBlock:
+        if (!reader.Read(next)) {
+            return std::nullopt;
+        }
+        return Term::LinkBlock{LocationDescriptor{next}};
+    case TerminalTag::LinkBlockFast:
+        if (!reader.Read(next)) {
+            return std::nullopt;
+        }
+        return Term::LinkBlockFast{LocationDescriptor{next}};
+    case TerminalTag::PopRSBHint:
+        return Term::PopRSBHint{};
+    case TerminalTag::FastDispatchHint:
+        return Term::FastDispatchHint{};
+    case TerminalTag::If: {
+        u8 cond;
+        if (!reader.Read(cond) || cond > static_cast<u8>(Cond::NV)) {
+            return std::nullopt;
+        }
+        auto then_ = ReadTerminal(reader, depth + 1);
+        if (!then_) {
+            return std::nullopt;
+        }
+        auto else_ = ReadTerminal(reader, depth + 1);
+        if (!else_) {
+            return std::nullopt;
+        }
+        return Term::If{static_cast<Cond>(cond), std::move(*then_), std::move(*else_)};
+    }
+    case TerminalTag::CheckBit: {
+        auto then_ = ReadTerminal(reader, depth + 1);
+        if (!then_) {
+            return std::nullopt;
+        }
+        auto else_ = ReadTerminal(reader, depth + 1);
+        if (!else_) {
+            return std::nullopt;
+        }
+        return Term::CheckBit{std::move(*then_), std::move(*else_)};
+    }
+    case TerminalTag::CheckHalt: {
+        auto else_ = ReadTerminal(reader, depth + 1);
+        if (!else_) {
+            return std::nullopt;
+        }
+        return Term::CheckHalt{std::move(*else_)};
+    }
+    }
+    return std::nullopt;
+}
+
+void WriteValue(Writer& writer, const Value& value, const ankerl::unordered_dense::map<const Inst*, u32>& indices) {
+    // Identities are kept as references so the instruction indices stay stable
+    if (!value.IsEmpty() && (value.IsIdentity() || !value.IsImmediate())) {
+        writer.Write(Type::Opaque);
+        writer.Write(indices.at(value.GetInst()));
+        return;
+    }
+    const Type type = value.GetType();
+    writer.Write(type);
+    switch (type) {
+    case Type::A32Reg:
+        writer.Write(static_cast<u8>(value.GetA32RegRef()));
+        break;
+    case Type::A32ExtReg:
+        writer.Write(static_cast<u8>(value.GetA32ExtRegRef()));
+        break;
+    case Type::A64Reg:
+        writer.Write(static_cast<u8>(value.GetA64RegRef()));
+        break;
+    case Type::A64Vec:
+        writer.Write(static_cast<u8>(value.GetA64VecRef()));
+        break;
+    case Type::U1:
+        writer.Write(static_cast<u8>(value.GetU1()));
+        break;
+    case Type::U8:
+        writer.Write(value.GetU8());
+        break;
+    case Type::U16:
+        writer.Write(value.GetU16());
+        break;
+    case Type::U32:
+        writer.Write(value.GetU32());
+        break;
+    case Type::U64:
+        writer.Write(value.GetU64());
+        break;
+    case Type::CoprocInfo:
+        writer.Write(value.GetCoprocInfo());
+        break;
+    case Type::Cond:
+        writer.Write(static_cast<u8>(value.GetCond()));
+        break;
+    case Type::AccType:
+        writer.Write(static_cast<u8>(value.GetAccType()));
+        break;
+    default:
+        // Void and the empty NZCV marker carry no payload
+        break;
+    }
+}
+
+std::optional<Value> ReadValue(Reader& reader, std::span<Inst* const> insts) {
+    Type type;
+    if (!reader.Read(type)) {
+        return std::nullopt;
+    }
+    u8 u8_value;
+    const auto read_u8 = [&](u8 limit) {
+        return reader.Read(u8_value) && u8_value <= limit;
+    };
+    switch (type) {
+    case Type::Void:
+        return Value{};
+    case Type::Opaque: {
+        u32 index;
+        if (!reader.Read(index) || index >= insts.size()) {
+            return std::nullopt;
+        }
+        return Value{insts[index]};
+    }
+    case Type::A32Reg:
+        if (!read_u8(static_cast<u8>(A32::Reg::INVALID_REG))) {
+            return std::nullopt;
+        }
+        return Value{static_cast<A32::Reg>(u8_value)};
+    case Type::A32ExtReg:
+        if (!read_u8(static_cast<u8>(A32::ExtReg::Q15))) {
+            return std::nullopt;
+        }
+        return Value{static_cast<A32::ExtReg>(u8_value)};
+    case Type::A64Reg:
+        if (!read_u8(static_cast<u8>(A64::Reg::R31))) {
+            return std::nullopt;
+        }
+        return Value{static_cast<A64::Reg>(u8_value)};
+    case Type::A64Vec:
+        if (!read_u8(static_cast<u8>(A64::Vec::V31))) {
+            return std::nullopt;
+        }
+        return Value{static_cast<A64::Vec>(u8_value)};
+    case Type::U1:
+        if (!read_u8(1)) {
+            return std::nullopt;
+        }
+        return Value{u8_value != 0};
+    case Type::U8:
+        if (!reader.Read(u8_value)) {
+            return std::nullopt;
+        }
+        return Value{u8_value};
+    case Type::U16: {
+        u16 imm;
+        if (!reader.Read(imm)) {
+            return std::nullopt;
+        }
+        return Value{imm};
+    }
+    case Type::U32: {
+        u32 imm;
+        if (!reader.Read(imm)) {
+            return std::nullopt;
+        }
+        return Value{imm};
+    }
+    case Type::U64: {
+        u64 imm;
+        if (!reader.Read(imm)) {
+            return std::nullopt;
+        }
+        return Value{imm};
+    }
+    case Type::CoprocInfo: {
+        Value::CoprocessorInfo info;
+        if (!reader.Read(info)) {
+            return std::nullopt;
+        }
+        return Value{info};
+    }
+    case Type::NZCVFlags:
+        return Value::EmptyNZCVImmediateMarker();
+    case Type::Cond:
+        if (!read_u8(static_cast<u8>(Cond::NV))) {
+            return std::nullopt;
+        }
+        return Value{static_cast<Cond>(u8_value)};
+    case Type::AccType:
+        if (!reader.Read(u8_value)) {
+            return std::nullopt;
+        }
+        return Value{static_cast<AccType>(u8_value)};
+    default:
+        return std::nullopt;
+    }
+}
+
+}  // Anonymous namespace
+
+void SerializeBlock(const Block& block, std::vector<u8>& out) {
+    Writer writer{out};
+    writer.Write(block.Location().Value());
+    writer.Write(block.EndLocation().Value());
+    writer.Write(static_cast<u8>(block.GetCondition()));
+    writer.Write(static_cast<u8>(block.HasConditionFailedLocation()));
+    if (block.HasConditionFailedLocation()) {
+        writer.Write(block.ConditionFailedLocation().Value());
+    }
+    writer.Write(static_cast<u64>(block.ConditionFailedCycleCount()));
+    writer.Write(static_cast<u64>(block.CycleCount()));
+
+    ankerl::unordered_dense::map<const Inst*, u32> indices;
+    indices.reserve(block.size());
+    writer.Write(static_cast<u32>(block.size()));
+    for (const Inst& inst : block) {
+        const Opcode op = inst.GetOpcode();
+        writer.Write(static_cast<u16>(op));
+        writer.Write(static_cast<u32>(inst.GetName()));
+        for (size_t i = 0; i < inst.NumArgs(); ++i) {
+            WriteValue(writer, inst.GetArg(i), indices);
+        }
+        indices.emplace(&inst, static_cast<u32>(indices.size()));
+    }
+    WriteTerminal(writer, block.GetTerminal());
+}
+
+std::optional<Block> DeserializeBlock(std::span<const u8> data) {
+    Reader reader{data};
+    u64 location, end_location, cond_failed_location = 0, cond_failed_cycle_count, cycle_count;
+    u8 cond, has_cond_failed;
+    u32 num_insts;
+    if (!reader.Read(location) || !reader.Read(end_location) || !reader.Read(cond)
+        || cond > static_cast<u8>(Cond::NV) || !reader.Read(has_cond_failed)
+        || (has_cond_failed && !reader.Read(cond_failed_location))
+        || !reader.Read(cond_failed_cycle_count) || !reader.Read(cycle_count)
+        || !reader.Read(num_insts)) {
+        return std::nullopt;
+    }
+
+    Block block{LocationDescriptor{location}};
+    block.SetEndLocation(LocationDescriptor{end_location});
+    block.SetCondition(static_cast<Cond>(cond));
+    if (has_cond_failed) {
+        block.SetConditionFailedLocation(LocationDescriptor{cond_failed_location});
+    }
+    block.ConditionFailedCycleCount() = static_cast<size_t>(cond_failed_cycle_count);
+    block.CycleCount() = static_cast<size_t>(cycle_count);
+
+    std::vector<Inst*> insts;
+    // Every instruction takes at least its opcode and name, don't trust num_insts beyond that
+    insts.reserve((std::min)(size_t{num_insts}, data.size() / (sizeof(u16) + sizeof(u32))));
+    for (u32 index = 0; index < num_insts; ++index) {
+        u16 raw_op;
+        u32 name;
+        if (!reader.Read(raw_op) || raw_op >= OpcodeCount || !reader.Read(name)) {
+            return std::nullopt;
+        }
+        const Opcode op = static_cast<Opcode>(raw_op);
+        const size_t num_args = GetNumArgsOf(op);
+        std::array<Value, 4> args{};
+        if (num_args > args.size()) {
+            return std::nullopt;
+        }
+        for (size_t i = 0; i < num_args; ++i) {
+            const std::optional<Value> arg = ReadValue(reader, insts);
+            if (!arg || !AreTypesCompatible(arg->GetType(), GetArgTypeOf(op, i))) {
+                return std::nullopt;
+            }
+            args[i] = *arg;
+        }
+        // Preconditions asserted by Inst::Use
+        if (IsAPseudoOperation(op)) {
+            if (num_args == 0 || args[0].IsImmediate()) {
+                return std::nullopt;
+            }
+            if (op == Opcode::GetNZCVFromOp && !MayGetNZCVFromOp(args[0].GetInst()->GetOpcode())) {
+                return std::nullopt;
+            }
+        }
+        switch (num_args) {
+        case 0:
+            block.AppendNewInst(op, {});
+            break;
+        case 1:
+            block.AppendNewInst(op, {args[0]});
+            break;
+        case 2:
+            block.AppendNewInst(op, {args[0], args[1]});
+            break;
+        case 3:
+            block.AppendNewInst(op, {args[0], args[1], args[2]});
+            break;
+        default:
+            block.AppendNewInst(op, {args[0], args[1], args[2], args[3]});
+            break;
+        }
+        block.back().SetName(name);
+        insts.push_back(&block.back());
+    }
+
+    std::optional<Terminal> terminal = ReadTerminal(reader, 0);
+    if (!terminal || !reader.AtEnd()) {
+        return std::nullopt;
+    }
+    block.SetTerminal(std::move(*terminal));
+    return block;
+}
+
+u64 SerializationFingerprint() {
+    // FNV-1a over everything the encoding depends on
+    u64 hash = 0xcbf29ce484222325ULL;
+    const auto mix = [&hash](u64 value) {
+        for (size_t i = 0; i < sizeof(value); ++i) {
+            hash = (hash ^ ((value >> (i * 8)) & 0xFF)) * 0x100000001b3ULL;
+        }
+    };
+    mix(FORMAT_VERSION);
+    mix(OpcodeCount);
+    for (size_t i = 0; i < OpcodeCount; ++i) {
+        const Opcode op = static_cast<Opcode>(i);
+        for (const char c : GetNameOf(op)) {
+            mix(static_cast<u8>(c));
+        }
+        mix(static_cast<u64>(GetTypeOf(op)));
+        mix(GetNumArgsOf(op));
+        for (size_t arg = 0; arg < GetNumArgsOf(op); ++arg) {
+            mix(static_cast<u64>(GetArgTypeOf(op, arg)));
+        }
+    }
+    return hash;
+}
+
+}  // namespace Dynarmic::IR
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "dynarmic/common/common_types.h"
+
+namespace Dynarmic::IR {
+
+class Block;
+
+/// Appends a self-contained binary representation of block to out.
+/// Instruction names are preserved as backends use them to identify fastmem accesses.
+void SerializeBlock(const Block& block, std::vector<u8>& out);
+
+/// Reconstructs a block serialized by SerializeBlock.
+/// Returns std::nullopt if data is truncated or does not describe a well-formed block.
+std::optional<Block> DeserializeBlock(std::span<const u8> data);
+
+/// Hash of the opcode table, serialized blocks are only valid for the same fingerprint.
+u64 SerializationFingerprint();
+
+}  // namespace Dynarmic::IR
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2018 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -111,3 +114,62 @@ TEST_CASE("ensure fast dispatch entry is cleared even when a block does not have
     CheckedRun([&]() { jit.Run(); });
     REQUIRE(jit.GetRegister(0) == 69);
 }
+
+TEST_CASE("invalidating the target of a followed branch invalidates the trace", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig conf{};
+    conf.callbacks = &env;
+    conf.optimizations |= OptimizationFlag::TraceFormation;
+    A64::Jit jit{conf};
+
+    env.code_mem_start_address = 100;
+    env.code_mem.clear();
+    env.code_mem.emplace_back(0xd2800540);  // MOV X0, 42
+    env.code_mem.emplace_back(0x14000002);  // B 112
+    env.code_mem.emplace_back(0xd28008a0);  // MOV X0, 69
+    env.code_mem.emplace_back(0x91000400);  // ADD X0, X0, 1
+    env.code_mem.emplace_back(0x14000000);  // B .
+
+    jit.SetPC(100);
+    env.ticks_left = 4;
+    CheckedRun([&]() { jit.Run(); });
+    REQUIRE(jit.GetRegister(0) == 43);
+    REQUIRE(jit.GetPC() == 116);
+
+    env.code_mem[3] = 0x91000800;  // ADD X0, X0, 2
+    jit.InvalidateCacheRange(112, 4);
+
+    jit.SetPC(100);
+    env.ticks_left = 4;
+    CheckedRun([&]() { jit.Run(); });
+    REQUIRE(jit.GetRegister(0) == 44);
+}
+
+TEST_CASE("invalidating a backward followed branch invalidates the trace", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig conf{};
+    conf.callbacks = &env;
+    conf.optimizations |= OptimizationFlag::TraceFormation;
+    A64::Jit jit{conf};
+
+    env.code_mem_start_address = 100;
+    env.code_mem.clear();
+    env.code_mem.emplace_back(0xd2800020);  // MOV X0, 1
+    env.code_mem.emplace_back(0x91000400);  // ADD X0, X0, 1
+    env.code_mem.emplace_back(0x17ffffff);  // B 104
+
+    jit.SetPC(100);
+    env.ticks_left = 11;
+    CheckedRun([&]() { jit.Run(); });
+    REQUIRE(jit.GetRegister(0) == 6);
+    REQUIRE(jit.GetPC() == 104);
+
+    env.code_mem[1] = 0x91000800;  // ADD X0, X0, 2
+    jit.InvalidateCacheRange(104, 4);
+
+    jit.SetPC(100);
+    env.ticks_left = 11;
+    CheckedRun([&]() { jit.Run(); });
+    REQUIRE(jit.GetRegister(0) == 11);
+    REQUIRE(jit.GetPC() == 104);
+}
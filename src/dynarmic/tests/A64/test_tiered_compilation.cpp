@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <atomic>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "./testenv.h"
+#include "dynarmic/backend/background_compiler.h"
+#include "dynarmic/interface/A64/a64.h"
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/location_descriptor.h"
+
+using namespace Dynarmic;
+
+TEST_CASE("A64: Tiered compilation matches single tier execution", "[a64]") {
+    A64TestEnv env;
+    env.code_mem_start_address = 100;
+    env.code_mem.clear();
+    env.code_mem.emplace_back(0x91000400);  // ADD X0, X0, #1
+    env.code_mem.emplace_back(0xaa0003e1);  // MOV X1, X0
+    env.code_mem.emplace_back(0x8b010042);  // ADD X2, X2, X1
+    env.code_mem.emplace_back(0x17fffffd);  // B 100
+
+    A64::UserConfig conf{};
+    conf.callbacks = &env;
+    A64::Jit reference{conf};
+    conf.tiered_compilation_threshold = 4;
+    A64::Jit jit{conf};
+
+    reference.SetPC(100);
+    jit.SetPC(100);
+    for (int i = 0; i < 64; ++i) {
+        env.ticks_left = 100;
+        CheckedRun([&]() { reference.Run(); });
+        env.ticks_left = 100;
+        CheckedRun([&]() { jit.Run(); });
+
+        REQUIRE(jit.GetPC() == reference.GetPC());
+        REQUIRE(jit.GetRegisters() == reference.GetRegisters());
+
+        if (i == 32) {
+            // Background results compiled before this point must be recompiled
+            jit.ClearCache();
+        }
+    }
+}
+
+TEST_CASE("A64: Background compiler requests locations again once taken", "[a64]") {
+    std::atomic<int> num_compiles = 0;
+    Backend::BackgroundCompiler compiler{[&](IR::LocationDescriptor location) {
+        ++num_compiles;
+        return IR::Block{location};
+    }};
+    const IR::LocationDescriptor location{100};
+
+    compiler.Enqueue(location);
+    compiler.Enqueue(location);
+    compiler.WaitForIdle();
+    REQUIRE(num_compiles == 1);
+
+    // Waiting to be taken
+    compiler.Enqueue(location);
+    compiler.WaitForIdle();
+    REQUIRE(num_compiles == 1);
+
+    // Results that were not taken yet are compiled again from the new code
+    compiler.Invalidate();
+    compiler.WaitForIdle();
+    REQUIRE(num_compiles == 2);
+    REQUIRE(compiler.TakeCompiled().size() == 1);
+
+    // The installed block was invalidated and emitted at tier 0 again
+    compiler.Invalidate();
+    compiler.Enqueue(location);
+    compiler.WaitForIdle();
+    REQUIRE(num_compiles == 3);
+    REQUIRE(compiler.TakeCompiled().size() == 1);
+}
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "./testenv.h"
+#include "dynarmic/interface/A64/a64.h"
+#include "dynarmic/interface/A64/translation_cache.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+u64 RunWithCache(A64TestEnv& env, A64::TranslationCache& cache) {
+    A64::UserConfig conf{};
+    conf.callbacks = &env;
+    conf.translation_cache = &cache;
+    A64::Jit jit{conf};
+
+    jit.SetPC(100);
+    env.ticks_left = 4;
+    CheckedRun([&]() { jit.Run(); });
+    return jit.GetRegister(0);
+}
+
+}  // Anonymous namespace
+
+TEST_CASE("translation cache: blocks survive serialization", "[a64]") {
+    A64TestEnv env;
+    env.code_mem_start_address = 100;
+    env.code_mem.emplace_back(0xd2800540);  // MOV X0, 42
+    env.code_mem.emplace_back(0x91000400);  // ADD X0, X0, 1
+    env.code_mem.emplace_back(0x14000000);  // B .
+
+    A64::TranslationCache cache;
+    REQUIRE(RunWithCache(env, cache) == 43);
+    REQUIRE(cache.Size() > 0);
+
+    const std::vector<u8> data = cache.Serialize();
+    A64::TranslationCache restored;
+    REQUIRE(restored.Deserialize(data));
+    REQUIRE(restored.Size() == cache.Size());
+    REQUIRE(RunWithCache(env, restored) == 43);
+
+    // Corrupted data is rejected as a whole
+    A64::TranslationCache truncated;
+    REQUIRE(!truncated.Deserialize(std::span{data}.first(data.size() - 1)));
+    REQUIRE(truncated.Size() == 0);
+}
+
+TEST_CASE("translation cache: modified guest code is retranslated", "[a64]") {
+    A64TestEnv env;
+    env.code_mem_start_address = 100;
+    env.code_mem.emplace_back(0xd2800540);  // MOV X0, 42
+    env.code_mem.emplace_back(0x91000400);  // ADD X0, X0, 1
+    env.code_mem.emplace_back(0x14000000);  // B .
+
+    A64::TranslationCache cache;
+    REQUIRE(RunWithCache(env, cache) == 43);
+
+    env.code_mem[0] = 0xd28008a0;  // MOV X0, 69
+    REQUIRE(RunWithCache(env, cache) == 70);
+
+    A64::UserConfig conf{};
+    conf.callbacks = &env;
+    conf.translation_cache = &cache;
+    A64::Jit jit{conf};
+    jit.InvalidateCacheRange(100, 12);
+    REQUIRE(cache.Size() == 0);
+}
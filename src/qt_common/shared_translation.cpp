@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2024 Torzu Emulator Project
@@ -114,6 +114,17 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent)
            tr("设置自定义的 CPU 时钟值。更高的值可能提高性能，"
               "但也可能导致游戏卡顿。建议范围为77-21000。"));
     INSERT(Settings, cpu_backend, tr("Backend:"), QString());
+    INSERT(Settings,
+           cpu_translation_cache,
+           tr("Cache translated CPU code"),
+           tr("Saves the translated guest code to disk next to the shader cache, so later runs of "
+              "the same game spend less time translating it.\nOnly applies to 64-bit games."));
+    INSERT(Settings,
+           cpu_tiered_compilation,
+           tr("Tiered CPU recompilation"),
+           tr("Translates guest code quickly at first and recompiles frequently run code with "
+              "full optimizations on a background thread.\nReduces stutter when new code runs. "
+              "Only applies to 64-bit games on x86-64 hosts."));
 
     // Cpu Debug
 
@@ -303,6 +314,12 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent)
            tr("启用异步着色器编译，"
               "可能会减少着色器卡顿。\n"
               "实验性功能。"));
+    INSERT(Settings,
+           use_asynchronous_texture_decode,
+           tr("启用异步纹理解码 (不稳定)"),
+           tr("在后台线程中对采样纹理进行反重排和格式转换，"
+              "可能会减少纹理加载卡顿。\n"
+              "纹理在解码完成前可能显示为空白。"));
     INSERT(Settings, use_fast_gpu_time, QString(), QString());
     INSERT(Settings,
            fast_gpu_time,
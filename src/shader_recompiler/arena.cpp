@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "common/make_unique_for_overwrite.h"
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/compile_statistics.h"
+
+namespace Shader {
+namespace {
+thread_local Arena* current_arena{};
+} // Anonymous namespace
+
+Arena::Arena(size_t chunk_size) : new_chunk_size{chunk_size} {
+    AddChunk(new_chunk_size);
+}
+
+Arena::~Arena() {
+    RecordStatistics();
+}
+
+void Arena::Reset() {
+    if (chunks.size() > 1) {
+        // Chunks have been filled, squash allocations into a single chunk
+        size_t total_size{};
+        for (const Chunk& chunk : chunks) {
+            total_size += chunk.size;
+        }
+        chunks.clear();
+        AddChunk(total_size);
+        chunks.shrink_to_fit();
+    }
+    used = 0;
+    RecordStatistics();
+}
+
+void* Arena::AllocateSlow(size_t bytes, size_t alignment) {
+    // Allocations larger than a chunk get a chunk of their own
+    AddChunk((std::max)(bytes, new_chunk_size));
+    return Allocate(bytes, alignment);
+}
+
+void Arena::AddChunk(size_t size) {
+    chunks.push_back({
+        .memory = Common::make_unique_for_overwrite<u8[]>(size),
+        .size = size,
+    });
+    used = 0;
+    ++num_chunk_allocations;
+}
+
+void Arena::RecordStatistics() {
+    if (num_allocations == 0) {
+        return;
+    }
+    if (CompileStatistics::IsEnabled()) {
+        CompileStatistics::RecordArena(num_allocations, num_bytes, num_chunk_allocations);
+    }
+    num_allocations = 0;
+    num_bytes = 0;
+    num_chunk_allocations = 0;
+}
+
+Arena* CurrentArena() noexcept {
+    return current_arena;
+}
+
+ArenaScope::ArenaScope(Arena* arena) noexcept : previous{std::exchange(current_arena, arena)} {}
+
+ArenaScope::~ArenaScope() {
+    current_arena = previous;
+}
+
+} // namespace Shader
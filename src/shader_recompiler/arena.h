@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Shader {
+
+/**
+ * Bump allocator for memory that lives as long as the IR of a pipeline build.
+ * Freeing is a no-op, all memory is reclaimed at once by Reset when the pipeline is done. Like
+ * ObjectPool, when the first chunk has been filled the chunks are squashed into a single one, so
+ * builds of a similar size stop allocating new chunks.
+ */
+class Arena {
+public:
+    explicit Arena(size_t chunk_size = 64 * 1024);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// Returns uninitialized memory of the given size, alignment can not exceed max_align_t
+    [[nodiscard]] void* Allocate(size_t bytes, size_t alignment) {
+        const size_t offset{(used + alignment - 1) & ~(alignment - 1)};
+        if (offset + bytes > chunks.back().size) [[unlikely]] {
+            return AllocateSlow(bytes, alignment);
+        }
+        used = offset + bytes;
+        ++num_allocations;
+        num_bytes += bytes;
+        return chunks.back().memory.get() + offset;
+    }
+
+    /// Invalidates all allocations, objects in the arena must have been destroyed
+    void Reset();
+
+private:
+    struct Chunk {
+        std::unique_ptr<u8[]> memory;
+        size_t size{};
+    };
+
+    [[nodiscard]] void* AllocateSlow(size_t bytes, size_t alignment);
+
+    void AddChunk(size_t size);
+
+    /// Records the usage since the last reset in the compile statistics
+    void RecordStatistics();
+
+    std::vector<Chunk> chunks;
+    size_t used{};
+    size_t new_chunk_size;
+    u64 num_allocations{};
+    u64 num_bytes{};
+    u64 num_chunk_allocations{};
+};
+
+/// Returns the arena of the pipeline being built on this thread, or null when there is none
+[[nodiscard]] Arena* CurrentArena() noexcept;
+
+/// Makes an arena the current arena of this thread until the scope ends, null allocates on the
+/// heap instead. Used for IR that must outlive the pipeline that created it.
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena* arena) noexcept;
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    Arena* previous;
+};
+
+/// Allocator of containers used while building a pipeline. Containers take the arena current
+/// when they are constructed and fall back to the heap outside of a pipeline build.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() noexcept : arena{CurrentArena()} {}
+    explicit ArenaAllocator(Arena* arena_) noexcept : arena{arena_} {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& rhs) noexcept : arena{rhs.arena} {}
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+
+    [[nodiscard]] T* allocate(size_t n) {
+        if (!arena) {
+            return std::allocator<T>{}.allocate(n);
+        }
+        return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t n) noexcept {
+        if (!arena) {
+            std::allocator<T>{}.deallocate(pointer, n);
+        }
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const ArenaAllocator<U>& rhs) const noexcept {
+        return arena == rhs.arena;
+    }
+
+private:
+    template <typename>
+    friend class ArenaAllocator;
+
+    Arena* arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using ArenaMap = std::map<Key, T, Compare, ArenaAllocator<std::pair<const Key, T>>>;
+
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using ArenaUnorderedMap =
+    std::unordered_map<Key, T, Hash, KeyEqual, ArenaAllocator<std::pair<const Key, T>>>;
+
+} // namespace Shader
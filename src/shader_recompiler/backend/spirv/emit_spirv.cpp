@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
@@ -15,6 +15,7 @@
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/backend/spirv/emit_spirv_instructions.h"
 #include "shader_recompiler/backend/spirv/spirv_emit_context.h"
+#include "shader_recompiler/compile_statistics.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/program.h"
 
@@ -503,22 +504,26 @@ void PatchPhiNodes(IR::Program& program, EmitContext& ctx) {
 
 std::vector<u32> EmitSPIRV(const Profile& profile, const RuntimeInfo& runtime_info,
                            IR::Program& program, Bindings& bindings, bool optimize) {
-    EmitContext ctx{profile, runtime_info, program, bindings};
-    const Id main{DefineMain(ctx, program)};
-    DefineEntryPoint(program, ctx, main);
-    if (profile.support_float_controls) {
-        ctx.AddExtension("SPV_KHR_float_controls");
-        SetupDenormControl(profile, program, ctx, main);
-        SetupSignedNanCapabilities(profile, program, ctx, main);
-    }
-    SetupCapabilities(profile, program.info, ctx);
-    SetupTransformFeedbackCapabilities(ctx, main);
-    PatchPhiNodes(program, ctx);
-
+    std::vector<u32> spirv;
+    {
+        const CompileStatistics::PhaseTimer timer{"EmitSPIRV"};
+        EmitContext ctx{profile, runtime_info, program, bindings};
+        const Id main{DefineMain(ctx, program)};
+        DefineEntryPoint(program, ctx, main);
+        if (profile.support_float_controls) {
+            ctx.AddExtension("SPV_KHR_float_controls");
+            SetupDenormControl(profile, program, ctx, main);
+            SetupSignedNanCapabilities(profile, program, ctx, main);
+        }
+        SetupCapabilities(profile, program.info, ctx);
+        SetupTransformFeedbackCapabilities(ctx, main);
+        PatchPhiNodes(program, ctx);
+        spirv = ctx.Assemble();
+    }
     if (!optimize) {
-        return ctx.Assemble();
+        return spirv;
     } else {
-        std::vector<u32> spirv = ctx.Assemble();
+        const CompileStatistics::PhaseTimer timer{"OptimizeSPIRV"};
 
         // Use thread-local optimizer instead of creating a new one
         auto& spv_opt = GetThreadOptimizer();
@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "shader_recompiler/compile_statistics.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/program.h"
+
+namespace Shader::CompileStatistics {
+namespace {
+struct PhaseSamples {
+    std::vector<u64> nanoseconds;
+    u64 insts_before{};
+    u64 insts_after{};
+    u64 num_sized{};
+};
+
+struct Samples {
+    std::mutex mutex;
+    std::map<std::string, PhaseSamples, std::less<>> phases;
+    std::vector<u64> pipeline_nanoseconds;
+    std::vector<u64> pipeline_output_sizes;
+    std::vector<u64> arena_allocations;
+    std::vector<u64> arena_bytes;
+    std::vector<u64> arena_chunk_allocations;
+};
+
+struct Percentiles {
+    u64 total{};
+    u64 p50{};
+    u64 p90{};
+    u64 p99{};
+    u64 max{};
+};
+
+struct Row {
+    std::string name;
+    size_t count;
+    Percentiles time;
+    u64 mean_insts_before;
+    u64 mean_insts_after;
+};
+
+struct ArenaUsage {
+    size_t count{};
+    Percentiles allocations;
+    Percentiles bytes;
+    Percentiles chunk_allocations;
+};
+
+Samples& GetSamples() {
+    static Samples samples;
+    return samples;
+}
+
+u64 Nanoseconds(std::chrono::steady_clock::time_point start) {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - start)
+                                .count());
+}
+
+Percentiles ComputePercentiles(std::vector<u64> values) {
+    if (values.empty()) {
+        return {};
+    }
+    std::ranges::sort(values);
+    // Nearest rank percentiles
+    const auto rank{[&values](size_t percent) {
+        return values[(values.size() * percent + 99) / 100 - 1];
+    }};
+    Percentiles result;
+    for (const u64 value : values) {
+        result.total += value;
+    }
+    result.p50 = rank(50);
+    result.p90 = rank(90);
+    result.p99 = rank(99);
+    result.max = values.back();
+    return result;
+}
+
+/// Takes a snapshot of the collected samples, phases sorted by their total time
+std::vector<Row> CollectRows(size_t& num_pipelines, Percentiles& pipeline_time,
+                             Percentiles& output_size, ArenaUsage& arena) {
+    Samples& samples{GetSamples()};
+    std::vector<Row> rows;
+    std::scoped_lock lock{samples.mutex};
+    for (const auto& [name, phase] : samples.phases) {
+        rows.push_back({
+            .name = name,
+            .count = phase.nanoseconds.size(),
+            .time = ComputePercentiles(phase.nanoseconds),
+            .mean_insts_before = phase.num_sized ? phase.insts_before / phase.num_sized : 0,
+            .mean_insts_after = phase.num_sized ? phase.insts_after / phase.num_sized : 0,
+        });
+    }
+    std::ranges::sort(rows, std::greater{}, [](const Row& row) { return row.time.total; });
+    num_pipelines = samples.pipeline_nanoseconds.size();
+    pipeline_time = ComputePercentiles(samples.pipeline_nanoseconds);
+    output_size = ComputePercentiles(samples.pipeline_output_sizes);
+    arena.count = samples.arena_allocations.size();
+    arena.allocations = ComputePercentiles(samples.arena_allocations);
+    arena.bytes = ComputePercentiles(samples.arena_bytes);
+    arena.chunk_allocations = ComputePercentiles(samples.arena_chunk_allocations);
+    return rows;
+}
+
+double Microseconds(u64 nanoseconds) {
+    return static_cast<double>(nanoseconds) / 1000.0;
+}
+} // Anonymous namespace
+
+bool IsEnabled() {
+    return Settings::values.shader_compile_statistics.GetValue();
+}
+
+PhaseTimer::PhaseTimer(std::string_view name_, const IR::Program* program_)
+    : name{name_}, program{program_}, enabled{IsEnabled()} {
+    if (!enabled) {
+        return;
+    }
+    if (program) {
+        insts_before = CountInsts(*program);
+    }
+    start = std::chrono::steady_clock::now();
+}
+
+PhaseTimer::~PhaseTimer() {
+    if (!enabled) {
+        return;
+    }
+    const u64 nanoseconds{Nanoseconds(start)};
+    const u64 insts_after{program ? CountInsts(*program) : 0};
+
+    Samples& samples{GetSamples()};
+    std::scoped_lock lock{samples.mutex};
+    auto it{samples.phases.find(name)};
+    if (it == samples.phases.end()) {
+        it = samples.phases.emplace(std::string{name}, PhaseSamples{}).first;
+    }
+    PhaseSamples& phase{it->second};
+    phase.nanoseconds.push_back(nanoseconds);
+    if (program) {
+        phase.insts_before += insts_before;
+        phase.insts_after += insts_after;
+        ++phase.num_sized;
+    }
+}
+
+PipelineTimer::PipelineTimer() : enabled{IsEnabled()} {
+    if (enabled) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+PipelineTimer::~PipelineTimer() {
+    if (!enabled) {
+        return;
+    }
+    const u64 nanoseconds{Nanoseconds(start)};
+    Samples& samples{GetSamples()};
+    std::scoped_lock lock{samples.mutex};
+    samples.pipeline_nanoseconds.push_back(nanoseconds);
+    samples.pipeline_output_sizes.push_back(output_size);
+}
+
+void RecordArena(u64 num_allocations, u64 num_bytes, u64 num_chunk_allocations) {
+    Samples& samples{GetSamples()};
+    std::scoped_lock lock{samples.mutex};
+    samples.arena_allocations.push_back(num_allocations);
+    samples.arena_bytes.push_back(num_bytes);
+    samples.arena_chunk_allocations.push_back(num_chunk_allocations);
+}
+
+u64 CountInsts(const IR::Program& program) {
+    u64 num_insts{};
+    for (const IR::Block* const block : program.blocks) {
+        num_insts += block->size();
+    }
+    return num_insts;
+}
+
+std::string Report() {
+    size_t num_pipelines{};
+    Percentiles pipeline_time;
+    Percentiles output_size;
+    ArenaUsage arena;
+    const std::vector<Row> rows{CollectRows(num_pipelines, pipeline_time, output_size, arena)};
+
+    std::string report{fmt::format("\nShader compilation statistics, {} pipelines\n"
+                                   "{:<36} {:>8} {:>11} {:>10} {:>10} {:>10} {:>10} {:>8} {:>8}\n",
+                                   num_pipelines, "Phase", "Count", "Total ms", "p50 us",
+                                   "p90 us", "p99 us", "Max us", "IR in", "IR out")};
+    const auto add_row{[&report](std::string_view name, size_t count, const Percentiles& time,
+                                 u64 insts_before, u64 insts_after) {
+        report += fmt::format(
+            "{:<36} {:>8} {:>11.3f} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f} {:>8} {:>8}\n", name,
+            count, Microseconds(time.total) / 1000.0, Microseconds(time.p50),
+            Microseconds(time.p90), Microseconds(time.p99), Microseconds(time.max), insts_before,
+            insts_after);
+    }};
+    add_row("Pipeline", num_pipelines, pipeline_time, 0, 0);
+    for (const Row& row : rows) {
+        add_row(row.name, row.count, row.time, row.mean_insts_before, row.mean_insts_after);
+    }
+    report += fmt::format("Pipeline code size: p50 {} bytes, p90 {} bytes, p99 {} bytes, max {} "
+                          "bytes, total {} bytes\n",
+                          output_size.p50, output_size.p90, output_size.p99, output_size.max,
+                          output_size.total);
+    if (arena.count != 0) {
+        report += fmt::format("Arena allocations per build: p50 {}, p90 {}, max {}, total {}; "
+                              "bytes per build: p50 {}, p90 {}, max {}; chunk allocations: {} "
+                              "in {} builds\n",
+                              arena.allocations.p50, arena.allocations.p90, arena.allocations.max,
+                              arena.allocations.total, arena.bytes.p50, arena.bytes.p90,
+                              arena.bytes.max, arena.chunk_allocations.total, arena.count);
+    }
+    return report;
+}
+
+std::string ReportCsv() {
+    size_t num_pipelines{};
+    Percentiles pipeline_time;
+    Percentiles output_size;
+    ArenaUsage arena;
+    const std::vector<Row> rows{CollectRows(num_pipelines, pipeline_time, output_size, arena)};
+
+    std::string csv{"phase,count,total_ns,p50_ns,p90_ns,p99_ns,max_ns,mean_ir_in,mean_ir_out\n"};
+    const auto add_row{[&csv](std::string_view name, size_t count, const Percentiles& values,
+                              u64 insts_before, u64 insts_after) {
+        csv += fmt::format("{},{},{},{},{},{},{},{},{}\n", name, count, values.total, values.p50,
+                           values.p90, values.p99, values.max, insts_before, insts_after);
+    }};
+    add_row("Pipeline", num_pipelines, pipeline_time, 0, 0);
+    // Sizes are in bytes instead of nanoseconds
+    add_row("PipelineCodeSize", num_pipelines, output_size, 0, 0);
+    // Arena rows count allocations, bytes and chunks of each build
+    add_row("ArenaAllocations", arena.count, arena.allocations, 0, 0);
+    add_row("ArenaBytes", arena.count, arena.bytes, 0, 0);
+    add_row("ArenaChunkAllocations", arena.count, arena.chunk_allocations, 0, 0);
+    for (const Row& row : rows) {
+        add_row(row.name, row.count, row.time, row.mean_insts_before, row.mean_insts_after);
+    }
+    return csv;
+}
+
+void Dump() {
+    {
+        Samples& samples{GetSamples()};
+        std::scoped_lock lock{samples.mutex};
+        if (samples.phases.empty() && samples.pipeline_nanoseconds.empty() &&
+            samples.arena_allocations.empty()) {
+            return;
+        }
+    }
+    LOG_INFO(Shader, "{}", Report());
+
+    const auto path{Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir) /
+                    "shader_compile_statistics.csv"};
+    const std::string csv{ReportCsv()};
+    if (Common::FS::WriteStringToFile(path, Common::FS::FileType::TextFile, csv) != csv.size()) {
+        LOG_ERROR(Shader, "Failed to write {}", Common::FS::PathToUTF8String(path));
+    }
+}
+
+void Clear() {
+    Samples& samples{GetSamples()};
+    std::scoped_lock lock{samples.mutex};
+    samples.phases.clear();
+    samples.pipeline_nanoseconds.clear();
+    samples.pipeline_output_sizes.clear();
+    samples.arena_allocations.clear();
+    samples.arena_bytes.clear();
+    samples.arena_chunk_allocations.clear();
+}
+
+} // namespace Shader::CompileStatistics
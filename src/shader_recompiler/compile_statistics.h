@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+#include "common/common_types.h"
+
+namespace Shader::IR {
+struct Program;
+}
+
+/**
+ * Instrumentation of shader compilation, collected while shader_compile_statistics is enabled.
+ * Records the wall time of every phase of a pipeline build (decoding, each IR pass, code emission
+ * and the driver) with the size of the IR before and after it, the build time and code size of
+ * whole pipelines and the use of their arenas. Phases can run on any thread.
+ */
+namespace Shader::CompileStatistics {
+
+/// Returns true when statistics are collected
+[[nodiscard]] bool IsEnabled();
+
+/// Measures a phase of compilation until it goes out of scope. When a program is given, the
+/// number of IR instructions in it is recorded before and after the phase.
+class PhaseTimer {
+public:
+    explicit PhaseTimer(std::string_view name_, const IR::Program* program_ = nullptr);
+    ~PhaseTimer();
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    std::string_view name;
+    const IR::Program* program;
+    std::chrono::steady_clock::time_point start;
+    u64 insts_before{};
+    bool enabled;
+};
+
+/// Measures the build of a pipeline until it goes out of scope
+class PipelineTimer {
+public:
+    PipelineTimer();
+    ~PipelineTimer();
+
+    PipelineTimer(const PipelineTimer&) = delete;
+    PipelineTimer& operator=(const PipelineTimer&) = delete;
+
+    /// Adds the size in bytes of code generated for the pipeline
+    void AddOutputSize(size_t bytes) noexcept {
+        output_size += bytes;
+    }
+
+private:
+    std::chrono::steady_clock::time_point start;
+    u64 output_size{};
+    bool enabled;
+};
+
+/// Records the allocations served by the arena of a pipeline build and the chunks it allocated
+void RecordArena(u64 num_allocations, u64 num_bytes, u64 num_chunk_allocations);
+
+/// Returns the number of IR instructions in a program
+[[nodiscard]] u64 CountInsts(const IR::Program& program);
+
+/// Formats percentiles of the time of each phase, of the build time and code size of pipelines
+/// and of the arena allocations of each build
+[[nodiscard]] std::string Report();
+
+/// Formats the same statistics as Report as comma separated values
+[[nodiscard]] std::string ReportCsv();
+
+/// Writes the report to the log and its values to shader_compile_statistics.csv in the log
+/// directory, when any statistic has been collected
+void Dump();
+
+/// Discards all collected statistics
+void Clear();
+
+} // namespace Shader::CompileStatistics
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -12,6 +15,7 @@
 
 #include "common/bit_cast.h"
 #include "common/common_types.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/frontend/ir/condition.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/object_pool.h"
@@ -172,10 +176,10 @@ private:
     /// List of instructions in this block
     InstructionList instructions;
 
-    /// Block immediate predecessors
-    std::vector<Block*> imm_predecessors;
-    /// Block immediate successors
-    std::vector<Block*> imm_successors;
+    /// Block immediate predecessors, allocated in the arena of the pipeline build
+    ArenaVector<Block*> imm_predecessors;
+    /// Block immediate successors, allocated in the arena of the pipeline build
+    ArenaVector<Block*> imm_successors;
 
     /// Intrusively store the value of a register in the block.
     std::array<Value, NUM_REGS> ssa_reg_values;
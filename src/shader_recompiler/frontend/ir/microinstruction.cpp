@@ -1,8 +1,12 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
 #include <memory>
+#include <type_traits>
 
 #include "shader_recompiler/exception.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
@@ -31,13 +35,29 @@ void RemovePseudoInstruction(IR::Inst*& inst, IR::Opcode expected_opcode) {
     inst = nullptr;
 }
 
-void AllocAssociatedInsts(std::unique_ptr<AssociatedInsts>& associated_insts) {
-    if (!associated_insts) {
-        associated_insts = std::make_unique<AssociatedInsts>();
+void AllocAssociatedInsts(AssociatedInstsPtr& associated_insts) {
+    if (associated_insts) {
+        return;
+    }
+    Arena* const arena{CurrentArena()};
+    if (!arena) {
+        associated_insts.reset(new AssociatedInsts{});
+        return;
     }
+    void* const memory{arena->Allocate(sizeof(AssociatedInsts), alignof(AssociatedInsts))};
+    associated_insts = AssociatedInstsPtr{std::construct_at(static_cast<AssociatedInsts*>(memory)),
+                                          AssociatedInstsDeleter{arena}};
 }
 } // Anonymous namespace
 
+void AssociatedInstsDeleter::operator()(AssociatedInsts* associated_insts) const noexcept {
+    static_assert(std::is_trivially_destructible_v<AssociatedInsts>);
+    // Memory in arenas is reclaimed when the arena is reset
+    if (!arena) {
+        delete associated_insts;
+    }
+}
+
 Inst::Inst(IR::Opcode op_, u32 flags_) noexcept : op{op_}, flags{flags_} {
     if (op == Opcode::Phi) {
         std::construct_at(&phi_args);
@@ -386,7 +406,7 @@ void Inst::Use(const Value& value) {
     Inst* const inst{value.Inst()};
     ++inst->use_count;
 
-    std::unique_ptr<AssociatedInsts>& assoc_inst{inst->associated_insts};
+    AssociatedInstsPtr& assoc_inst{inst->associated_insts};
     switch (op) {
     case Opcode::GetZeroFromOp:
         AllocAssociatedInsts(assoc_inst);
@@ -421,7 +441,7 @@ void Inst::UndoUse(const Value& value) {
     Inst* const inst{value.Inst()};
     --inst->use_count;
 
-    std::unique_ptr<AssociatedInsts>& assoc_inst{inst->associated_insts};
+    AssociatedInstsPtr& assoc_inst{inst->associated_insts};
     switch (op) {
     case Opcode::GetZeroFromOp:
         AllocAssociatedInsts(assoc_inst);
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -16,6 +19,7 @@
 #include "common/assert.h"
 #include "common/bit_cast.h"
 #include "common/common_types.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/exception.h"
 #include "shader_recompiler/frontend/ir/attribute.h"
 #include "shader_recompiler/frontend/ir/opcodes.h"
@@ -31,6 +35,14 @@ class Inst;
 
 struct AssociatedInsts;
 
+/// Frees the associated instructions of an instruction to where they were allocated from
+struct AssociatedInstsDeleter {
+    void operator()(AssociatedInsts* associated_insts) const noexcept;
+
+    Arena* arena{};
+};
+using AssociatedInstsPtr = std::unique_ptr<AssociatedInsts, AssociatedInstsDeleter>;
+
 class Value {
 public:
     Value() noexcept = default;
@@ -244,7 +256,7 @@ private:
         boost::container::small_vector<std::pair<Block*, Value>, 2> phi_args;
         std::array<Value, 5> args;
     };
-    std::unique_ptr<AssociatedInsts> associated_insts;
+    AssociatedInstsPtr associated_insts;
 };
 static_assert(sizeof(Inst) <= 128, "Inst size unintentionally increased");
 
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,6 +10,7 @@
 #include <queue>
 
 #include "common/settings.h"
+#include "shader_recompiler/compile_statistics.h"
 #include "shader_recompiler/exception.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/ir_emitter.h"
@@ -19,6 +23,12 @@
 
 namespace Shader::Maxwell {
 namespace {
+template <typename Func>
+void RunPass(std::string_view name, IR::Program& program, Func&& func) {
+    const CompileStatistics::PhaseTimer timer{name, &program};
+    func();
+}
+
 IR::BlockList GenerateBlocks(const IR::AbstractSyntaxList& syntax_list) {
     size_t num_syntax_blocks{};
     for (const auto& node : syntax_list) {
@@ -239,8 +249,18 @@ void LowerGeometryPassthrough(const IR::Program& program, const HostTranslateInf
 
 IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Block>& block_pool,
                              Environment& env, Flow::CFG& cfg, const HostTranslateInfo& host_info) {
+    IR::AbstractSyntaxList syntax_list;
+    {
+        const CompileStatistics::PhaseTimer timer{"Structurize"};
+        syntax_list = BuildASL(inst_pool, block_pool, env, cfg, host_info);
+    }
+    return TranslateProgram(std::move(syntax_list), env, host_info);
+}
+
+IR::Program TranslateProgram(IR::AbstractSyntaxList&& syntax_list, Environment& env,
+                             const HostTranslateInfo& host_info) {
     IR::Program program;
-    program.syntax_list = BuildASL(inst_pool, block_pool, env, cfg, host_info);
+    program.syntax_list = std::move(syntax_list);
     program.blocks = GenerateBlocks(program.syntax_list);
     program.post_order_blocks = PostOrder(program.syntax_list.front());
     program.stage = env.ShaderStage();
@@ -281,36 +301,45 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
 
     // Replace instructions before the SSA rewrite
     if (!host_info.support_float64) {
-        Optimization::LowerFp64ToFp32(program);
+        RunPass("LowerFp64ToFp32", program, [&] { Optimization::LowerFp64ToFp32(program); });
     }
     if (!host_info.support_float16) {
-        Optimization::LowerFp16ToFp32(program);
+        RunPass("LowerFp16ToFp32", program, [&] { Optimization::LowerFp16ToFp32(program); });
     }
     if (!host_info.support_int64) {
-        Optimization::LowerInt64ToInt32(program);
+        RunPass("LowerInt64ToInt32", program, [&] { Optimization::LowerInt64ToInt32(program); });
     }
     if (!host_info.support_conditional_barrier) {
-        Optimization::ConditionalBarrierPass(program);
+        RunPass("ConditionalBarrierPass", program,
+                [&] { Optimization::ConditionalBarrierPass(program); });
     }
-    Optimization::SsaRewritePass(program);
+    RunPass("SsaRewritePass", program, [&] { Optimization::SsaRewritePass(program); });
 
-    Optimization::ConstantPropagationPass(env, program);
+    RunPass("ConstantPropagationPass", program,
+            [&] { Optimization::ConstantPropagationPass(env, program); });
 
-    Optimization::PositionPass(env, program);
+    RunPass("PositionPass", program, [&] { Optimization::PositionPass(env, program); });
 
-    Optimization::GlobalMemoryToStorageBufferPass(program, host_info);
-    Optimization::TexturePass(env, program, host_info);
+    RunPass("GlobalMemoryToStorageBufferPass", program,
+            [&] { Optimization::GlobalMemoryToStorageBufferPass(program, host_info); });
+    RunPass("TexturePass", program, [&] { Optimization::TexturePass(env, program, host_info); });
 
     if (Settings::values.resolution_info.active) {
-        Optimization::RescalingPass(program);
+        RunPass("RescalingPass", program, [&] { Optimization::RescalingPass(program); });
     }
-    Optimization::DeadCodeEliminationPass(program);
+    RunPass("LoopInvariantCodeMotionPass", program,
+            [&] { Optimization::LoopInvariantCodeMotionPass(program); });
+    RunPass("GlobalValueNumberingPass", program,
+            [&] { Optimization::GlobalValueNumberingPass(program); });
+    RunPass("DeadCodeEliminationPass", program,
+            [&] { Optimization::DeadCodeEliminationPass(program); });
     if (Settings::values.renderer_debug) {
-        Optimization::VerificationPass(program);
+        RunPass("VerificationPass", program, [&] { Optimization::VerificationPass(program); });
     }
-    Optimization::CollectShaderInfoPass(env, program);
-    Optimization::LayerPass(program, host_info);
-    Optimization::VendorWorkaroundPass(program);
+    RunPass("CollectShaderInfoPass", program,
+            [&] { Optimization::CollectShaderInfoPass(env, program); });
+    RunPass("LayerPass", program, [&] { Optimization::LayerPass(program, host_info); });
+    RunPass("VendorWorkaroundPass", program, [&] { Optimization::VendorWorkaroundPass(program); });
 
     CollectInterpolationInfo(env, program);
     AddNVNStorageBuffers(program);
@@ -0,0 +1,295 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <mutex>
+#include <optional>
+
+#include <boost/functional/hash.hpp>
+
+#include "common/cityhash.h"
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/compile_statistics.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/maxwell/structured_control_flow.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
+#include "shader_recompiler/host_translate_info.h"
+
+namespace Shader::Maxwell {
+namespace {
+bool HasIndirectBranches(const Flow::CFG& cfg) {
+    return std::ranges::any_of(cfg.Functions(), [](const Flow::Function& function) {
+        return std::ranges::any_of(function.blocks, [](const Flow::Block& block) {
+            return block.end_class == Flow::EndClass::IndirectBranch;
+        });
+    });
+}
+
+size_t CountInsts(const IR::AbstractSyntaxList& syntax_list) {
+    size_t num_insts{};
+    for (const IR::AbstractSyntaxNode& node : syntax_list) {
+        if (node.type == IR::AbstractSyntaxNode::Type::Block) {
+            num_insts += node.data.block->size();
+        }
+    }
+    return num_insts;
+}
+
+size_t CountBlocks(const IR::AbstractSyntaxList& syntax_list) {
+    return static_cast<size_t>(std::ranges::count(
+        syntax_list, IR::AbstractSyntaxNode::Type::Block, &IR::AbstractSyntaxNode::type));
+}
+
+/// Copies a structured program into new pools without modifying the source, so many threads can
+/// copy the same program at once
+class SyntaxListCloner {
+public:
+    explicit SyntaxListCloner(ObjectPool<IR::Inst>& inst_pool_, ObjectPool<IR::Block>& block_pool_)
+        : inst_pool{inst_pool_}, block_pool{block_pool_} {}
+
+    IR::AbstractSyntaxList Clone(const IR::AbstractSyntaxList& syntax_list) {
+        // Instructions are created before their arguments are set, as arguments may be defined
+        // by instructions of blocks found later in the syntax list
+        for (const IR::AbstractSyntaxNode& node : syntax_list) {
+            if (node.type == IR::AbstractSyntaxNode::Type::Block) {
+                CloneInsts(*node.data.block);
+            }
+        }
+        for (const IR::AbstractSyntaxNode& node : syntax_list) {
+            if (node.type != IR::AbstractSyntaxNode::Type::Block) {
+                continue;
+            }
+            const IR::Block* const block{node.data.block};
+            for (IR::Block* const successor : block->ImmSuccessors()) {
+                Map(block)->AddBranch(Map(successor));
+            }
+            for (const IR::Inst& inst : block->Instructions()) {
+                IR::Inst* const clone{Map(&inst)};
+                const size_t num_args{inst.NumArgs()};
+                for (size_t index = 0; index < num_args; ++index) {
+                    clone->SetArg(index, Map(inst.Arg(index)));
+                }
+            }
+        }
+        IR::AbstractSyntaxList result;
+        result.reserve(syntax_list.size());
+        for (const IR::AbstractSyntaxNode& node : syntax_list) {
+            result.push_back(Clone(node));
+        }
+        return result;
+    }
+
+private:
+    void CloneInsts(const IR::Block& block) {
+        IR::Block* const clone{block_pool.Create(inst_pool)};
+        block_map.emplace(&block, clone);
+        for (const IR::Inst& inst : block.Instructions()) {
+            if (inst.GetOpcode() == IR::Opcode::Phi) {
+                throw LogicError("Phi nodes can not be cloned");
+            }
+            IR::Inst* const inst_clone{inst_pool.Create(inst.GetOpcode(), inst.Flags<u32>())};
+            clone->Instructions().push_back(*inst_clone);
+            inst_map.emplace(&inst, inst_clone);
+        }
+    }
+
+    IR::AbstractSyntaxNode Clone(const IR::AbstractSyntaxNode& node) {
+        IR::AbstractSyntaxNode result{node};
+        auto& data{result.data};
+        switch (node.type) {
+        case IR::AbstractSyntaxNode::Type::Block:
+            data.block = Map(data.block);
+            break;
+        case IR::AbstractSyntaxNode::Type::If:
+            data.if_node.cond = Map(data.if_node.cond);
+            data.if_node.body = Map(data.if_node.body);
+            data.if_node.merge = Map(data.if_node.merge);
+            break;
+        case IR::AbstractSyntaxNode::Type::EndIf:
+            data.end_if.merge = Map(data.end_if.merge);
+            break;
+        case IR::AbstractSyntaxNode::Type::Loop:
+            data.loop.body = Map(data.loop.body);
+            data.loop.continue_block = Map(data.loop.continue_block);
+            data.loop.merge = Map(data.loop.merge);
+            break;
+        case IR::AbstractSyntaxNode::Type::Repeat:
+            data.repeat.cond = Map(data.repeat.cond);
+            data.repeat.loop_header = Map(data.repeat.loop_header);
+            data.repeat.merge = Map(data.repeat.merge);
+            break;
+        case IR::AbstractSyntaxNode::Type::Break:
+            data.break_node.cond = Map(data.break_node.cond);
+            data.break_node.merge = Map(data.break_node.merge);
+            data.break_node.skip = Map(data.break_node.skip);
+            break;
+        case IR::AbstractSyntaxNode::Type::Return:
+        case IR::AbstractSyntaxNode::Type::Unreachable:
+            break;
+        }
+        return result;
+    }
+
+    IR::Block* Map(const IR::Block* block) const {
+        if (!block) {
+            return nullptr;
+        }
+        const auto it{block_map.find(block)};
+        if (it == block_map.end()) {
+            throw LogicError("Block outside of the syntax list");
+        }
+        return it->second;
+    }
+
+    IR::Inst* Map(const IR::Inst* inst) const {
+        const auto it{inst_map.find(inst)};
+        if (it == inst_map.end()) {
+            throw LogicError("Instruction outside of the syntax list");
+        }
+        return it->second;
+    }
+
+    IR::Value Map(const IR::Value& value) const {
+        if (value.IsImmediate()) {
+            return value.Resolve();
+        }
+        return IR::Value{Map(value.Inst())};
+    }
+
+    IR::U1 Map(const IR::U1& value) const {
+        if (value.IsEmpty()) {
+            return value;
+        }
+        return IR::U1{Map(static_cast<const IR::Value&>(value))};
+    }
+
+    ObjectPool<IR::Inst>& inst_pool;
+    ObjectPool<IR::Block>& block_pool;
+    ArenaUnorderedMap<const IR::Block*, IR::Block*> block_map;
+    ArenaUnorderedMap<const IR::Inst*, IR::Inst*> inst_map;
+};
+} // Anonymous namespace
+
+struct TranslationCache::Entry {
+    explicit Entry(const IR::AbstractSyntaxList& source)
+        : num_insts{CountInsts(source)}, inst_pool{(std::max<size_t>)(num_insts, 1)},
+          block_pool{(std::max<size_t>)(CountBlocks(source), 1)},
+          syntax_list{SyntaxListCloner{inst_pool, block_pool}.Clone(source)} {}
+
+    size_t num_insts;
+    ObjectPool<IR::Inst> inst_pool;
+    ObjectPool<IR::Block> block_pool;
+    IR::AbstractSyntaxList syntax_list;
+};
+
+size_t TranslationCache::KeyHash::operator()(const Key& key) const noexcept {
+    size_t seed{static_cast<size_t>(key.code_hash)};
+    boost::hash_combine(seed, key.header_hash);
+    boost::hash_combine(seed, key.start_address);
+    boost::hash_combine(seed, key.local_memory_size);
+    boost::hash_combine(seed, static_cast<u32>(key.stage));
+    boost::hash_combine(seed, key.exits_to_dispatcher);
+    boost::hash_combine(seed, key.needs_demote_reorder);
+    return seed;
+}
+
+TranslationCache::TranslationCache(size_t max_cached_insts_)
+    : max_cached_insts{max_cached_insts_} {}
+
+TranslationCache::~TranslationCache() = default;
+
+IR::Program TranslationCache::Translate(ObjectPool<IR::Inst>& inst_pool,
+                                        ObjectPool<IR::Block>& block_pool,
+                                        ObjectPool<Flow::Block>& flow_block_pool,
+                                        Environment& env, u64 code_hash, u32 start_address,
+                                        bool exits_to_dispatcher,
+                                        const HostTranslateInfo& host_info) {
+    // Besides the code, decoding reads the program header, the stage and the local memory size
+    const ProgramHeader& sph{env.SPH()};
+    const Key key{
+        .code_hash = code_hash,
+        .header_hash = Common::CityHash64(reinterpret_cast<const char*>(&sph), sizeof(sph)),
+        .start_address = start_address,
+        .local_memory_size = env.LocalMemorySize(),
+        .stage = env.ShaderStage(),
+        .exits_to_dispatcher = exits_to_dispatcher,
+        .needs_demote_reorder = host_info.needs_demote_reorder,
+    };
+    std::shared_ptr<const Entry> entry;
+    {
+        std::shared_lock lock{mutex};
+        if (const auto it{entries.find(key)}; it != entries.end()) {
+            entry = it->second;
+        }
+    }
+    if (entry) {
+        ++num_hits;
+        IR::AbstractSyntaxList syntax_list;
+        {
+            const CompileStatistics::PhaseTimer timer{"CopyCachedProgram"};
+            syntax_list = SyntaxListCloner{inst_pool, block_pool}.Clone(entry->syntax_list);
+        }
+        return TranslateProgram(std::move(syntax_list), env, host_info);
+    }
+    std::optional<Flow::CFG> cfg;
+    {
+        const CompileStatistics::PhaseTimer timer{"ControlFlow"};
+        cfg.emplace(env, flow_block_pool, start_address, exits_to_dispatcher);
+    }
+    IR::AbstractSyntaxList syntax_list;
+    {
+        const CompileStatistics::PhaseTimer timer{"Structurize"};
+        syntax_list = BuildASL(inst_pool, block_pool, env, *cfg, host_info);
+    }
+    if (HasIndirectBranches(*cfg) || env.HasUnboundInstructions()) {
+        // Indirect branch targets are read from constant buffers and unbound instructions from
+        // memory past the hashed code, the code hash does not identify them
+        ++num_uncacheable;
+    } else {
+        ++num_misses;
+        // Cached programs outlive the arena of this pipeline
+        const ArenaScope heap_scope{nullptr};
+        Insert(key, std::make_shared<const Entry>(syntax_list));
+    }
+    return TranslateProgram(std::move(syntax_list), env, host_info);
+}
+
+void TranslationCache::Clear() {
+    std::scoped_lock lock{mutex};
+    entries.clear();
+    insertion_order.clear();
+    num_cached_insts = 0;
+}
+
+TranslationCache::Statistics TranslationCache::GetStatistics() const noexcept {
+    return {
+        .hits = num_hits.load(std::memory_order_relaxed),
+        .misses = num_misses.load(std::memory_order_relaxed),
+        .uncacheable = num_uncacheable.load(std::memory_order_relaxed),
+    };
+}
+
+void TranslationCache::Insert(const Key& key, std::shared_ptr<const Entry> entry) {
+    if (entry->num_insts > max_cached_insts) {
+        return;
+    }
+    std::scoped_lock lock{mutex};
+    const auto [it, is_new]{entries.try_emplace(key, std::move(entry))};
+    if (!is_new) {
+        // Another thread translated the same program first
+        return;
+    }
+    num_cached_insts += it->second->num_insts;
+    insertion_order.push_back(key);
+
+    // Evict the oldest programs, threads still copying them keep them alive
+    while (num_cached_insts > max_cached_insts) {
+        const auto oldest{entries.find(insertion_order.front())};
+        num_cached_insts -= oldest->second->num_insts;
+        entries.erase(oldest);
+        insertion_order.pop_front();
+    }
+}
+
+} // namespace Shader::Maxwell
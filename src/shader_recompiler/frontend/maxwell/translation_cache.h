@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "shader_recompiler/environment.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/object_pool.h"
+#include "shader_recompiler/stage.h"
+
+namespace Shader {
+struct HostTranslateInfo;
+}
+
+namespace Shader::Maxwell {
+
+/**
+ * Thread safe cache of the structured IR built from Maxwell code, before any pass runs on it.
+ * Pipelines sharing a program with an earlier translation skip decoding, control flow analysis
+ * and structurization, and only run the passes of TranslateProgram on a copy of the cached IR.
+ */
+class TranslationCache {
+public:
+    struct Statistics {
+        u64 hits{};
+        u64 misses{};
+        u64 uncacheable{};
+    };
+
+    explicit TranslationCache(size_t max_cached_insts_ = DEFAULT_MAX_CACHED_INSTS);
+    ~TranslationCache();
+
+    TranslationCache(const TranslationCache&) = delete;
+    TranslationCache& operator=(const TranslationCache&) = delete;
+
+    /// Translates the program at start_address in env, like building a CFG and calling
+    /// TranslateProgram. code_hash has to identify the code of the program, programs reading
+    /// unbound instructions are not cached.
+    [[nodiscard]] IR::Program Translate(ObjectPool<IR::Inst>& inst_pool,
+                                        ObjectPool<IR::Block>& block_pool,
+                                        ObjectPool<Flow::Block>& flow_block_pool,
+                                        Environment& env, u64 code_hash, u32 start_address,
+                                        bool exits_to_dispatcher,
+                                        const HostTranslateInfo& host_info);
+
+    /// Removes all cached programs
+    void Clear();
+
+    [[nodiscard]] Statistics GetStatistics() const noexcept;
+
+private:
+    static constexpr size_t DEFAULT_MAX_CACHED_INSTS = 1 << 19;
+
+    struct Key {
+        u64 code_hash;
+        u64 header_hash;
+        u32 start_address;
+        u32 local_memory_size;
+        Stage stage;
+        bool exits_to_dispatcher;
+        bool needs_demote_reorder;
+
+        bool operator==(const Key&) const noexcept = default;
+    };
+
+    struct KeyHash {
+        [[nodiscard]] size_t operator()(const Key& key) const noexcept;
+    };
+
+    struct Entry;
+
+    void Insert(const Key& key, std::shared_ptr<const Entry> entry);
+
+    mutable std::shared_mutex mutex;
+    std::unordered_map<Key, std::shared_ptr<const Entry>, KeyHash> entries;
+    std::deque<Key> insertion_order;
+    size_t max_cached_insts;
+    size_t num_cached_insts{};
+
+    std::atomic<u64> num_hits{};
+    std::atomic<u64> num_misses{};
+    std::atomic<u64> num_uncacheable{};
+};
+
+} // namespace Shader::Maxwell
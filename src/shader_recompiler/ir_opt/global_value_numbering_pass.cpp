@@ -0,0 +1,511 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Dominator based value numbering, following
+//
+//      A Simple, Fast Dominance Algorithm.
+//      Cooper K. D., Harvey T. J., Kennedy K. (2001)
+//
+// Instructions computing the same value as an instruction in a dominating block are replaced by
+// it. Only instructions whose result depends exclusively on their arguments are numbered, loads
+// from memory that can be written by the shader and operations that depend on the active
+// invocations of the subgroup are left alone.
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/bit_cast.h"
+#include "common/logging/log.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+bool IsTextureOperation(IR::Opcode opcode) {
+    switch (opcode) {
+    case IR::Opcode::BindlessImageSampleImplicitLod:
+    case IR::Opcode::BindlessImageSampleExplicitLod:
+    case IR::Opcode::BindlessImageSampleDrefImplicitLod:
+    case IR::Opcode::BindlessImageSampleDrefExplicitLod:
+    case IR::Opcode::BindlessImageGather:
+    case IR::Opcode::BindlessImageGatherDref:
+    case IR::Opcode::BindlessImageFetch:
+    case IR::Opcode::BindlessImageQueryDimensions:
+    case IR::Opcode::BindlessImageQueryLod:
+    case IR::Opcode::BindlessImageGradient:
+    case IR::Opcode::BoundImageSampleImplicitLod:
+    case IR::Opcode::BoundImageSampleExplicitLod:
+    case IR::Opcode::BoundImageSampleDrefImplicitLod:
+    case IR::Opcode::BoundImageSampleDrefExplicitLod:
+    case IR::Opcode::BoundImageGather:
+    case IR::Opcode::BoundImageGatherDref:
+    case IR::Opcode::BoundImageFetch:
+    case IR::Opcode::BoundImageQueryDimensions:
+    case IR::Opcode::BoundImageQueryLod:
+    case IR::Opcode::BoundImageGradient:
+    case IR::Opcode::ImageSampleImplicitLod:
+    case IR::Opcode::ImageSampleExplicitLod:
+    case IR::Opcode::ImageSampleDrefImplicitLod:
+    case IR::Opcode::ImageSampleDrefExplicitLod:
+    case IR::Opcode::ImageGather:
+    case IR::Opcode::ImageGatherDref:
+    case IR::Opcode::ImageFetch:
+    case IR::Opcode::ImageQueryDimensions:
+    case IR::Opcode::ImageQueryLod:
+    case IR::Opcode::ImageGradient:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// Returns true when the result of the instruction only depends on its opcode, flags and arguments
+bool IsPureValue(const IR::Inst& inst, Stage stage) {
+    if (inst.MayHaveSideEffects() || inst.IsPseudoInstruction() ||
+        inst.HasAssociatedPseudoOperation()) {
+        return false;
+    }
+    switch (inst.GetOpcode()) {
+    case IR::Opcode::Phi:
+    case IR::Opcode::Identity:
+    case IR::Opcode::Void:
+    case IR::Opcode::GetRegister:
+    case IR::Opcode::GetPred:
+    case IR::Opcode::GetGotoVariable:
+    case IR::Opcode::GetIndirectBranchVariable:
+    case IR::Opcode::GetZFlag:
+    case IR::Opcode::GetSFlag:
+    case IR::Opcode::GetCFlag:
+    case IR::Opcode::GetOFlag:
+    case IR::Opcode::IsHelperInvocation:
+    case IR::Opcode::UndefU1:
+    case IR::Opcode::UndefU8:
+    case IR::Opcode::UndefU16:
+    case IR::Opcode::UndefU32:
+    case IR::Opcode::UndefU64:
+    case IR::Opcode::LoadGlobalU8:
+    case IR::Opcode::LoadGlobalS8:
+    case IR::Opcode::LoadGlobalU16:
+    case IR::Opcode::LoadGlobalS16:
+    case IR::Opcode::LoadGlobal32:
+    case IR::Opcode::LoadGlobal64:
+    case IR::Opcode::LoadGlobal128:
+    case IR::Opcode::LoadStorageU8:
+    case IR::Opcode::LoadStorageS8:
+    case IR::Opcode::LoadStorageU16:
+    case IR::Opcode::LoadStorageS16:
+    case IR::Opcode::LoadStorage32:
+    case IR::Opcode::LoadStorage64:
+    case IR::Opcode::LoadStorage128:
+    case IR::Opcode::LoadLocal:
+    case IR::Opcode::LoadSharedU8:
+    case IR::Opcode::LoadSharedS8:
+    case IR::Opcode::LoadSharedU16:
+    case IR::Opcode::LoadSharedS16:
+    case IR::Opcode::LoadSharedU32:
+    case IR::Opcode::LoadSharedU64:
+    case IR::Opcode::LoadSharedU128:
+    case IR::Opcode::BindlessImageRead:
+    case IR::Opcode::BoundImageRead:
+    case IR::Opcode::ImageRead:
+    case IR::Opcode::VoteAll:
+    case IR::Opcode::VoteAny:
+    case IR::Opcode::VoteEqual:
+    case IR::Opcode::SubgroupBallot:
+    case IR::Opcode::ShuffleIndex:
+    case IR::Opcode::ShuffleUp:
+    case IR::Opcode::ShuffleDown:
+    case IR::Opcode::ShuffleButterfly:
+    case IR::Opcode::FSwizzleAdd:
+    case IR::Opcode::DPdxFine:
+    case IR::Opcode::DPdyFine:
+    case IR::Opcode::DPdxCoarse:
+    case IR::Opcode::DPdyCoarse:
+        return false;
+    case IR::Opcode::GetAttribute:
+    case IR::Opcode::GetAttributeU32:
+    case IR::Opcode::GetAttributeIndexed:
+    case IR::Opcode::GetPatch:
+        // Tessellation control shaders can read back their own outputs
+        return stage != Stage::TessellationControl;
+    default:
+        return true;
+    }
+}
+
+bool IsCommutative(IR::Opcode opcode) {
+    switch (opcode) {
+    case IR::Opcode::IAdd32:
+    case IR::Opcode::IAdd64:
+    case IR::Opcode::IMul32:
+    case IR::Opcode::FPAdd16:
+    case IR::Opcode::FPAdd32:
+    case IR::Opcode::FPAdd64:
+    case IR::Opcode::FPMul16:
+    case IR::Opcode::FPMul32:
+    case IR::Opcode::FPMul64:
+    case IR::Opcode::BitwiseAnd32:
+    case IR::Opcode::BitwiseOr32:
+    case IR::Opcode::BitwiseXor32:
+    case IR::Opcode::LogicalAnd:
+    case IR::Opcode::LogicalOr:
+    case IR::Opcode::LogicalXor:
+    case IR::Opcode::IEqual:
+    case IR::Opcode::INotEqual:
+    case IR::Opcode::SMin32:
+    case IR::Opcode::UMin32:
+    case IR::Opcode::SMax32:
+    case IR::Opcode::UMax32:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t HashValue(const IR::Value& value) {
+    size_t payload{};
+    if (!value.IsImmediate()) {
+        payload = reinterpret_cast<size_t>(value.Inst());
+    } else {
+        switch (value.Type()) {
+        case IR::Type::U1:
+            payload = value.U1() ? 1 : 0;
+            break;
+        case IR::Type::U8:
+            payload = value.U8();
+            break;
+        case IR::Type::U16:
+            payload = value.U16();
+            break;
+        case IR::Type::U32:
+            payload = value.U32();
+            break;
+        case IR::Type::F32:
+            payload = Common::BitCast<u32>(value.F32());
+            break;
+        case IR::Type::U64:
+            payload = static_cast<size_t>(value.U64());
+            break;
+        case IR::Type::F64:
+            payload = static_cast<size_t>(Common::BitCast<u64>(value.F64()));
+            break;
+        case IR::Type::Reg:
+            payload = static_cast<size_t>(value.Reg());
+            break;
+        case IR::Type::Pred:
+            payload = static_cast<size_t>(value.Pred());
+            break;
+        case IR::Type::Attribute:
+            payload = static_cast<size_t>(value.Attribute());
+            break;
+        case IR::Type::Patch:
+            payload = static_cast<size_t>(value.Patch());
+            break;
+        default:
+            break;
+        }
+    }
+    return payload * 0x9E3779B97F4A7C15ULL ^ static_cast<size_t>(value.Type());
+}
+
+struct ValueKey {
+    IR::Opcode opcode{};
+    u32 flags{};
+    size_t num_args{};
+    std::array<IR::Value, 5> args{};
+
+    bool operator==(const ValueKey& other) const {
+        return opcode == other.opcode && flags == other.flags && num_args == other.num_args &&
+               std::equal(args.begin(), args.begin() + num_args, other.args.begin());
+    }
+};
+
+struct ValueKeyHash {
+    size_t operator()(const ValueKey& key) const noexcept {
+        size_t hash{static_cast<size_t>(key.opcode) * 31 + key.flags};
+        for (size_t index = 0; index < key.num_args; ++index) {
+            hash = (hash << 7 | hash >> (sizeof(size_t) * 8 - 7)) ^ HashValue(key.args[index]);
+        }
+        return hash;
+    }
+};
+
+ValueKey MakeKey(const IR::Inst& inst) {
+    ValueKey key{
+        .opcode = inst.GetOpcode(),
+        .flags = inst.Flags<u32>(),
+        .num_args = inst.NumArgs(),
+    };
+    for (size_t index = 0; index < key.num_args; ++index) {
+        key.args[index] = inst.Arg(index).Resolve();
+    }
+    if (IsCommutative(key.opcode) && HashValue(key.args[1]) < HashValue(key.args[0])) {
+        std::swap(key.args[0], key.args[1]);
+    }
+    return key;
+}
+
+struct DominatorTree {
+    /// Blocks in reverse post order, the entry block comes first
+    std::vector<IR::Block*> blocks;
+    std::vector<std::vector<size_t>> children;
+};
+
+size_t Intersect(std::span<const size_t> idoms, size_t lhs, size_t rhs) {
+    // Reverse post order indices grow away from the entry block
+    while (lhs != rhs) {
+        while (lhs > rhs) {
+            lhs = idoms[lhs];
+        }
+        while (rhs > lhs) {
+            rhs = idoms[rhs];
+        }
+    }
+    return lhs;
+}
+
+DominatorTree BuildDominatorTree(const IR::Program& program) {
+    constexpr size_t UNDEFINED = ~size_t{0};
+
+    DominatorTree tree;
+    tree.blocks.assign(program.post_order_blocks.rbegin(), program.post_order_blocks.rend());
+    const size_t num_blocks{tree.blocks.size()};
+    std::unordered_map<const IR::Block*, size_t> indices;
+    indices.reserve(num_blocks);
+    for (size_t index = 0; index < num_blocks; ++index) {
+        indices.emplace(tree.blocks[index], index);
+    }
+    std::vector<size_t> idoms(num_blocks, UNDEFINED);
+    if (num_blocks != 0) {
+        idoms[0] = 0;
+    }
+    bool changed{true};
+    while (changed) {
+        changed = false;
+        for (size_t index = 1; index < num_blocks; ++index) {
+            size_t new_idom{UNDEFINED};
+            for (const IR::Block* const pred : tree.blocks[index]->ImmPredecessors()) {
+                const auto it{indices.find(pred)};
+                if (it == indices.end() || idoms[it->second] == UNDEFINED) {
+                    continue;
+                }
+                new_idom = new_idom == UNDEFINED ? it->second
+                                                 : Intersect(idoms, it->second, new_idom);
+            }
+            if (new_idom != idoms[index]) {
+                idoms[index] = new_idom;
+                changed = true;
+            }
+        }
+    }
+    tree.children.resize(num_blocks);
+    for (size_t index = 1; index < num_blocks; ++index) {
+        if (idoms[index] != UNDEFINED) {
+            tree.children[idoms[index]].push_back(index);
+        }
+    }
+    return tree;
+}
+
+/// Rewrites arguments referencing identities and removes the given instructions once unused
+void RemoveRedundantInstructions(IR::Program& program,
+                                 std::span<const std::pair<IR::Block*, IR::Inst*>> redundant) {
+    for (IR::Block* const block : program.blocks) {
+        for (IR::Inst& inst : block->Instructions()) {
+            const size_t num_args{inst.NumArgs()};
+            for (size_t index = 0; index < num_args; ++index) {
+                const IR::Value arg{inst.Arg(index)};
+                if (arg.IsIdentity()) {
+                    inst.SetArg(index, arg.Resolve());
+                }
+            }
+        }
+    }
+    for (const auto& [block, inst] : redundant) {
+        if (inst->HasUses()) {
+            continue;
+        }
+        block->Instructions().erase(IR::Block::InstructionList::s_iterator_to(*inst));
+        inst->Invalidate();
+    }
+}
+
+/// Returns true when the instruction can be computed once before entering the loop
+bool IsLoopInvariant(const IR::Inst& inst, Stage stage,
+                     const std::unordered_map<const IR::Inst*, bool>& loop_insts) {
+    // Texture operations are expensive when speculated and depend on implicit derivatives
+    if (!IsPureValue(inst, stage) || IsTextureOperation(inst.GetOpcode())) {
+        return false;
+    }
+    const size_t num_args{inst.NumArgs()};
+    for (size_t index = 0; index < num_args; ++index) {
+        const IR::Value arg{inst.Arg(index).Resolve()};
+        if (arg.IsImmediate()) {
+            continue;
+        }
+        const auto it{loop_insts.find(arg.Inst())};
+        if (it != loop_insts.end() && !it->second) {
+            // Defined in the loop and not hoisted
+            return false;
+        }
+    }
+    return true;
+}
+} // Anonymous namespace
+
+void GlobalValueNumberingPass(IR::Program& program) {
+    const DominatorTree tree{BuildDominatorTree(program)};
+    if (tree.blocks.empty()) {
+        return;
+    }
+    std::unordered_map<ValueKey, IR::Inst*, ValueKeyHash> available;
+    std::vector<const ValueKey*> scope_keys;
+    std::vector<std::pair<IR::Block*, IR::Inst*>> redundant;
+
+    struct Frame {
+        size_t block_index;
+        size_t scope_begin;
+        size_t next_child;
+    };
+    std::vector<Frame> stack;
+    stack.push_back({0, 0, 0});
+    bool entering{true};
+    while (!stack.empty()) {
+        Frame& frame{stack.back()};
+        if (entering) {
+            frame.scope_begin = scope_keys.size();
+            IR::Block* const block{tree.blocks[frame.block_index]};
+            for (IR::Inst& inst : block->Instructions()) {
+                if (!IsPureValue(inst, program.stage)) {
+                    continue;
+                }
+                const auto [it, is_new]{available.try_emplace(MakeKey(inst), &inst)};
+                if (is_new) {
+                    scope_keys.push_back(&it->first);
+                } else {
+                    inst.ReplaceUsesWith(IR::Value{it->second});
+                    redundant.emplace_back(block, &inst);
+                }
+            }
+        }
+        const std::vector<size_t>& children{tree.children[frame.block_index]};
+        if (frame.next_child < children.size()) {
+            const size_t child{children[frame.next_child++]};
+            stack.push_back({child, 0, 0});
+            entering = true;
+            continue;
+        }
+        // Values of this block are not available to its siblings in the dominator tree
+        while (scope_keys.size() > frame.scope_begin) {
+            available.erase(available.find(*scope_keys.back()));
+            scope_keys.pop_back();
+        }
+        stack.pop_back();
+        entering = false;
+    }
+    if (redundant.empty()) {
+        return;
+    }
+    RemoveRedundantInstructions(program, redundant);
+    LOG_DEBUG(Shader, "Value numbering removed {} redundant instructions", redundant.size());
+}
+
+void LoopInvariantCodeMotionPass(IR::Program& program) {
+    size_t num_hoisted{};
+    std::vector<size_t> loop_begins;
+    const IR::AbstractSyntaxList& syntax_list{program.syntax_list};
+    for (size_t node_index = 0; node_index < syntax_list.size(); ++node_index) {
+        const IR::AbstractSyntaxNode& node{syntax_list[node_index]};
+        if (node.type == IR::AbstractSyntaxNode::Type::Loop) {
+            loop_begins.push_back(node_index);
+            continue;
+        }
+        if (node.type != IR::AbstractSyntaxNode::Type::Repeat || loop_begins.empty()) {
+            continue;
+        }
+        // Inner loops are closed first, so their invariants can move further out afterwards
+        const size_t loop_begin{loop_begins.back()};
+        loop_begins.pop_back();
+
+        IR::Block* const header{node.data.repeat.loop_header};
+        std::vector<IR::Block*> loop_blocks{header};
+        // Blocks run on every iteration, hoisting from them never speculates an instruction
+        std::vector<IR::Block*> hoist_blocks{header};
+        size_t if_depth{};
+        size_t loop_depth{};
+        bool may_exit{};
+        for (size_t index = loop_begin + 1; index < node_index; ++index) {
+            const IR::AbstractSyntaxNode& child{syntax_list[index]};
+            switch (child.type) {
+            case IR::AbstractSyntaxNode::Type::Block:
+                loop_blocks.push_back(child.data.block);
+                if (if_depth == 0 && loop_depth == 0 && !may_exit) {
+                    hoist_blocks.push_back(child.data.block);
+                }
+                break;
+            case IR::AbstractSyntaxNode::Type::If:
+                ++if_depth;
+                break;
+            case IR::AbstractSyntaxNode::Type::EndIf:
+                --if_depth;
+                break;
+            case IR::AbstractSyntaxNode::Type::Loop:
+                ++loop_depth;
+                break;
+            case IR::AbstractSyntaxNode::Type::Repeat:
+                --loop_depth;
+                break;
+            case IR::AbstractSyntaxNode::Type::Break:
+                may_exit |= loop_depth == 0;
+                break;
+            case IR::AbstractSyntaxNode::Type::Return:
+            case IR::AbstractSyntaxNode::Type::Unreachable:
+                may_exit = true;
+                break;
+            }
+        }
+        // Instructions can only be hoisted to a block that unconditionally enters the loop
+        IR::Block* preheader{};
+        bool has_single_entry{true};
+        for (IR::Block* const pred : header->ImmPredecessors()) {
+            if (std::ranges::find(loop_blocks, pred) != loop_blocks.end()) {
+                continue;
+            }
+            has_single_entry = preheader == nullptr;
+            preheader = pred;
+        }
+        if (!has_single_entry || !preheader || preheader->ImmSuccessors().size() != 1) {
+            continue;
+        }
+        std::unordered_map<const IR::Inst*, bool> loop_insts;
+        for (IR::Block* const block : loop_blocks) {
+            for (const IR::Inst& inst : block->Instructions()) {
+                loop_insts.emplace(&inst, false);
+            }
+        }
+        // Blocks are visited in program order, definitions come before their uses
+        for (IR::Block* const block : hoist_blocks) {
+            for (auto it = block->begin(); it != block->end();) {
+                IR::Inst& inst{*it};
+                if (!IsLoopInvariant(inst, program.stage, loop_insts)) {
+                    ++it;
+                    continue;
+                }
+                it = block->Instructions().erase(it);
+                preheader->Instructions().push_back(inst);
+                loop_insts[&inst] = true;
+                ++num_hoisted;
+            }
+        }
+    }
+    if (num_hoisted != 0) {
+        LOG_DEBUG(Shader, "Hoisted {} loop invariant instructions", num_hoisted);
+    }
+}
+
+} // namespace Shader::Optimization
@@ -1,15 +1,22 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2016 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <atomic>
 #include <bitset>
 #include <chrono>
+#include <cstdio>
 #include <cstdlib>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -139,3 +146,96 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[UnscheduleHandle]", "[core]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    std::atomic<u32> fired{};
+    const auto event_type = Core::Timing::CreateEvent(
+        "counter", [&](s64, std::chrono::nanoseconds) -> std::optional<std::chrono::nanoseconds> {
+            ++fired;
+            return std::nullopt;
+        });
+
+    core_timing.SyncPause(true);
+    const auto kept = core_timing.ScheduleEvent(std::chrono::microseconds{10}, event_type);
+    const auto removed = core_timing.ScheduleEvent(std::chrono::microseconds{20}, event_type);
+    core_timing.UnscheduleEvent(removed);
+    // Far enough away to land in the upper levels of the wheel
+    const auto far = core_timing.ScheduleEvent(std::chrono::milliseconds{30}, event_type);
+    core_timing.Pause(false);
+
+    while (core_timing.HasPendingEvents())
+        ;
+
+    REQUIRE(fired == 2);
+    REQUIRE(!kept.IsPending());
+    REQUIRE(!removed.IsPending());
+    REQUIRE(!far.IsPending());
+}
+
+TEST_CASE("CoreTiming[UnscheduleLooping]", "[core]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    std::atomic<u32> fired{};
+    const auto event_type = Core::Timing::CreateEvent(
+        "looping", [&](s64, std::chrono::nanoseconds) -> std::optional<std::chrono::nanoseconds> {
+            ++fired;
+            return std::nullopt;
+        });
+
+    core_timing.SyncPause(false);
+    core_timing.ScheduleLoopingEvent(std::chrono::microseconds{1}, std::chrono::microseconds{50},
+                                     event_type);
+    while (fired < 4)
+        ;
+    core_timing.UnscheduleEvent(event_type);
+    const u32 fired_at_unschedule = fired;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    REQUIRE(fired == fired_at_unschedule);
+}
+
+TEST_CASE("CoreTiming[Contention]", "[.][benchmark][core]") {
+    static constexpr u32 num_threads = 4;
+    static constexpr u32 events_per_thread = 100000;
+
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    std::atomic<u32> fired{};
+    const auto event_type = Core::Timing::CreateEvent(
+        "contention", [&](s64, std::chrono::nanoseconds) -> std::optional<std::chrono::nanoseconds> {
+            ++fired;
+            return std::nullopt;
+        });
+
+    core_timing.SyncPause(false);
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::jthread> threads;
+    for (u32 thread = 0; thread < num_threads; ++thread) {
+        threads.emplace_back([&core_timing, &event_type, thread] {
+            for (u32 i = 0; i < events_per_thread; ++i) {
+                // Spread over a few milliseconds so every level of the wheel is exercised
+                const auto delay = std::chrono::nanoseconds{((i * 7919 + thread) % 4096) * 1000};
+                const auto handle = core_timing.ScheduleEvent(delay, event_type);
+                if (i % 8 == 0) {
+                    core_timing.UnscheduleEvent(handle, Core::Timing::UnscheduleEventType::NoWait);
+                }
+            }
+        });
+    }
+    threads.clear();
+    const std::chrono::duration<double, std::micro> schedule_time =
+        std::chrono::steady_clock::now() - start;
+
+    while (core_timing.HasPendingEvents())
+        ;
+    const std::chrono::duration<double, std::micro> total_time =
+        std::chrono::steady_clock::now() - start;
+
+    REQUIRE(fired == num_threads * events_per_thread / 8 * 7);
+    std::printf("CoreTiming Contention: %u threads, %.1f ns/schedule, %.3f ms total\n",
+                num_threads,
+                schedule_time.count() * 1000.0 / (num_threads * events_per_thread),
+                total_time.count() / 1000.0);
+}
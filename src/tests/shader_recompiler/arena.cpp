@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "shader_recompiler/arena.h"
+
+namespace {
+using namespace Shader;
+
+bool IsAligned(const void* pointer, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+} // Anonymous namespace
+
+TEST_CASE("Arena: Allocations are aligned and reused after a reset", "[shader_recompiler]") {
+    Arena arena{256};
+    u8* const first{static_cast<u8*>(arena.Allocate(1, 1))};
+    void* const aligned{arena.Allocate(8, 8)};
+    REQUIRE(IsAligned(aligned, 8));
+    REQUIRE(aligned == first + 8);
+    REQUIRE(IsAligned(arena.Allocate(16, 16), 16));
+
+    arena.Reset();
+    REQUIRE(arena.Allocate(1, 1) == first);
+}
+
+TEST_CASE("Arena: Chunks are squashed on reset", "[shader_recompiler]") {
+    Arena arena{64};
+    for (int i = 0; i < 4; ++i) {
+        (void)arena.Allocate(48, 1);
+    }
+    // Larger than a chunk
+    REQUIRE(IsAligned(arena.Allocate(256, 8), 8));
+    arena.Reset();
+
+    // The same allocations fit contiguously in a single chunk now
+    u8* const first{static_cast<u8*>(arena.Allocate(48, 1))};
+    for (int i = 1; i < 4; ++i) {
+        REQUIRE(arena.Allocate(48, 1) == first + 48 * i);
+    }
+}
+
+TEST_CASE("Arena: Containers use the arena of the current scope", "[shader_recompiler]") {
+    Arena arena;
+    REQUIRE(CurrentArena() == nullptr);
+    {
+        const ArenaScope scope{&arena};
+        REQUIRE(CurrentArena() == &arena);
+
+        ArenaVector<int> vector;
+        vector.push_back(1);
+        REQUIRE(vector.get_allocator() == ArenaAllocator<int>{&arena});
+
+        ArenaUnorderedMap<int, int> map;
+        map.emplace(1, 2);
+        REQUIRE(map.at(1) == 2);
+        {
+            const ArenaScope heap_scope{nullptr};
+            const ArenaVector<int> heap_vector{1, 2, 3};
+            REQUIRE(heap_vector.get_allocator() == ArenaAllocator<int>{nullptr});
+        }
+        REQUIRE(CurrentArena() == &arena);
+    }
+    REQUIRE(CurrentArena() == nullptr);
+}
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/ir_emitter.h"
+#include "shader_recompiler/frontend/ir/post_order.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/object_pool.h"
+
+namespace {
+using namespace Shader;
+
+struct Pools {
+    ObjectPool<IR::Inst> inst;
+    ObjectPool<IR::Block> block;
+};
+
+void AddBlockNode(IR::Program& program, IR::Block* block) {
+    auto& node{program.syntax_list.emplace_back()};
+    node.type = IR::AbstractSyntaxNode::Type::Block;
+    node.data.block = block;
+    program.blocks.push_back(block);
+}
+
+void Finish(IR::Program& program) {
+    program.syntax_list.emplace_back().type = IR::AbstractSyntaxNode::Type::Return;
+    program.post_order_blocks = IR::PostOrder(program.syntax_list.front());
+    program.stage = Stage::VertexB;
+}
+
+size_t CountOpcode(const IR::Program& program, IR::Opcode opcode) {
+    size_t count{};
+    for (const IR::Block* const block : program.blocks) {
+        count += std::ranges::count_if(block->Instructions(), [opcode](const IR::Inst& inst) {
+            return inst.GetOpcode() == opcode;
+        });
+    }
+    return count;
+}
+
+size_t CountOpcode(const IR::Block& block, IR::Opcode opcode) {
+    return std::ranges::count_if(block.Instructions(), [opcode](const IR::Inst& inst) {
+        return inst.GetOpcode() == opcode;
+    });
+}
+
+void Output(IR::IREmitter& ir, IR::Attribute attribute, const IR::U32& value) {
+    ir.SetAttribute(attribute, ir.BitCast<IR::F32>(value), ir.Imm32(0));
+}
+} // Anonymous namespace
+
+TEST_CASE("GlobalValueNumbering: Redundant values in a block", "[shader_recompiler]") {
+    Pools pools;
+    IR::Program program;
+    IR::Block* const block{pools.block.Create(pools.inst)};
+    AddBlockNode(program, block);
+    Finish(program);
+
+    IR::IREmitter ir{*block};
+    const IR::U32 a{ir.GetCbuf(ir.Imm32(0), ir.Imm32(16))};
+    const IR::U32 b{ir.GetCbuf(ir.Imm32(0), ir.Imm32(16))};
+    const IR::U32 c{ir.GetCbuf(ir.Imm32(0), ir.Imm32(20))};
+    Output(ir, IR::Attribute::PositionX, IR::U32{ir.IAdd(a, c)});
+    Output(ir, IR::Attribute::PositionY, IR::U32{ir.IAdd(c, b)});
+    Output(ir, IR::Attribute::PositionZ, ir.LoadLocal(ir.Imm32(0)));
+    Output(ir, IR::Attribute::PositionW, ir.LoadLocal(ir.Imm32(0)));
+
+    Optimization::GlobalValueNumberingPass(program);
+
+    REQUIRE(CountOpcode(program, IR::Opcode::GetCbufU32) == 2);
+    // Commutative operations are numbered regardless of the order of their operands
+    REQUIRE(CountOpcode(program, IR::Opcode::IAdd32) == 1);
+    // Loads from memory the shader can write are kept
+    REQUIRE(CountOpcode(program, IR::Opcode::LoadLocal) == 2);
+    REQUIRE(CountOpcode(program, IR::Opcode::Identity) == 0);
+    REQUIRE(CountOpcode(program, IR::Opcode::SetAttribute) == 4);
+}
+
+TEST_CASE("GlobalValueNumbering: Values only flow to dominated blocks", "[shader_recompiler]") {
+    Pools pools;
+    IR::Program program;
+    IR::Block* const entry{pools.block.Create(pools.inst)};
+    IR::Block* const then_block{pools.block.Create(pools.inst)};
+    IR::Block* const merge{pools.block.Create(pools.inst)};
+    entry->AddBranch(then_block);
+    entry->AddBranch(merge);
+    then_block->AddBranch(merge);
+    AddBlockNode(program, entry);
+    AddBlockNode(program, then_block);
+    AddBlockNode(program, merge);
+    Finish(program);
+
+    IR::IREmitter entry_ir{*entry};
+    const IR::U32 entry_value{entry_ir.GetCbuf(entry_ir.Imm32(1), entry_ir.Imm32(0))};
+    Output(entry_ir, IR::Attribute::PositionX, entry_value);
+
+    IR::IREmitter then_ir{*then_block};
+    Output(then_ir, IR::Attribute::PositionY,
+           then_ir.GetCbuf(then_ir.Imm32(1), then_ir.Imm32(0)));
+    Output(then_ir, IR::Attribute::PositionZ,
+           then_ir.GetCbuf(then_ir.Imm32(2), then_ir.Imm32(0)));
+
+    IR::IREmitter merge_ir{*merge};
+    Output(merge_ir, IR::Attribute::PositionW,
+           merge_ir.GetCbuf(merge_ir.Imm32(2), merge_ir.Imm32(0)));
+
+    Optimization::GlobalValueNumberingPass(program);
+
+    // The entry block dominates both blocks, the conditional block does not dominate the merge
+    REQUIRE(CountOpcode(*entry, IR::Opcode::GetCbufU32) == 1);
+    REQUIRE(CountOpcode(*then_block, IR::Opcode::GetCbufU32) == 1);
+    REQUIRE(CountOpcode(*merge, IR::Opcode::GetCbufU32) == 1);
+}
+
+TEST_CASE("LoopInvariantCodeMotion: Hoist invariant values", "[shader_recompiler]") {
+    Pools pools;
+    IR::Program program;
+    IR::Block* const preheader{pools.block.Create(pools.inst)};
+    IR::Block* const header{pools.block.Create(pools.inst)};
+    IR::Block* const body{pools.block.Create(pools.inst)};
+    IR::Block* const conditional{pools.block.Create(pools.inst)};
+    IR::Block* const continue_block{pools.block.Create(pools.inst)};
+    IR::Block* const merge{pools.block.Create(pools.inst)};
+    preheader->AddBranch(header);
+    header->AddBranch(body);
+    body->AddBranch(conditional);
+    body->AddBranch(continue_block);
+    conditional->AddBranch(continue_block);
+    continue_block->AddBranch(header);
+    continue_block->AddBranch(merge);
+
+    IR::IREmitter ir{*body};
+    const IR::U1 condition{
+        ir.FPEqual(ir.GetAttribute(IR::Attribute::PositionX), ir.Imm32(0.0f))};
+
+    AddBlockNode(program, preheader);
+    AddBlockNode(program, header);
+    auto& loop{program.syntax_list.emplace_back()};
+    loop.type = IR::AbstractSyntaxNode::Type::Loop;
+    loop.data.loop = {.body = body, .continue_block = continue_block, .merge = merge};
+    AddBlockNode(program, body);
+    auto& if_node{program.syntax_list.emplace_back()};
+    if_node.type = IR::AbstractSyntaxNode::Type::If;
+    if_node.data.if_node = {.cond = condition, .body = conditional, .merge = continue_block};
+    AddBlockNode(program, conditional);
+    auto& end_if{program.syntax_list.emplace_back()};
+    end_if.type = IR::AbstractSyntaxNode::Type::EndIf;
+    end_if.data.end_if.merge = continue_block;
+    AddBlockNode(program, continue_block);
+    auto& repeat{program.syntax_list.emplace_back()};
+    repeat.type = IR::AbstractSyntaxNode::Type::Repeat;
+    repeat.data.repeat = {.cond = condition, .loop_header = header, .merge = merge};
+    AddBlockNode(program, merge);
+    Finish(program);
+
+    const IR::U32 invariant{ir.IAdd(ir.GetCbuf(ir.Imm32(0), ir.Imm32(0)), ir.Imm32(4))};
+    const IR::U32 variant{ir.IAdd(ir.LoadLocal(ir.Imm32(0)), invariant)};
+    ir.WriteLocal(ir.Imm32(0), variant);
+
+    IR::IREmitter conditional_ir{*conditional};
+    Output(conditional_ir, IR::Attribute::PositionY,
+           conditional_ir.GetCbuf(conditional_ir.Imm32(3), conditional_ir.Imm32(0)));
+
+    Optimization::LoopInvariantCodeMotionPass(program);
+
+    REQUIRE(CountOpcode(*preheader, IR::Opcode::GetCbufU32) == 1);
+    REQUIRE(CountOpcode(*preheader, IR::Opcode::IAdd32) == 1);
+    REQUIRE(CountOpcode(*body, IR::Opcode::IAdd32) == 1);
+    REQUIRE(CountOpcode(*body, IR::Opcode::LoadLocal) == 1);
+    // Values computed under a condition of the loop are not speculated
+    REQUIRE(CountOpcode(*conditional, IR::Opcode::GetCbufU32) == 1);
+}
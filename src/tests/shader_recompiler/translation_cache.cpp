@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "shader_recompiler/environment.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/object_pool.h"
+
+namespace {
+using namespace Shader;
+
+class CodeEnvironment final : public Environment {
+public:
+    explicit CodeEnvironment(u32 local_memory_size_) : local_memory_size{local_memory_size_} {
+        stage = Stage::Compute;
+        // S2R R0, SR_TID.X
+        code[8] = (0xF0C8ULL << 48) | (33ULL << 20) | (7ULL << 16);
+        // ISETP.EQ.U32.AND P0, PT, R0, RZ, PT
+        code[16] = (0x5B6ULL << 52) | (2ULL << 49) | (7ULL << 39) | (255ULL << 20) | (7ULL << 16) |
+                   7ULL;
+        // @P0 EXIT
+        code[24] = 0xE30000000000000FULL;
+        // STS.32 [0x10], R0
+        code[40] = (0xEF58ULL << 48) | (4ULL << 48) | (0x10ULL << 20) | (7ULL << 16) | (255ULL << 8);
+        // EXIT
+        code[48] = 0xE30000000007000FULL;
+    }
+
+    u64 ReadInstruction(u32 address) override {
+        return code.at(address);
+    }
+    bool HasUnboundInstructions() const override {
+        return has_unbound_instructions;
+    }
+    u32 ReadCbufValue(u32, u32) override {
+        return 0;
+    }
+    TextureType ReadTextureType(u32) override {
+        return {};
+    }
+    TexturePixelFormat ReadTexturePixelFormat(u32) override {
+        return {};
+    }
+    bool IsTexturePixelFormatInteger(u32) override {
+        return false;
+    }
+    u32 ReadViewportTransformState() override {
+        return 0;
+    }
+    u32 TextureBoundBuffer() const override {
+        return 0;
+    }
+    u32 LocalMemorySize() const override {
+        return local_memory_size;
+    }
+    u32 SharedMemorySize() const override {
+        return 0x100;
+    }
+    std::array<u32, 3> WorkgroupSize() const override {
+        return {32, 1, 1};
+    }
+    bool HasHLEMacroState() const override {
+        return false;
+    }
+    std::optional<ReplaceConstant> GetReplaceConstBuffer(u32, u32) override {
+        return std::nullopt;
+    }
+    void Dump(u64, u64) override {}
+
+    bool has_unbound_instructions = false;
+
+private:
+    std::map<u32, u64> code;
+    u32 local_memory_size;
+};
+
+struct Pools {
+    ObjectPool<IR::Inst> inst;
+    ObjectPool<IR::Block> block;
+    ObjectPool<Maxwell::Flow::Block> flow_block;
+};
+
+std::vector<IR::Opcode> Opcodes(const IR::Program& program) {
+    std::vector<IR::Opcode> opcodes;
+    for (const IR::Block* const block : program.blocks) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            opcodes.push_back(inst.GetOpcode());
+        }
+    }
+    return opcodes;
+}
+
+bool SharesBlocks(const IR::Program& lhs, const IR::Program& rhs) {
+    for (const IR::Block* const block : lhs.blocks) {
+        if (std::ranges::find(rhs.blocks, block) != rhs.blocks.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+constexpr u64 CODE_HASH = 0x0123456789abcdefULL;
+} // Anonymous namespace
+
+TEST_CASE("TranslationCache: Reuse programs with the same code", "[shader_recompiler]") {
+    Pools pools;
+    const HostTranslateInfo host_info{};
+    CodeEnvironment env{0};
+    Maxwell::Flow::CFG cfg{env, pools.flow_block, 0};
+    const IR::Program reference{
+        Maxwell::TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
+
+    Maxwell::TranslationCache cache;
+    const IR::Program first{cache.Translate(pools.inst, pools.block, pools.flow_block, env,
+                                            CODE_HASH, 0, false, host_info)};
+    const IR::Program second{cache.Translate(pools.inst, pools.block, pools.flow_block, env,
+                                             CODE_HASH, 0, false, host_info)};
+
+    const auto statistics{cache.GetStatistics()};
+    REQUIRE(statistics.misses == 1);
+    REQUIRE(statistics.hits == 1);
+    REQUIRE(Opcodes(first) == Opcodes(reference));
+    REQUIRE(Opcodes(second) == Opcodes(reference));
+    REQUIRE(second.blocks.size() == reference.blocks.size());
+    REQUIRE(second.post_order_blocks.size() == reference.post_order_blocks.size());
+    REQUIRE(!SharesBlocks(first, second));
+}
+
+TEST_CASE("TranslationCache: Decoding inputs are part of the key", "[shader_recompiler]") {
+    Pools pools;
+    const HostTranslateInfo host_info{};
+    CodeEnvironment env{0};
+    CodeEnvironment local_memory_env{0x40};
+
+    Maxwell::TranslationCache cache;
+    (void)cache.Translate(pools.inst, pools.block, pools.flow_block, env, CODE_HASH, 0, false,
+                          host_info);
+    (void)cache.Translate(pools.inst, pools.block, pools.flow_block, local_memory_env, CODE_HASH,
+                          0, false, host_info);
+    (void)cache.Translate(pools.inst, pools.block, pools.flow_block, env, CODE_HASH, 0, true,
+                          host_info);
+    REQUIRE(cache.GetStatistics().misses == 3);
+
+    cache.Clear();
+    (void)cache.Translate(pools.inst, pools.block, pools.flow_block, env, CODE_HASH, 0, false,
+                          host_info);
+    REQUIRE(cache.GetStatistics().misses == 4);
+    REQUIRE(cache.GetStatistics().hits == 0);
+}
+
+TEST_CASE("TranslationCache: Programs reading unbound instructions are not cached",
+          "[shader_recompiler]") {
+    Pools pools;
+    const HostTranslateInfo host_info{};
+    CodeEnvironment env{0};
+    env.has_unbound_instructions = true;
+
+    Maxwell::TranslationCache cache;
+    (void)cache.Translate(pools.inst, pools.block, pools.flow_block, env, CODE_HASH, 0, false,
+                          host_info);
+    (void)cache.Translate(pools.inst, pools.block, pools.flow_block, env, CODE_HASH, 0, false,
+                          host_info);
+    const auto statistics{cache.GetStatistics()};
+    REQUIRE(statistics.uncacheable == 2);
+    REQUIRE(statistics.misses == 0);
+    REQUIRE(statistics.hits == 0);
+}
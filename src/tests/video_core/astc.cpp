@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/cityhash.h"
+#include "common/common_types.h"
+#include "video_core/textures/astc.h"
+
+namespace {
+
+struct Footprint {
+    u32 width;
+    u32 height;
+};
+
+constexpr std::array FOOTPRINTS{
+    Footprint{4, 4},   Footprint{5, 5},  Footprint{6, 6},   Footprint{8, 5},
+    Footprint{8, 8},   Footprint{10, 6}, Footprint{10, 10}, Footprint{12, 12},
+};
+
+constexpr std::array<u32, 10> LDR_ENDPOINT_MODES{0, 1, 4, 5, 6, 8, 9, 10, 12, 13};
+
+class BlockWriter {
+public:
+    explicit BlockWriter(std::mt19937_64& rng) : words{rng(), rng()} {}
+
+    void Write(u32 offset, u32 num_bits, u64 value) {
+        for (u32 bit = 0; bit < num_bits; ++bit) {
+            const u32 position = offset + bit;
+            u64& word = words[position / 64];
+            const u64 mask = u64{1} << (position % 64);
+            word = ((value >> bit) & 1) != 0 ? word | mask : word & ~mask;
+        }
+    }
+
+    void Store(std::vector<u8>& out) const {
+        const auto* const bytes = reinterpret_cast<const u8*>(words.data());
+        out.insert(out.end(), bytes, bytes + 16);
+    }
+
+private:
+    std::array<u64, 2> words;
+};
+
+u32 WeightBitLength(u32 max_weight, u32 count) {
+    switch (max_weight) {
+    case 1:
+        return count;
+    case 2:
+        return (count * 8 + 4) / 5;
+    case 3:
+        return count * 2;
+    case 4:
+        return (count * 7 + 2) / 3;
+    case 5:
+        return count + (count * 8 + 4) / 5;
+    case 7:
+        return count * 3;
+    case 9:
+        return count + (count * 7 + 2) / 3;
+    case 11:
+        return count * 2 + (count * 8 + 4) / 5;
+    case 15:
+        return count * 4;
+    case 19:
+        return count * 2 + (count * 7 + 2) / 3;
+    case 23:
+        return count * 3 + (count * 8 + 4) / 5;
+    default:
+        return count * 5;
+    }
+}
+
+/// Generates a random block that follows the LDR profile of the specification.
+void GenerateBlock(std::mt19937_64& rng, Footprint footprint, std::vector<u8>& out) {
+    BlockWriter block{rng};
+    if (rng() % 16 == 0) {
+        // Void extent with random constant color
+        block.Write(0, 12, 0xDFC);
+        block.Write(12, 52, ~u64{0});
+        block.Store(out);
+        return;
+    }
+    while (true) {
+        // Weight grid layouts 0, 1 and 4 of table C.2.8
+        const u32 layout = static_cast<u32>(rng() % 3);
+        const u32 a = static_cast<u32>(rng() % 4);
+        const u32 b = static_cast<u32>(rng() % (layout == 2 ? 2 : 4));
+        const u32 r = 2 + static_cast<u32>(rng() % 6);
+        const bool high_precision = rng() % 2 != 0;
+        const bool dual_plane = rng() % 4 == 0;
+        const u32 grid_width = layout == 0 ? b + 4 : (layout == 1 ? b + 8 : b + 2);
+        const u32 grid_height = a + 2;
+        const u32 layout_bits = layout == 0 ? 0b0000 : (layout == 1 ? 0b0100 : 0b1100);
+        const u32 mode = (r >> 1) | layout_bits | ((r & 1) << 4) | (a << 5) | (b << 7) |
+                         (layout == 2 ? 1U << 8 : 0U) | (high_precision ? 1U << 9 : 0U) |
+                         (dual_plane ? 1U << 10 : 0U);
+
+        static constexpr std::array<u32, 6> low_weights{1, 2, 3, 4, 5, 7};
+        static constexpr std::array<u32, 6> high_weights{9, 11, 15, 19, 23, 31};
+        const u32 max_weight = high_precision ? high_weights[r - 2] : low_weights[r - 2];
+        const u32 num_weights = grid_width * grid_height * (dual_plane ? 2 : 1);
+        const u32 weight_bits = WeightBitLength(max_weight, num_weights);
+        if (grid_width > footprint.width || grid_height > footprint.height || num_weights > 64 ||
+            weight_bits < 24 || weight_bits > 96) {
+            continue;
+        }
+
+        const u32 num_partitions = 1 + static_cast<u32>(rng() % (dual_plane ? 3 : 4));
+        const u32 endpoint_mode = LDR_ENDPOINT_MODES[rng() % LDR_ENDPOINT_MODES.size()];
+        const u32 num_values = num_partitions * ((endpoint_mode >> 2) + 1) * 2;
+        const u32 header_bits = num_partitions == 1 ? 17 : 29;
+        const s32 color_bits = 128 - static_cast<s32>(weight_bits + header_bits) -
+                               (dual_plane ? 2 : 0);
+        // Require at least the smallest color range allowed by the specification
+        if (color_bits < static_cast<s32>(num_values + (num_values * 8 + 4) / 5)) {
+            continue;
+        }
+
+        block.Write(0, 11, mode);
+        block.Write(11, 2, num_partitions - 1);
+        if (num_partitions == 1) {
+            block.Write(13, 4, endpoint_mode);
+        } else {
+            block.Write(23, 6, endpoint_mode << 2);
+        }
+        block.Store(out);
+        return;
+    }
+}
+
+std::vector<u8> GenerateCorpus(Footprint footprint, u32 blocks_x, u32 blocks_y, u64 seed) {
+    std::mt19937_64 rng{seed};
+    std::vector<u8> corpus;
+    corpus.reserve(blocks_x * blocks_y * 16);
+    for (u32 block = 0; block < blocks_x * blocks_y; ++block) {
+        GenerateBlock(rng, footprint, corpus);
+    }
+    return corpus;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("ASTC: Decoder matches reference corpus", "[video_core]") {
+    // These results were built against the previous scalar decoder.
+    static constexpr std::array<u64, FOOTPRINTS.size()> expected_hashes{
+        0x56a71321d5041136, 0xb6d3091c2c9c4c33, 0x88987395fbbbef08, 0x16b5b00d73c2f919,
+        0x2d45dc5afd7add2b, 0x5de0246b13f2ce8d, 0x8e5d5f2a9fb1bf93, 0x9978908581c4be38,
+    };
+    for (size_t i = 0; i < FOOTPRINTS.size(); ++i) {
+        const Footprint footprint = FOOTPRINTS[i];
+        static constexpr u32 blocks_x = 24;
+        static constexpr u32 blocks_y = 16;
+        const std::vector<u8> corpus = GenerateCorpus(footprint, blocks_x, blocks_y, i);
+
+        // Leave a partial column and row of blocks to cover the clipping path
+        const u32 width = blocks_x * footprint.width - 1;
+        const u32 height = blocks_y * footprint.height - 2;
+        std::vector<u8> output(width * height * 4);
+        Tegra::Texture::ASTC::Decompress(corpus, width, height, 1, footprint.width,
+                                         footprint.height, output);
+
+        const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(output.data()),
+                                            output.size());
+        REQUIRE(hash == expected_hashes[i]);
+    }
+}
+
+TEST_CASE("ASTC: Benchmark", "[.][benchmark][video_core]") {
+    static constexpr u32 width = 1024;
+    static constexpr u32 height = 1024;
+    static constexpr u32 iterations = 8;
+    std::vector<u8> output(width * height * 4);
+
+    for (const Footprint footprint : FOOTPRINTS) {
+        const u32 blocks_x = (width + footprint.width - 1) / footprint.width;
+        const u32 blocks_y = (height + footprint.height - 1) / footprint.height;
+        const std::vector<u8> corpus = GenerateCorpus(footprint, blocks_x, blocks_y, 1234);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (u32 i = 0; i < iterations; ++i) {
+            Tegra::Texture::ASTC::Decompress(corpus, width, height, 1, footprint.width,
+                                             footprint.height, output);
+        }
+        const std::chrono::duration<double, std::micro> elapsed =
+            std::chrono::steady_clock::now() - start;
+        std::printf("ASTC %ux%u: %.1f MTexels/s\n", footprint.width, footprint.height,
+                    static_cast<double>(width) * height * iterations / elapsed.count());
+    }
+}
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/device_memory.h"
+#include "video_core/buffer_cache/buffer_cache.h"
+#include "video_core/buffer_cache/memory_tracker_base.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
+
+namespace {
+using VideoCommon::BufferCopy;
+
+constexpr int STREAM_BUFFER = 1;
+constexpr int FALLBACK_BUFFER = 2;
+
+struct StagingRef {
+    int buffer;
+    u64 offset;
+    std::span<u8> mapped_span;
+};
+
+class Runtime;
+
+class Buffer : public VideoCommon::BufferBase {
+public:
+    explicit Buffer(Runtime&, VideoCommon::NullBufferParams null_params)
+        : BufferBase(null_params) {}
+
+    explicit Buffer(Runtime&, VAddr cpu_addr_, u64 size_bytes_)
+        : BufferBase(cpu_addr_, size_bytes_) {}
+
+    void MarkUsage(u64 offset, u64 size) noexcept {}
+};
+
+/// Records the copies and barriers the buffer cache asks for
+class Runtime {
+public:
+    StagingRef UploadStagingBuffer(size_t size) {
+        staging.resize(size);
+        return StagingRef{
+            .buffer = use_fallback ? FALLBACK_BUFFER : STREAM_BUFFER,
+            .offset = 0,
+            .mapped_span = staging,
+        };
+    }
+
+    bool CanReorderUpload(const Buffer& buffer, std::span<const BufferCopy> copies) {
+        return true;
+    }
+
+    bool CanReorderUploadFrom(const StagingRef& upload_staging) const {
+        return upload_staging.buffer == STREAM_BUFFER;
+    }
+
+    void CopyBuffer(Buffer& dst_buffer, int src_buffer, std::span<const BufferCopy> copies,
+                    bool barrier, bool can_reorder_upload = false) {
+        ++num_copies;
+    }
+
+    template <typename Copies>
+    void CopyBuffer(Buffer& dst_buffer, Buffer& src_buffer, const Copies& copies, bool barrier,
+                    bool can_reorder_upload = false) {}
+
+    void ClearBuffer(Buffer& dst_buffer, u32 offset, size_t size, u32 value) {}
+
+    void PreCopyBarrier() {
+        ++num_pre_barriers;
+    }
+
+    void PostCopyBarrier() {
+        ++num_post_barriers;
+    }
+
+    bool CanReportMemoryUsage() const {
+        return false;
+    }
+
+    u64 GetDeviceLocalMemory() const {
+        return 0;
+    }
+
+    bool use_fallback = false;
+    int num_copies = 0;
+    int num_pre_barriers = 0;
+    int num_post_barriers = 0;
+
+private:
+    std::vector<u8> staging;
+};
+
+struct BufferCacheParams {
+    using Runtime = ::Runtime;
+    using Buffer = ::Buffer;
+    using Async_Buffer = StagingRef;
+    using MemoryTracker = VideoCommon::MemoryTrackerBase<Tegra::MaxwellDeviceMemoryManager>;
+
+    static constexpr bool IS_OPENGL = false;
+    static constexpr bool HAS_PERSISTENT_UNIFORM_BUFFER_BINDINGS = false;
+    static constexpr bool HAS_FULL_INDEX_AND_PRIMITIVE_SUPPORT = false;
+    static constexpr bool NEEDS_BIND_UNIFORM_INDEX = false;
+    static constexpr bool NEEDS_BIND_STORAGE_INDEX = false;
+    static constexpr bool USE_MEMORY_MAPS = true;
+    static constexpr bool SEPARATE_IMAGE_BUFFER_BINDINGS = false;
+    static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = true;
+};
+
+using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
+
+/// Synchronizes two buffers inside an upload batch
+void UploadBatch(BufferCache& buffer_cache) {
+    buffer_cache.BeginUploadBatch();
+    for (const DAddr address : {0x100000ULL, 0x300000ULL}) {
+        (void)buffer_cache.ObtainCPUBuffer(address, 0x1000,
+                                           VideoCommon::ObtainBufferSynchronize::FullSynchronize,
+                                           VideoCommon::ObtainBufferOperation::DoNothing);
+    }
+    buffer_cache.EndUploadBatch();
+}
+} // Anonymous namespace
+
+TEST_CASE("BufferCache: Batched uploads skip barriers only from the stream buffer",
+          "[video_core]") {
+    Core::DeviceMemory device_memory;
+    Tegra::MaxwellDeviceMemoryManager device_memory_manager{device_memory};
+    Runtime runtime;
+
+    SECTION("Stream buffer") {
+        BufferCache buffer_cache{device_memory_manager, runtime};
+        UploadBatch(buffer_cache);
+        REQUIRE(runtime.num_copies == 2);
+        REQUIRE(runtime.num_pre_barriers == 0);
+        REQUIRE(runtime.num_post_barriers == 0);
+    }
+    SECTION("Fallback staging buffer") {
+        runtime.use_fallback = true;
+        BufferCache buffer_cache{device_memory_manager, runtime};
+        UploadBatch(buffer_cache);
+        REQUIRE(runtime.num_copies == 2);
+        REQUIRE(runtime.num_pre_barriers == 1);
+        REQUIRE(runtime.num_post_barriers == 1);
+    }
+}
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <functional>
+#include <span>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/core.h"
+#include "core/device_memory.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/memory_manager.h"
+#include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_null/null_rasterizer.h"
+#include "video_core/texture_cache/descriptor_table.h"
+#include "video_core/textures/texture.h"
+
+namespace {
+using DescriptorTable = VideoCommon::DescriptorTable<Tegra::Texture::TICEntry>;
+
+constexpr GPUVAddr TABLE_GPU_ADDR = 0x10000;
+constexpr DAddr TABLE_DEV_ADDR = 0x100000;
+constexpr DAddr OTHER_DEV_ADDR = 0x200000;
+constexpr size_t MAPPING_SIZE = 0x10000;
+constexpr u32 TABLE_LIMIT = 63;
+
+/// Forwards the notifications the texture cache receives to a single descriptor table
+class Rasterizer final : public VideoCore::RasterizerInterface {
+public:
+    explicit Rasterizer(DescriptorTable& table_) : table{table_} {}
+
+    void Draw(bool is_indexed, u32 instance_count) override {}
+    void DrawTexture() override {}
+    void Clear(u32 layer_count) override {}
+    void DispatchCompute() override {}
+    void ResetCounter(VideoCommon::QueryType type) override {}
+    void Query(GPUVAddr gpu_addr, VideoCommon::QueryType type,
+               VideoCommon::QueryPropertiesFlags flags, u32 payload, u32 subreport) override {}
+    void BindGraphicsUniformBuffer(size_t stage, u32 index, GPUVAddr gpu_addr, u32 size) override {}
+    void DisableGraphicsUniformBuffer(size_t stage, u32 index) override {}
+    void SignalFence(std::function<void()>&& func) override {}
+    void SyncOperation(std::function<void()>&& func) override {}
+    void SignalSyncPoint(u32 value) override {}
+    void SignalReference() override {}
+    void ReleaseFences(bool force) override {}
+    void FlushAll() override {}
+    void FlushRegion(DAddr addr, u64 size, VideoCommon::CacheType which) override {}
+    bool MustFlushRegion(DAddr addr, u64 size, VideoCommon::CacheType which) override {
+        return false;
+    }
+    VideoCore::RasterizerDownloadArea GetFlushArea(DAddr addr, u64 size) override {
+        return {addr, addr + size, false};
+    }
+    void InvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType which) override {
+        table.OnWrite(addr, size);
+    }
+    void OnCacheInvalidation(PAddr addr, u64 size) override {}
+    bool OnCPUWrite(PAddr addr, u64 size) override {
+        return false;
+    }
+    void InvalidateGPUCache() override {}
+    void UnmapMemory(DAddr addr, u64 size) override {
+        table.OnUnmap(addr, size);
+    }
+    void ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) override {
+        table.OnUnmapGPU(addr, size);
+    }
+    void FlushAndInvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType which) override {}
+    void WaitForIdle() override {}
+    void FragmentBarrier() override {}
+    void TiledCacheBarrier() override {}
+    void FlushCommands() override {}
+    void TickFrame() override {}
+    Tegra::Engines::AccelerateDMAInterface& AccessAccelerateDMA() override {
+        return accelerate_dma;
+    }
+    void AccelerateInlineToMemory(GPUVAddr address, size_t copy_size,
+                                  std::span<const u8> memory) override {}
+
+private:
+    DescriptorTable& table;
+    Null::AccelerateDMA accelerate_dma;
+};
+} // Anonymous namespace
+
+TEST_CASE("DescriptorTable: Tracked descriptors are only read again when stale",
+          "[video_core]") {
+    Core::System system;
+    Core::DeviceMemory device_memory;
+    Tegra::MaxwellDeviceMemoryManager device_memory_manager{device_memory};
+    Tegra::MemoryManager memory_manager{system, device_memory_manager, 32};
+    DescriptorTable table{memory_manager};
+    Rasterizer rasterizer{table};
+    memory_manager.BindRasterizer(&rasterizer);
+    memory_manager.Map(TABLE_GPU_ADDR, TABLE_DEV_ADDR, MAPPING_SIZE);
+
+    REQUIRE(table.Synchronize(TABLE_GPU_ADDR, TABLE_LIMIT));
+    REQUIRE(!table.IsTracked());
+    (void)table.Read(1);
+    REQUIRE(!table.IsDescriptorClean(1));
+
+    table.UpdateTracking(device_memory_manager);
+    REQUIRE(table.IsTracked());
+    (void)table.Read(1);
+    (void)table.Read(2);
+    REQUIRE(table.IsDescriptorClean(1));
+    REQUIRE(table.IsDescriptorClean(2));
+
+    SECTION("Writes dirty the descriptors they overlap") {
+        const DAddr descriptor_2 = TABLE_DEV_ADDR + 2 * sizeof(Tegra::Texture::TICEntry);
+        memory_manager.InvalidateRegion(TABLE_GPU_ADDR + 2 * sizeof(Tegra::Texture::TICEntry), 4);
+        REQUIRE(table.IsDescriptorClean(1));
+        REQUIRE(!table.IsDescriptorClean(2));
+        (void)table.Read(2);
+        REQUIRE(table.IsDescriptorClean(2));
+
+        table.OnWrite(descriptor_2 - 4, 8);
+        REQUIRE(!table.IsDescriptorClean(1));
+        REQUIRE(!table.IsDescriptorClean(2));
+    }
+    SECTION("Remapping the table to other memory untracks it") {
+        memory_manager.Map(TABLE_GPU_ADDR, OTHER_DEV_ADDR, MAPPING_SIZE);
+        REQUIRE(!table.IsTracked());
+        REQUIRE(!table.IsDescriptorClean(1));
+        (void)table.Read(1);
+        REQUIRE(!table.IsDescriptorClean(1));
+    }
+    SECTION("Mapping the same memory again keeps the table tracked") {
+        memory_manager.Map(TABLE_GPU_ADDR, TABLE_DEV_ADDR, MAPPING_SIZE);
+        REQUIRE(table.IsTracked());
+        REQUIRE(table.IsDescriptorClean(1));
+    }
+    SECTION("Revalidation reads descriptors written without a notification") {
+        table.Revalidate();
+        REQUIRE(table.IsTracked());
+        REQUIRE(!table.IsDescriptorClean(1));
+        REQUIRE(!table.IsDescriptorClean(2));
+        (void)table.Read(1);
+        REQUIRE(table.IsDescriptorClean(1));
+    }
+}
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/core.h"
+#include "core/device_memory.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/macro/macro.h"
+#include "video_core/macro/macro_synthesis.h"
+#include "video_core/memory_manager.h"
+
+namespace {
+using namespace Tegra::Macro;
+
+u32 AddImmediate(u32 dst, u32 src_a, s32 immediate,
+                 ResultOperation result_operation = ResultOperation::Move, bool is_exit = false) {
+    Opcode opcode{};
+    opcode.operation.Assign(Operation::AddImmediate);
+    opcode.result_operation.Assign(result_operation);
+    opcode.dst.Assign(dst);
+    opcode.src_a.Assign(src_a);
+    opcode.immediate.Assign(immediate);
+    opcode.is_exit.Assign(is_exit ? 1 : 0);
+    return opcode.raw;
+}
+
+u32 ALU(ALUOperation operation, u32 dst, u32 src_a, u32 src_b,
+        ResultOperation result_operation = ResultOperation::Move, bool is_exit = false) {
+    Opcode opcode{};
+    opcode.operation.Assign(Operation::ALU);
+    opcode.alu_operation.Assign(operation);
+    opcode.result_operation.Assign(result_operation);
+    opcode.dst.Assign(dst);
+    opcode.src_a.Assign(src_a);
+    opcode.src_b.Assign(src_b);
+    opcode.is_exit.Assign(is_exit ? 1 : 0);
+    return opcode.raw;
+}
+
+u32 Branch(BranchCondition condition, u32 src_a, s32 offset, bool annul) {
+    Opcode opcode{};
+    opcode.operation.Assign(Operation::Branch);
+    opcode.branch_condition.Assign(condition);
+    opcode.branch_annul.Assign(annul ? 1 : 0);
+    opcode.src_a.Assign(src_a);
+    opcode.immediate.Assign(offset);
+    return opcode.raw;
+}
+} // Anonymous namespace
+
+TEST_CASE("MacroSynthesis[straight_line]", "[video_core]") {
+    const std::array code{
+        AddImmediate(0, 0, 0x234 | (1 << 12), ResultOperation::MoveAndSetMethod),
+        AddImmediate(2, 1, 4, ResultOperation::MoveAndSend),
+        AddImmediate(0, 0, 9, ResultOperation::FetchAndSend),
+        ALU(ALUOperation::Add, 0, 2, 3, ResultOperation::FetchAndSend, true),
+        AddImmediate(0, 0, 0),
+    };
+    const std::optional<Tegra::MacroTrace> trace{Tegra::TraceMacro(code)};
+    REQUIRE(trace.has_value());
+    REQUIRE(trace->num_parameters == 3);
+    REQUIRE(trace->sends.size() == 3);
+    REQUIRE(trace->sends[0].method == 0x234);
+    REQUIRE(trace->sends[0].parameter == 0);
+    REQUIRE(trace->sends[0].offset == 4);
+    REQUIRE(trace->sends[1].method == 0x235);
+    REQUIRE(trace->sends[1].parameter == Tegra::MacroTrace::CONSTANT);
+    REQUIRE(trace->sends[1].offset == 9);
+    // $r3 was never written, the sum keeps the shape of the first parameter
+    REQUIRE(trace->sends[2].method == 0x236);
+    REQUIRE(trace->sends[2].parameter == 0);
+    REQUIRE(trace->sends[2].offset == 4);
+}
+
+TEST_CASE("MacroSynthesis[loops]", "[video_core]") {
+    // Sends $r1 four times, counting down a constant
+    const std::array constant_loop{
+        AddImmediate(0, 0, 0x300, ResultOperation::MoveAndSetMethod),
+        AddImmediate(2, 0, 4),
+        AddImmediate(2, 2, -1),
+        ALU(ALUOperation::Add, 0, 1, 0, ResultOperation::MoveAndSend),
+        Branch(BranchCondition::NotZero, 2, -2, true),
+        AddImmediate(0, 0, 0, ResultOperation::Move, true),
+        AddImmediate(0, 0, 0),
+    };
+    const std::optional<Tegra::MacroTrace> trace{Tegra::TraceMacro(constant_loop)};
+    REQUIRE(trace.has_value());
+    REQUIRE(trace->num_parameters == 1);
+    REQUIRE(trace->sends.size() == 4);
+    for (const Tegra::MacroTrace::Send& send : trace->sends) {
+        REQUIRE(send.method == 0x300);
+        REQUIRE(send.parameter == 0);
+    }
+
+    // The trip count depends on the first parameter
+    std::array parameter_loop{constant_loop};
+    parameter_loop[1] = AddImmediate(2, 1, 0);
+    REQUIRE(!Tegra::TraceMacro(parameter_loop).has_value());
+}
+
+namespace {
+/// Owns a Maxwell3D engine for macro engines to run against
+class MacroTester {
+public:
+    MacroTester()
+        : device_memory_manager{device_memory}, memory_manager{system, device_memory_manager, 32},
+          maxwell3d{std::make_unique<Tegra::Engines::Maxwell3D>(system, memory_manager)} {}
+
+    Tegra::Engines::Maxwell3D& Maxwell3D() {
+        return *maxwell3d;
+    }
+
+private:
+    Core::System system;
+    Core::DeviceMemory device_memory;
+    Tegra::MaxwellDeviceMemoryManager device_memory_manager;
+    Tegra::MemoryManager memory_manager;
+    std::unique_ptr<Tegra::Engines::Maxwell3D> maxwell3d;
+};
+
+class NullMacro final : public Tegra::CachedMacro {
+public:
+    void Execute(const std::vector<u32>& parameters, u32 method) override {}
+};
+
+/// Engine that counts how many programs it compiles
+class CountingMacroEngine final : public Tegra::MacroEngine {
+public:
+    using MacroEngine::MacroEngine;
+
+    u32 num_compiles{};
+
+protected:
+    std::unique_ptr<Tegra::CachedMacro> Compile(const std::vector<u32>& code) override {
+        ++num_compiles;
+        return std::make_unique<NullMacro>();
+    }
+};
+} // Anonymous namespace
+
+TEST_CASE("MacroEngine[program_cache]", "[video_core]") {
+    MacroTester tester;
+    CountingMacroEngine engine{tester.Maxwell3D()};
+    const auto run = [&engine](u32 method, const auto& code) {
+        engine.ClearCode(method);
+        for (const u32 word : code) {
+            engine.AddCode(method, word);
+        }
+        engine.Execute(method, {1});
+    };
+
+    // Sends $r1 a parameter dependent number of times, so it is never synthesized
+    std::array code{
+        AddImmediate(0, 0, 0x300, ResultOperation::MoveAndSetMethod),
+        AddImmediate(2, 1, 0),
+        AddImmediate(2, 2, -1),
+        ALU(ALUOperation::Add, 0, 1, 0, ResultOperation::MoveAndSend),
+        Branch(BranchCondition::NotZero, 2, -2, true),
+        AddImmediate(0, 0, 0, ResultOperation::Move, true),
+        AddImmediate(0, 0, 0),
+    };
+    run(0x2000, code);
+    REQUIRE(engine.num_compiles == 1);
+
+    // Reuploads of the same code reuse the compiled program
+    run(0x2000, code);
+    run(0x2040, code);
+    REQUIRE(engine.num_compiles == 1);
+
+    code[0] = AddImmediate(0, 0, 0x301, ResultOperation::MoveAndSetMethod);
+    run(0x2000, code);
+    REQUIRE(engine.num_compiles == 2);
+}
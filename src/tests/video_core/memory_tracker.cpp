@@ -1,14 +1,17 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <array>
 #include <memory>
 #include <stdexcept>
 #include <unordered_map>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/common_types.h"
 #include "video_core/buffer_cache/memory_tracker_base.h"
+#include "video_core/buffer_cache/word_bitmap.h"
 
 namespace {
 using Range = std::pair<u64, u64>;
@@ -544,3 +547,70 @@ TEST_CASE("MemoryTracker: Cached write downloads") {
     memory_track->MarkRegionAsCpuModified(c, WORD);
     REQUIRE(rasterizer.Count() == 0);
 }
+
+TEST_CASE("MemoryTracker: Find non-zero word", "[video_core]") {
+    std::array<u64, 23> words{};
+    std::array<u64, 23> excluded{};
+    REQUIRE(VideoCommon::FindNonZeroWord(words.data(), 0, words.size()) == words.size());
+    words[13] = 1ULL << 63;
+    words[21] = 1;
+    for (size_t begin = 0; begin <= 13; ++begin) {
+        REQUIRE(VideoCommon::FindNonZeroWord(words.data(), begin, words.size()) == 13);
+    }
+    REQUIRE(VideoCommon::FindNonZeroWord(words.data(), 14, words.size()) == 21);
+    REQUIRE(VideoCommon::FindNonZeroWord(words.data(), 0, 13) == 13);
+    REQUIRE(VideoCommon::FindNonZeroWord(words.data(), 22, words.size()) == words.size());
+
+    excluded[13] = ~0ULL;
+    REQUIRE(VideoCommon::FindNonZeroWordExcluding(words.data(), excluded.data(), 0,
+                                                  words.size()) == 21);
+    excluded[13] = 1;
+    REQUIRE(VideoCommon::FindNonZeroWordExcluding(words.data(), excluded.data(), 0,
+                                                  words.size()) == 13);
+}
+
+TEST_CASE("MemoryTracker: Large region throughput", "[.][benchmark][video_core]") {
+    // Sizes of the big vertex and storage buffers synchronized every draw
+    constexpr u64 BUFFER_SIZE = 64 * HIGH_PAGE_SIZE;
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    memory_track->UnmarkRegionAsCpuModified(c, BUFFER_SIZE);
+
+    BENCHMARK("Clean upload") {
+        u64 num_ranges = 0;
+        memory_track->ForEachUploadRange(c, BUFFER_SIZE, [&](u64, u64) { ++num_ranges; });
+        return num_ranges;
+    };
+    BENCHMARK("Clean download query") {
+        u64 num_ranges = 0;
+        memory_track->ForEachDownloadRange(c, BUFFER_SIZE, false,
+                                           [&](u64, u64) { ++num_ranges; });
+        return num_ranges;
+    };
+    BENCHMARK("Clean modified query") {
+        return memory_track->IsRegionCpuModified(c, BUFFER_SIZE);
+    };
+    BENCHMARK("Clean GPU modified region") {
+        return memory_track->ModifiedGpuRegion(c, BUFFER_SIZE);
+    };
+    BENCHMARK("Flush without cached writes") {
+        memory_track->FlushCachedWrites(c, BUFFER_SIZE);
+    };
+
+    // A few scattered pages written by the guest every frame
+    BENCHMARK("Sparse upload") {
+        for (u64 offset = 0; offset < BUFFER_SIZE; offset += 3 * WORD + 5 * PAGE) {
+            memory_track->MarkRegionAsCpuModified(c + offset, PAGE);
+        }
+        u64 num_ranges = 0;
+        memory_track->ForEachUploadRange(c, BUFFER_SIZE, [&](u64, u64) { ++num_ranges; });
+        return num_ranges;
+    };
+    BENCHMARK("Dense upload") {
+        memory_track->MarkRegionAsCpuModified(c, BUFFER_SIZE);
+        u64 num_ranges = 0;
+        memory_track->ForEachUploadRange(c, BUFFER_SIZE, [&](u64, u64) { ++num_ranges; });
+        return num_ranges;
+    };
+    REQUIRE(rasterizer.Count() == BUFFER_SIZE / PAGE);
+}
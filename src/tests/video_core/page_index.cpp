@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/hash.h"
+#include "video_core/texture_cache/page_index.h"
+
+namespace {
+using VideoCommon::PageIndex;
+
+/// Page of the fake addresses the texture cache gives to images without backing memory
+constexpr u64 FAKE_PAGE = ~(1ULL << 40) >> 20;
+
+using Index = PageIndex<u32, 2>;
+using Reference = std::map<u64, std::vector<u32>>;
+
+std::vector<std::pair<u64, std::vector<u32>>> Walk(const Index& index, u64 first, u64 last) {
+    std::vector<std::pair<u64, std::vector<u32>>> result;
+    index.ForEachInRange(first, last, [&result](u64 page, const Index::IdSet& ids) {
+        result.emplace_back(page, std::vector<u32>(ids.begin(), ids.end()));
+    });
+    return result;
+}
+
+std::vector<std::pair<u64, std::vector<u32>>> Walk(const Reference& reference, u64 first,
+                                                   u64 last) {
+    std::vector<std::pair<u64, std::vector<u32>>> result;
+    for (auto it = reference.lower_bound(first); it != reference.end() && it->first <= last;
+         ++it) {
+        if (!it->second.empty()) {
+            result.emplace_back(it->first, it->second);
+        }
+    }
+    return result;
+}
+
+/// Operations of a scene that binds many render targets over a few long lived images
+struct LookupTrace {
+    struct Image {
+        u64 first_page;
+        u64 last_page;
+    };
+    std::vector<Image> images;
+    std::vector<u32> lookups;
+};
+
+LookupTrace MakeLookupTrace() {
+    std::mt19937 rng{0x54524143};
+    LookupTrace trace;
+    for (u32 image = 0; image < 2048; ++image) {
+        // Images are packed in a few heaps of the 40-bit GPU address space
+        const u64 heap = (rng() % 8) << 12;
+        const u64 first_page = heap + rng() % 0x800;
+        trace.images.push_back({first_page, first_page + rng() % 16});
+    }
+    for (u32 lookup = 0; lookup < 0x10000; ++lookup) {
+        // Most lookups hit the same render targets
+        const u32 image = rng() % 4 == 0 ? rng() % 2048 : rng() % 32;
+        trace.lookups.push_back(image);
+    }
+    return trace;
+}
+} // Anonymous namespace
+
+TEST_CASE("PageIndex[basic]", "[video_core]") {
+    Index index;
+    REQUIRE(index.Find(0) == nullptr);
+    index.Insert(5, 1);
+    index.Insert(5, 2);
+    index.Insert(5, 3);
+    index.Insert(2000, 4);
+    index.Insert(FAKE_PAGE, 5);
+
+    REQUIRE(index.Find(5)->size() == 3);
+    REQUIRE((*index.Find(5))[2] == 3);
+    REQUIRE(index.Find(FAKE_PAGE)->front() == 5);
+    REQUIRE(index.Find(6) == nullptr);
+
+    REQUIRE(index.Erase(5, 2));
+    REQUIRE(!index.Erase(5, 2));
+    REQUIRE(index.Find(5)->front() == 1);
+    REQUIRE(index.Find(5)->back() == 3);
+    REQUIRE(index.EraseIf(5, [](u32 id) { return id != 0; }) == 2);
+    REQUIRE(index.Find(5) == nullptr);
+
+    REQUIRE(Walk(index, 0, ~0ULL).size() == 2);
+    REQUIRE(Walk(index, FAKE_PAGE, FAKE_PAGE).size() == 1);
+}
+
+TEST_CASE("PageIndex[random]", "[video_core]") {
+    std::mt19937 rng{0x50494458};
+    Index index;
+    Reference reference;
+    const auto random_page = [&rng] {
+        switch (rng() % 3) {
+        case 0:
+            return static_cast<u64>(rng() % 0x1000);
+        case 1:
+            return static_cast<u64>(rng() % 0x100000);
+        default:
+            return FAKE_PAGE + rng() % 0x1000;
+        }
+    };
+    for (u32 iteration = 0; iteration < 20000; ++iteration) {
+        const u64 page = random_page();
+        const u32 id = rng() % 8;
+        std::vector<u32>& ids = reference[page];
+        if (rng() % 2 == 0) {
+            index.Insert(page, id);
+            ids.push_back(id);
+        } else {
+            const auto it = std::find(ids.begin(), ids.end(), id);
+            REQUIRE(index.Erase(page, id) == (it != ids.end()));
+            if (it != ids.end()) {
+                ids.erase(it);
+            }
+        }
+        const Index::IdSet* const found = index.Find(page);
+        REQUIRE((found ? found->size() : 0) == ids.size());
+
+        if (iteration % 64 == 0) {
+            u64 first = random_page();
+            u64 last = random_page();
+            if (first > last) {
+                std::swap(first, last);
+            }
+            INFO("Iteration " << iteration);
+            REQUIRE(Walk(index, first, last) == Walk(reference, first, last));
+        }
+    }
+    REQUIRE(Walk(index, 0, ~0ULL) == Walk(reference, 0, ~0ULL));
+}
+
+TEST_CASE("PageIndex[benchmark]", "[.][benchmark][video_core]") {
+    const LookupTrace trace = MakeLookupTrace();
+
+    PageIndex<u32> index;
+    std::unordered_map<u64, std::vector<u32>, Common::IdentityHash<u64>> map;
+    for (u32 image = 0; image < trace.images.size(); ++image) {
+        for (u64 page = trace.images[image].first_page; page <= trace.images[image].last_page;
+             ++page) {
+            index.Insert(page, image);
+            map[page].push_back(image);
+        }
+    }
+    BENCHMARK("PageIndex") {
+        u64 sum = 0;
+        for (const u32 image : trace.lookups) {
+            const LookupTrace::Image& range = trace.images[image];
+            index.ForEachInRange(range.first_page, range.last_page,
+                                 [&sum](u64, const PageIndex<u32>::IdSet& ids) {
+                                     for (const u32 id : ids) {
+                                         sum += id;
+                                     }
+                                 });
+        }
+        return sum;
+    };
+    BENCHMARK("unordered_map") {
+        u64 sum = 0;
+        for (const u32 image : trace.lookups) {
+            const LookupTrace::Image& range = trace.images[image];
+            for (u64 page = range.first_page; page <= range.last_page; ++page) {
+                const auto it = map.find(page);
+                if (it == map.end()) {
+                    continue;
+                }
+                for (const u32 id : it->second) {
+                    sum += id;
+                }
+            }
+        }
+        return sum;
+    };
+}
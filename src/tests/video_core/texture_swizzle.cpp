@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/textures/decoders.h"
+
+namespace {
+using namespace Tegra::Texture;
+
+struct Layout {
+    u32 bytes_per_pixel;
+    u32 width;
+    u32 height;
+    u32 depth;
+    u32 block_height;
+    u32 block_depth;
+};
+
+/// Straightforward block linear address of a byte, kept independent from the decoders.
+u32 ReferenceOffset(const Layout& layout, u32 x, u32 y, u32 z) {
+    const u32 gobs_in_x = (layout.width * layout.bytes_per_pixel + GOB_SIZE_X - 1) / GOB_SIZE_X;
+    const u32 gob_size_shift = GOB_SIZE_SHIFT + layout.block_height + layout.block_depth;
+    const u32 block_size = gobs_in_x << gob_size_shift;
+    const u32 block_lines = GOB_SIZE_Y << layout.block_height;
+    const u32 slice_size = ((layout.height + block_lines - 1) / block_lines) * block_size;
+
+    const u32 gob_x = x / GOB_SIZE_X;
+    const u32 gob_y = y / GOB_SIZE_Y;
+    const u32 gob_offset = ((x & 0x20) << 3) | ((y & 0x6) << 5) | ((x & 0x10) << 1) |
+                           ((y & 0x1) << 4) | (x & 0xf);
+    return (z >> layout.block_depth) * slice_size +
+           ((z & ((1U << layout.block_depth) - 1)) << (GOB_SIZE_SHIFT + layout.block_height)) +
+           (gob_y >> layout.block_height) * block_size +
+           ((gob_y & ((1U << layout.block_height) - 1)) << GOB_SIZE_SHIFT) +
+           (gob_x << gob_size_shift) + gob_offset;
+}
+
+std::vector<u8> RandomBytes(std::mt19937& rng, size_t size) {
+    std::vector<u8> bytes(size);
+    std::ranges::generate(bytes, [&] { return static_cast<u8>(rng()); });
+    return bytes;
+}
+
+size_t SwizzledSize(const Layout& layout) {
+    return CalculateSize(true, layout.bytes_per_pixel, layout.width, layout.height, layout.depth,
+                         layout.block_height, layout.block_depth);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("TextureSwizzle: Unswizzle matches reference", "[video_core]") {
+    std::mt19937 rng{1234};
+    for (const u32 bytes_per_pixel : {1U, 2U, 4U, 8U, 16U}) {
+        for (u32 iteration = 0; iteration < 16; ++iteration) {
+            const Layout layout{
+                .bytes_per_pixel = bytes_per_pixel,
+                .width = 1 + rng() % 160,
+                .height = 1 + rng() % 80,
+                .depth = 1 + rng() % 3,
+                .block_height = rng() % 5,
+                .block_depth = rng() % 2,
+            };
+            const u32 pitch = layout.width * bytes_per_pixel;
+            const std::vector<u8> swizzled = RandomBytes(rng, SwizzledSize(layout));
+            std::vector<u8> linear(pitch * layout.height * layout.depth);
+            UnswizzleTexture(linear, swizzled, bytes_per_pixel, layout.width, layout.height,
+                             layout.depth, layout.block_height, layout.block_depth);
+
+            for (u32 z = 0; z < layout.depth; ++z) {
+                for (u32 y = 0; y < layout.height; ++y) {
+                    for (u32 x = 0; x < pitch; ++x) {
+                        const u8 expected = swizzled[ReferenceOffset(layout, x, y, z)];
+                        REQUIRE(linear[(z * layout.height + y) * pitch + x] == expected);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("TextureSwizzle: Swizzle round trips", "[video_core]") {
+    std::mt19937 rng{5678};
+    for (const u32 bytes_per_pixel : {1U, 2U, 4U, 8U, 16U}) {
+        const Layout layout{
+            .bytes_per_pixel = bytes_per_pixel,
+            .width = 1 + rng() % 300,
+            .height = 1 + rng() % 100,
+            .depth = 1,
+            .block_height = rng() % 5,
+            .block_depth = 0,
+        };
+        const u32 pitch = layout.width * bytes_per_pixel;
+        const std::vector<u8> linear = RandomBytes(rng, pitch * layout.height);
+        std::vector<u8> swizzled(SwizzledSize(layout));
+        std::vector<u8> result(linear.size());
+        SwizzleTexture(swizzled, linear, bytes_per_pixel, layout.width, layout.height,
+                       layout.depth, layout.block_height, layout.block_depth);
+        UnswizzleTexture(result, swizzled, bytes_per_pixel, layout.width, layout.height,
+                         layout.depth, layout.block_height, layout.block_depth);
+        REQUIRE(result == linear);
+    }
+}
+
+TEST_CASE("TextureSwizzle: Unswizzle subrect matches reference", "[video_core]") {
+    std::mt19937 rng{9012};
+    for (const u32 bytes_per_pixel : {1U, 2U, 4U, 8U, 16U}) {
+        for (u32 iteration = 0; iteration < 16; ++iteration) {
+            const Layout layout{
+                .bytes_per_pixel = bytes_per_pixel,
+                .width = 1 + rng() % 200,
+                .height = 1 + rng() % 80,
+                .depth = 1,
+                .block_height = rng() % 5,
+                .block_depth = 0,
+            };
+            const u32 origin_x = rng() % layout.width;
+            const u32 origin_y = rng() % layout.height;
+            const u32 extent_x = 1 + rng() % (layout.width - origin_x);
+            const u32 extent_y = 1 + rng() % (layout.height - origin_y);
+            const u32 pitch = extent_x * bytes_per_pixel;
+
+            const std::vector<u8> swizzled = RandomBytes(rng, SwizzledSize(layout));
+            std::vector<u8> linear(pitch * extent_y);
+            UnswizzleSubrect(linear, swizzled, bytes_per_pixel, layout.width, layout.height,
+                             layout.depth, origin_x, origin_y, extent_x, extent_y,
+                             layout.block_height, layout.block_depth, pitch);
+
+            for (u32 line = 0; line < extent_y; ++line) {
+                for (u32 x = 0; x < pitch; ++x) {
+                    const u32 offset = ReferenceOffset(layout, origin_x * bytes_per_pixel + x,
+                                                       origin_y + line, 0);
+                    REQUIRE(linear[line * pitch + x] == swizzled[offset]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("TextureSwizzle: Benchmark", "[.][benchmark][video_core]") {
+    static constexpr u32 width = 2048;
+    static constexpr u32 height = 2048;
+    std::vector<u8> linear(width * height * 4);
+    std::vector<u8> swizzled(CalculateSize(true, 4, width, height, 1, 4, 0));
+
+    for (const u32 bytes_per_pixel : {1U, 4U, 16U}) {
+        const u32 texels = width * 4 / bytes_per_pixel;
+        BENCHMARK("UnswizzleTexture " + std::to_string(bytes_per_pixel) + "bpp") {
+            UnswizzleTexture(linear, swizzled, bytes_per_pixel, texels, height, 1, 4, 0);
+            return linear[0];
+        };
+        BENCHMARK("SwizzleTexture " + std::to_string(bytes_per_pixel) + "bpp") {
+            SwizzleTexture(swizzled, linear, bytes_per_pixel, texels, height, 1, 4, 0);
+            return swizzled[0];
+        };
+    }
+    BENCHMARK("UnswizzleSubrect 4bpp") {
+        UnswizzleSubrect(linear, swizzled, 4, width, height, 1, 0, 0, width / 2, height / 2, 4, 0,
+                         width * 2);
+        return linear[0];
+    };
+}
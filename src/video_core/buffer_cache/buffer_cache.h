@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
@@ -7,8 +7,10 @@
 #pragma once
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <numeric>
+#include <tuple>
 
 #include "common/range_sets.inc"
 #include "video_core/buffer_cache/buffer_cache_base.h"
@@ -48,7 +50,15 @@ BufferCache<P>::BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, R
 }
 
 template <class P>
-BufferCache<P>::~BufferCache() = default;
+BufferCache<P>::~BufferCache() {
+    const UploadBatchStatistics& stats = upload_batch_statistics;
+    if (stats.num_batches != 0) {
+        LOG_INFO(HW_GPU,
+                 "Batched buffer uploads: {} batches, {} dirty ranges merged into {} copies, "
+                 "{} bytes",
+                 stats.num_batches, stats.num_ranges, stats.num_copies, stats.num_bytes);
+    }
+}
 
 template <class P>
 void BufferCache<P>::RunGarbageCollector() {
@@ -369,16 +379,20 @@ void BufferCache<P>::BindHostGeometryBuffers(bool is_indexed) {
 
 template <class P>
 void BufferCache<P>::BindHostStageBuffers(size_t stage) {
+    BeginUploadBatch();
     BindHostGraphicsUniformBuffers(stage);
     BindHostGraphicsStorageBuffers(stage);
     BindHostGraphicsTextureBuffers(stage);
+    EndUploadBatch();
 }
 
 template <class P>
 void BufferCache<P>::BindHostComputeBuffers() {
+    BeginUploadBatch();
     BindHostComputeUniformBuffers();
     BindHostComputeStorageBuffers();
     BindHostComputeTextureBuffers();
+    EndUploadBatch();
 }
 
 template <class P>
@@ -719,6 +733,7 @@ void BufferCache<P>::BindHostVertexBuffers() {
     HostBindings<typename P::Buffer> host_bindings;
     bool any_valid{false};
     auto& flags = maxwell3d->dirty.flags;
+    BeginUploadBatch();
     for (u32 index = 0; index < NUM_VERTEX_BUFFERS; ++index) {
         const Binding& binding = channel_state->vertex_buffers[index];
         Buffer& buffer = slot_buffers[binding.buffer_id];
@@ -733,6 +748,7 @@ void BufferCache<P>::BindHostVertexBuffers() {
         host_bindings.max_index = (std::max)(host_bindings.max_index, index);
         any_valid = true;
     }
+    EndUploadBatch();
 
     if (any_valid) {
         host_bindings.max_index++;
@@ -1473,6 +1489,10 @@ template <class P>
 void BufferCache<P>::UploadMemory(Buffer& buffer, u64 total_size_bytes, u64 largest_copy,
                                   std::span<BufferCopy> copies) {
     if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
+        if (upload_batch.is_active) {
+            QueueBatchedUpload(buffer, copies);
+            return;
+        }
         MappedUploadMemory(buffer, total_size_bytes, copies);
     } else {
         ImmediateUploadMemory(buffer, largest_copy, copies);
@@ -1525,6 +1545,114 @@ void BufferCache<P>::MappedUploadMemory([[maybe_unused]] Buffer& buffer,
     }
 }
 
+template <class P>
+void BufferCache<P>::BeginUploadBatch() {
+    upload_batch.is_active = true;
+}
+
+template <class P>
+void BufferCache<P>::EndUploadBatch() {
+    FlushUploadBatch();
+    upload_batch.is_active = false;
+}
+
+template <class P>
+void BufferCache<P>::QueueBatchedUpload(Buffer& buffer, std::span<const BufferCopy> copies) {
+    auto it = std::ranges::find(upload_batch.buffers, &buffer);
+    if (it == upload_batch.buffers.end()) {
+        it = upload_batch.buffers.insert(upload_batch.buffers.end(), &buffer);
+    }
+    const u32 buffer_index = static_cast<u32>(std::distance(upload_batch.buffers.begin(), it));
+    // Usage is marked right after synchronizing, so reordering is decided before binding
+    const bool can_reorder = runtime.CanReorderUpload(buffer, copies);
+    for (const BufferCopy& copy : copies) {
+        upload_batch.ranges.push_back({
+            .buffer_index = buffer_index,
+            .can_reorder = can_reorder,
+            .dst_offset = copy.dst_offset,
+            .size = copy.size,
+        });
+    }
+}
+
+template <class P>
+void BufferCache<P>::FlushUploadBatch() {
+    if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
+        auto& ranges = upload_batch.ranges;
+        if (ranges.empty()) {
+            return;
+        }
+        // Buffers keep the order of their first upload, ranges of a buffer are sorted by offset
+        std::ranges::sort(ranges, [](const auto& lhs, const auto& rhs) {
+            return std::tie(lhs.buffer_index, lhs.can_reorder, lhs.dst_offset) <
+                   std::tie(rhs.buffer_index, rhs.can_reorder, rhs.dst_offset);
+        });
+        size_t num_merged = 0;
+        u64 total_size_bytes = 0;
+        for (const auto& range : ranges) {
+            if (num_merged != 0) {
+                auto& last = ranges[num_merged - 1];
+                if (last.buffer_index == range.buffer_index &&
+                    last.can_reorder == range.can_reorder &&
+                    range.dst_offset <= last.dst_offset + last.size) {
+                    const u64 end = (std::max)(last.dst_offset + last.size,
+                                               range.dst_offset + range.size);
+                    total_size_bytes += end - (last.dst_offset + last.size);
+                    last.size = end - last.dst_offset;
+                    continue;
+                }
+            }
+            ranges[num_merged++] = range;
+            total_size_bytes += range.size;
+        }
+        ++upload_batch_statistics.num_batches;
+        upload_batch_statistics.num_ranges += ranges.size();
+        upload_batch_statistics.num_copies += num_merged;
+        upload_batch_statistics.num_bytes += total_size_bytes;
+        ranges.resize(num_merged);
+
+        auto upload_staging = runtime.UploadStagingBuffer(total_size_bytes);
+        // Copies from a staging buffer that can not be reordered are recorded in order, so they
+        // need the barriers even when their ranges could have been reordered
+        const bool needs_barriers =
+            !runtime.CanReorderUploadFrom(upload_staging) ||
+            std::ranges::any_of(ranges, [](const auto& range) { return !range.can_reorder; });
+        if (needs_barriers) {
+            runtime.PreCopyBarrier();
+        }
+        boost::container::small_vector<BufferCopy, 8> copies;
+        u64 staging_offset = 0;
+        for (size_t index = 0; index < ranges.size(); ++index) {
+            const auto& range = ranges[index];
+            Buffer& buffer = *upload_batch.buffers[range.buffer_index];
+            device_memory.ReadBlockUnsafe(buffer.CpuAddr() + range.dst_offset,
+                                          upload_staging.mapped_span.data() + staging_offset,
+                                          range.size);
+            copies.push_back(BufferCopy{
+                .src_offset = upload_staging.offset + staging_offset,
+                .dst_offset = range.dst_offset,
+                .size = range.size,
+            });
+            staging_offset += range.size;
+
+            const bool is_last = index + 1 == ranges.size() ||
+                                 ranges[index + 1].buffer_index != range.buffer_index ||
+                                 ranges[index + 1].can_reorder != range.can_reorder;
+            if (is_last) {
+                const std::span<const BufferCopy> copies_span(copies.data(), copies.size());
+                runtime.CopyBuffer(buffer, upload_staging.buffer, copies_span, false,
+                                   range.can_reorder);
+                copies.clear();
+            }
+        }
+        if (needs_barriers) {
+            runtime.PostCopyBarrier();
+        }
+        ranges.clear();
+        upload_batch.buffers.clear();
+    }
+}
+
 template <class P>
 bool BufferCache<P>::InlineMemory(DAddr dest_address, size_t copy_size,
                                   std::span<const u8> inlined_buffer) {
@@ -1635,6 +1763,10 @@ void BufferCache<P>::DownloadBufferMemory(Buffer& buffer, DAddr device_addr, u64
 
 template <class P>
 void BufferCache<P>::DeleteBuffer(BufferId buffer_id, bool do_not_mark) {
+    if (upload_batch.is_active) {
+        // Queued ranges may point to the buffer
+        FlushUploadBatch();
+    }
     bool dirty_index{false};
     boost::container::small_vector<u64, NUM_VERTEX_BUFFERS> dirty_vertex_buffers;
     const auto scalar_replace = [buffer_id](Binding& binding) {
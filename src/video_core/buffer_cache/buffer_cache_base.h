@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
@@ -190,6 +190,26 @@ class BufferCache : public VideoCommon::ChannelSetupCaches<BufferCacheChannelInf
         bool has_stream_leap = false;
     };
 
+    /// Dirty ranges synchronized while binding buffers, uploaded together when the bind ends
+    struct UploadBatch {
+        struct Range {
+            u32 buffer_index;
+            bool can_reorder;
+            u64 dst_offset;
+            u64 size;
+        };
+        boost::container::small_vector<Buffer*, 16> buffers;
+        boost::container::small_vector<Range, 32> ranges;
+        bool is_active = false;
+    };
+
+    struct UploadBatchStatistics {
+        u64 num_batches = 0;
+        u64 num_ranges = 0;
+        u64 num_copies = 0;
+        u64 num_bytes = 0;
+    };
+
 public:
     explicit BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, Runtime& runtime_);
 
@@ -223,6 +243,12 @@ public:
 
     void BindHostComputeBuffers();
 
+    /// Queues the uploads of the following synchronizations instead of recording them one by one
+    void BeginUploadBatch();
+
+    /// Uploads the queued ranges and stops queueing
+    void EndUploadBatch();
+
     void SetUniformBuffersState(const std::array<u32, NUM_STAGES>& mask,
                                 const UniformBufferSizes* sizes);
 
@@ -420,6 +446,11 @@ private:
 
     void MappedUploadMemory(Buffer& buffer, u64 total_size_bytes, std::span<BufferCopy> copies);
 
+    void QueueBatchedUpload(Buffer& buffer, std::span<const BufferCopy> copies);
+
+    /// Uploads the queued ranges through a single staging allocation, merging neighbours
+    void FlushUploadBatch();
+
     void DownloadBufferMemory(Buffer& buffer_id);
 
     void DownloadBufferMemory(Buffer& buffer_id, DAddr device_addr, u64 size);
@@ -468,6 +499,9 @@ private:
     size_t immediate_buffer_capacity = 0;
     Common::ScratchBuffer<u8> immediate_buffer_alloc;
 
+    UploadBatch upload_batch;
+    UploadBatchStatistics upload_batch_statistics;
+
     struct LRUItemParams {
         using ObjectType = BufferId;
         using TickType = u64;
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#if defined(ARCHITECTURE_x86_64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+namespace Detail {
+
+template <bool has_excluded>
+[[nodiscard]] inline size_t FindNonZeroWordImpl(const u64* words, const u64* excluded,
+                                                size_t begin, size_t end) noexcept {
+    // Test four words at a time, the scalar loop below finds the exact word
+#if defined(ARCHITECTURE_x86_64)
+    const __m128i zero = _mm_setzero_si128();
+    for (; begin + 4 <= end; begin += 4) {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + begin));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + begin + 2));
+        if constexpr (has_excluded) {
+            low = _mm_andnot_si128(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(excluded + begin)), low);
+            high = _mm_andnot_si128(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(excluded + begin + 2)), high);
+        }
+        const __m128i any = _mm_or_si128(low, high);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(any, zero)) != 0xFFFF) {
+            break;
+        }
+    }
+#elif defined(__ARM_NEON) && defined(ARCHITECTURE_arm64)
+    for (; begin + 4 <= end; begin += 4) {
+        uint64x2_t low = vld1q_u64(words + begin);
+        uint64x2_t high = vld1q_u64(words + begin + 2);
+        if constexpr (has_excluded) {
+            low = vbicq_u64(low, vld1q_u64(excluded + begin));
+            high = vbicq_u64(high, vld1q_u64(excluded + begin + 2));
+        }
+        if (vmaxvq_u32(vreinterpretq_u32_u64(vorrq_u64(low, high))) != 0) {
+            break;
+        }
+    }
+#endif
+    for (; begin < end; ++begin) {
+        u64 word = words[begin];
+        if constexpr (has_excluded) {
+            word &= ~excluded[begin];
+        }
+        if (word != 0) {
+            return begin;
+        }
+    }
+    return end;
+}
+
+} // namespace Detail
+
+/// Returns the index of the first non-zero word in [begin, end), or end if there is none
+[[nodiscard]] inline size_t FindNonZeroWord(const u64* words, size_t begin, size_t end) noexcept {
+    return Detail::FindNonZeroWordImpl<false>(words, nullptr, begin, end);
+}
+
+/// Returns the index of the first word in [begin, end) with bits set that are not set in excluded,
+/// or end if there is none
+[[nodiscard]] inline size_t FindNonZeroWordExcluding(const u64* words, const u64* excluded,
+                                                     size_t begin, size_t end) noexcept {
+    return Detail::FindNonZeroWordImpl<true>(words, excluded, begin, end);
+}
+
+} // namespace VideoCommon
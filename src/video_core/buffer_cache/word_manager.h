@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
@@ -13,6 +16,7 @@
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "video_core/buffer_cache/word_bitmap.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 
 namespace VideoCommon {
@@ -227,6 +231,61 @@ public:
         }
     }
 
+    /**
+     * Calls func(index, word) for the words of a range with pages in the given state, where word
+     * has the bits of those pages. Clean words are skipped in bulk.
+     */
+    template <Type type, typename Func>
+    void IterateModifiedWords(size_t offset, size_t size, Func&& func) const {
+        using FuncReturn = std::invoke_result_t<Func, std::size_t, u64>;
+        static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
+        const size_t start = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset), 0LL));
+        const size_t end = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset + size), 0LL));
+        if (start >= SizeBytes() || end <= start) {
+            return;
+        }
+        const std::span<const u64> state_words = words.template Span<type>();
+        [[maybe_unused]] const std::span<const u64> untracked_words =
+            words.template Span<Type::Untracked>();
+        const size_t start_page = start / BYTES_PER_PAGE;
+        const size_t end_page =
+            (std::min)(Common::DivCeil(end, BYTES_PER_PAGE), NumWords() * PAGES_PER_WORD);
+        const size_t start_word = start_page / PAGES_PER_WORD;
+        const size_t end_word = Common::DivCeil(end_page, PAGES_PER_WORD);
+        size_t word_index = start_word;
+        while (word_index < end_word) {
+            u64 word = state_words[word_index];
+            if constexpr (type == Type::GPU) {
+                word &= ~untracked_words[word_index];
+            }
+            if (word_index == start_word) {
+                word = ExtractBits(word, start_page % PAGES_PER_WORD, PAGES_PER_WORD);
+            }
+            if (word_index == end_word - 1) {
+                word = ExtractBits(word, 0, end_page - word_index * PAGES_PER_WORD);
+            }
+            if (word != 0) {
+                if constexpr (BOOL_BREAK) {
+                    if (func(word_index, word)) {
+                        return;
+                    }
+                } else {
+                    func(word_index, word);
+                }
+            }
+            ++word_index;
+            if (word_index + 1 < end_word) {
+                // Words before the last one are fully inside the range
+                if constexpr (type == Type::GPU) {
+                    word_index = FindNonZeroWordExcluding(
+                        state_words.data(), untracked_words.data(), word_index, end_word - 1);
+                } else {
+                    word_index = FindNonZeroWord(state_words.data(), word_index, end_word - 1);
+                }
+            }
+        }
+    }
+
     template <typename Func>
     void IteratePages(u64 mask, Func&& func) const {
         size_t offset = 0;
@@ -301,23 +360,7 @@ public:
             func(cpu_addr + pending_offset * BYTES_PER_PAGE,
                  (pending_pointer - pending_offset) * BYTES_PER_PAGE);
         };
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
-            if constexpr (type == Type::GPU) {
-                mask &= ~untracked_words[index];
-            }
-            const u64 word = state_words[index] & mask;
-            if constexpr (clear) {
-                if constexpr (type == Type::CPU || type == Type::CachedCPU) {
-                    NotifyRasterizer<true>(index, untracked_words[index], mask);
-                }
-                state_words[index] &= ~mask;
-                if constexpr (type == Type::CPU || type == Type::CachedCPU) {
-                    untracked_words[index] &= ~mask;
-                }
-                if constexpr (type == Type::CPU) {
-                    cached_words[index] &= ~word;
-                }
-            }
+        const auto add_pages = [&](size_t index, u64 word) {
             const size_t base_offset = index * PAGES_PER_WORD;
             IteratePages(word, [&](size_t pages_offset, size_t pages_size) {
                 const auto reset = [&]() {
@@ -336,7 +379,27 @@ public:
                 release();
                 reset();
             });
-        });
+        };
+        if constexpr (clear && (type == Type::CPU || type == Type::CachedCPU)) {
+            // Clean pages stop being untracked too, so every word of the range is visited
+            IterateWords(offset, size, [&](size_t index, u64 mask) {
+                const u64 word = state_words[index] & mask;
+                NotifyRasterizer<true>(index, untracked_words[index], mask);
+                state_words[index] &= ~mask;
+                untracked_words[index] &= ~mask;
+                if constexpr (type == Type::CPU) {
+                    cached_words[index] &= ~word;
+                }
+                add_pages(index, word);
+            });
+        } else {
+            IterateModifiedWords<type>(offset, size, [&](size_t index, u64 word) {
+                if constexpr (clear) {
+                    state_words[index] &= ~word;
+                }
+                add_pages(index, word);
+            });
+        }
         if (pending) {
             release();
         }
@@ -352,20 +415,10 @@ public:
     [[nodiscard]] bool IsRegionModified(u64 offset, u64 size) const noexcept {
         static_assert(type != Type::Untracked);
 
-        const std::span<const u64> state_words = words.template Span<type>();
-        [[maybe_unused]] const std::span<const u64> untracked_words =
-            words.template Span<Type::Untracked>();
         bool result = false;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
-            if constexpr (type == Type::GPU) {
-                mask &= ~untracked_words[index];
-            }
-            const u64 word = state_words[index] & mask;
-            if (word != 0) {
-                result = true;
-                return true;
-            }
-            return false;
+        IterateModifiedWords<type>(offset, size, [&result](size_t, u64) {
+            result = true;
+            return true;
         });
         return result;
     }
@@ -379,19 +432,9 @@ public:
     template <Type type>
     [[nodiscard]] std::pair<u64, u64> ModifiedRegion(u64 offset, u64 size) const noexcept {
         static_assert(type != Type::Untracked);
-        const std::span<const u64> state_words = words.template Span<type>();
-        [[maybe_unused]] const std::span<const u64> untracked_words =
-            words.template Span<Type::Untracked>();
         u64 begin = (std::numeric_limits<u64>::max)();
         u64 end = 0;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
-            if constexpr (type == Type::GPU) {
-                mask &= ~untracked_words[index];
-            }
-            const u64 word = state_words[index] & mask;
-            if (word == 0) {
-                return;
-            }
+        IterateModifiedWords<type>(offset, size, [&](size_t index, u64 word) {
             const u64 local_page_begin = std::countr_zero(word);
             const u64 local_page_end = PAGES_PER_WORD - std::countl_zero(word);
             const u64 page_index = index * PAGES_PER_WORD;
@@ -418,17 +461,18 @@ public:
     }
 
     void FlushCachedWrites() noexcept {
-        const u64 num_words = NumWords();
         u64* const cached_words = Array<Type::CachedCPU>();
         u64* const untracked_words = Array<Type::Untracked>();
         u64* const cpu_words = Array<Type::CPU>();
-        for (u64 word_index = 0; word_index < num_words; ++word_index) {
+        // Most managers have no cached writes, only words with some are visited
+        const size_t words_size = NumWords() * BYTES_PER_WORD;
+        IterateModifiedWords<Type::CachedCPU>(0, words_size, [&](size_t word_index, u64) {
             const u64 cached_bits = cached_words[word_index];
             NotifyRasterizer<false>(word_index, untracked_words[word_index], cached_bits);
             untracked_words[word_index] |= cached_bits;
             cpu_words[word_index] |= cached_bits;
             cached_words[word_index] = 0;
-        }
+        });
     }
 
 private:
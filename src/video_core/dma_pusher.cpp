@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
@@ -145,6 +145,18 @@ void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
                 index += max_write;
                 continue;
             } else {
+                if (!dma_increment_once && dma_state.method >= non_puller_methods) {
+                    // Consecutive registers that don't trigger anything are written in one go
+                    const u32 max_write = static_cast<u32>(
+                        std::min<std::size_t>(dma_state.method_count, commands.size() - index));
+                    const u32 num_methods = CallMethods(&command_header.argument, max_write);
+                    if (num_methods != 0) {
+                        dma_state.method += num_methods;
+                        dma_state.method_count -= num_methods;
+                        index += num_methods;
+                        continue;
+                    }
+                }
                 dma_state.is_last_call = dma_state.method_count <= 1;
                 CallMethod(command_header.argument);
             }
@@ -219,6 +231,23 @@ void DmaPusher::CallMethod(u32 argument) const {
     }
 }
 
+u32 DmaPusher::CallMethods(const u32* base_start, u32 max_methods) const {
+    auto subchannel = subchannels[dma_state.subchannel];
+    const u32 mask_end = static_cast<u32>(subchannel->execution_mask.size());
+    const u32 end = std::min(dma_state.method + max_methods, mask_end);
+    u32 method = dma_state.method;
+    while (method < end && !subchannel->execution_mask[method]) {
+        ++method;
+    }
+    const u32 num_methods = method - dma_state.method;
+    if (num_methods < 2) {
+        // Not worth leaving the per method path
+        return 0;
+    }
+    subchannel->CallMethods(dma_state.method, std::span(base_start, num_methods));
+    return num_methods;
+}
+
 void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
     if (dma_state.method < non_puller_methods) {
         puller.CallMultiMethod(dma_state.method, dma_state.subchannel, base_start, num_methods,
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
@@ -153,6 +153,8 @@ private:
     void SetState(const CommandHeader& command_header);
 
     void CallMethod(u32 argument) const;
+    /// Writes the leading run of registers that don't trigger execution, returns its length
+    u32 CallMethods(const u32* base_start, u32 max_methods) const;
     void CallMultiMethod(const u32* base_start, u32 num_methods) const;
 
     Common::ScratchBuffer<CommandHeader>
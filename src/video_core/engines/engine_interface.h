@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -5,6 +8,7 @@
 
 #include <bitset>
 #include <limits>
+#include <span>
 #include <vector>
 
 #include "common/common_types.h"
@@ -30,6 +34,13 @@ public:
     virtual void CallMultiMethod(u32 method, const u32* base_start, u32 amount,
                                  u32 methods_pending) = 0;
 
+    /// Write consecutive registers starting at method, none of them may trigger execution.
+    virtual void CallMethods(u32 method, std::span<const u32> arguments) {
+        for (const u32 argument : arguments) {
+            method_sink.emplace_back(method++, argument);
+        }
+    }
+
     void ConsumeSink() {
         if (method_sink.empty()) {
             return;
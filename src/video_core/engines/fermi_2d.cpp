@@ -1,9 +1,11 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
+
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "video_core/engines/fermi_2d.h"
@@ -52,6 +54,12 @@ void Fermi2D::CallMultiMethod(u32 method, const u32* base_start, u32 amount, u32
     }
 }
 
+void Fermi2D::CallMethods(u32 method, std::span<const u32> arguments) {
+    ASSERT_MSG(method + arguments.size() <= Regs::NUM_REGS, "Invalid Fermi2D register");
+    ConsumeSink();
+    std::memcpy(&regs.reg_array[method], arguments.data(), arguments.size_bytes());
+}
+
 void Fermi2D::ConsumeSinkImpl() {
     for (auto [method, value] : method_sink) {
         regs.reg_array[method] = value;
@@ -1,7 +1,11 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <bitset>
+#include <cstring>
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "core/core.h"
@@ -90,6 +94,12 @@ void KeplerCompute::CallMultiMethod(u32 method, const u32* base_start, u32 amoun
     }
 }
 
+void KeplerCompute::CallMethods(u32 method, std::span<const u32> arguments) {
+    ASSERT_MSG(method + arguments.size() <= Regs::NUM_REGS, "Invalid KeplerCompute register");
+    ConsumeSink();
+    std::memcpy(&regs.reg_array[method], arguments.data(), arguments.size_bytes());
+}
+
 void KeplerCompute::ProcessLaunch() {
     const GPUVAddr launch_desc_loc = regs.launch_desc_loc.Address();
     memory_manager.ReadBlockUnsafe(launch_desc_loc, &launch_description,
@@ -1,8 +1,27 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cstring>
 #include <optional>
+
+#if defined(ARCHITECTURE_x86_64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#elif defined(ARCHITECTURE_arm64)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wshadow"
+#include <sse2neon.h>
+#pragma GCC diagnostic pop
+#endif
+
 #include "common/assert.h"
 #include "common/bit_util.h"
 #include "common/scope_exit.h"
@@ -326,6 +345,37 @@ void Maxwell3D::ProcessDirtyRegisters(u32 method, u32 argument) {
     }
 }
 
+void Maxwell3D::ProcessDirtyRegisters(u32 method, std::span<const u32> arguments) {
+    u32* const registers = &regs.reg_array[method];
+    const size_t count = arguments.size();
+    size_t index = 0;
+    while (index < count) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+        // Most rewritten state is unchanged, skip it four registers at a time
+        while (index + 4 <= count) {
+            const __m128i current =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(registers + index));
+            const __m128i incoming =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(arguments.data() + index));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(current, incoming)) != 0xFFFF) {
+                break;
+            }
+            index += 4;
+        }
+#endif
+        for (const size_t block_end = std::min<size_t>(index + 4, count); index < block_end;
+             ++index) {
+            if (registers[index] == arguments[index]) {
+                continue;
+            }
+            registers[index] = arguments[index];
+            for (const auto& table : dirty.tables) {
+                dirty.flags[table[method + index]] = true;
+            }
+        }
+    }
+}
+
 void Maxwell3D::ProcessMethodCall(u32 method, u32 argument, u32 nonshadow_argument,
                                   bool is_last_call) {
     switch (method) {
@@ -472,6 +522,21 @@ void Maxwell3D::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
     }
 }
 
+void Maxwell3D::CallMethods(u32 method, std::span<const u32> arguments) {
+    ASSERT_MSG(method + arguments.size() <= Regs::NUM_REGS,
+               "Invalid Maxwell3D register, increase the size of the Regs structure");
+    ConsumeSink();
+
+    const auto control = shadow_state.shadow_ram_control;
+    if (control == Regs::ShadowRamControl::Track ||
+        control == Regs::ShadowRamControl::TrackWithFilter) {
+        std::memcpy(&shadow_state.reg_array[method], arguments.data(), arguments.size_bytes());
+    } else if (control == Regs::ShadowRamControl::Replay) {
+        arguments = std::span(&shadow_state.reg_array[method], arguments.size());
+    }
+    ProcessDirtyRegisters(method, arguments);
+}
+
 void Maxwell3D::ProcessMacroUpload(u32 data) {
     macro_engine->AddCode(regs.load_mme.instruction_ptr++, data);
 }
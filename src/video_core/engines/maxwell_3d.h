@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -3078,6 +3081,9 @@ public:
     void CallMultiMethod(u32 method, const u32* base_start, u32 amount,
                          u32 methods_pending) override;
 
+    /// Write consecutive registers starting at method, none of them may trigger execution.
+    void CallMethods(u32 method, std::span<const u32> arguments) override;
+
     bool ShouldExecute() const {
         return execute_on;
     }
@@ -3140,6 +3146,9 @@ private:
 
     void ProcessDirtyRegisters(u32 method, u32 argument);
 
+    /// Writes consecutive registers, flagging the ones that change as dirty
+    void ProcessDirtyRegisters(u32 method, std::span<const u32> arguments);
+
     void ConsumeSinkImpl() override;
 
     void ProcessMethodCall(u32 method, u32 argument, u32 nonshadow_argument, bool is_last_call);
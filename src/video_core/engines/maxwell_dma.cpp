@@ -1,9 +1,11 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
+
 #include "common/algorithm.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -57,6 +59,12 @@ void MaxwellDMA::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
     }
 }
 
+void MaxwellDMA::CallMethods(u32 method, std::span<const u32> arguments) {
+    ASSERT_MSG(method + arguments.size() <= NUM_REGS, "Invalid MaxwellDMA register");
+    ConsumeSink();
+    std::memcpy(&regs.reg_array[method], arguments.data(), arguments.size_bytes());
+}
+
 void MaxwellDMA::Launch() {
     LOG_TRACE(Render_OpenGL, "DMA copy 0x{:x} -> 0x{:x}", static_cast<GPUVAddr>(regs.offset_in),
               static_cast<GPUVAddr>(regs.offset_out));
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
@@ -221,6 +221,7 @@ struct GPU::Impl {
 
     void RendererFrameEndNotify() {
         system.GetPerfStats().EndGameFrame();
+        gpu_thread.OnFrameEnd();
     }
 
     /// Performs any additional setup necessary in order to begin GPU emulation.
@@ -255,6 +256,15 @@ struct GPU::Impl {
         gpu_thread.SubmitList(channel, std::move(entries));
     }
 
+    /// Push several GPU command lists to be processed at once
+    void PushGPUEntries(s32 channel, std::span<Tegra::CommandList> entries) {
+        gpu_thread.SubmitLists(channel, entries);
+    }
+
+    [[nodiscard]] VideoCommon::GPUThread::ThreadStatistics GetThreadStatistics() const {
+        return gpu_thread.GetFrameStatistics();
+    }
+
     /// Notify rasterizer that any caches of the specified region should be flushed to Switch memory
     void FlushRegion(DAddr addr, u64 size) {
         gpu_thread.FlushRegion(addr, size);
@@ -536,6 +546,14 @@ void GPU::PushGPUEntries(s32 channel, Tegra::CommandList&& entries) {
     impl->PushGPUEntries(channel, std::move(entries));
 }
 
+void GPU::PushGPUEntries(s32 channel, std::span<Tegra::CommandList> entries) {
+    impl->PushGPUEntries(channel, entries);
+}
+
+VideoCommon::GPUThread::ThreadStatistics GPU::GetThreadStatistics() const {
+    return impl->GetThreadStatistics();
+}
+
 VideoCore::RasterizerDownloadArea GPU::OnCPURead(PAddr addr, u64 size) {
     return impl->OnCPURead(addr, size);
 }
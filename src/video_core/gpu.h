@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include "common/bit_field.h"
 #include "common/common_types.h"
@@ -24,6 +25,10 @@ class RendererBase;
 class ShaderNotify;
 } // namespace VideoCore
 
+namespace VideoCommon::GPUThread {
+struct ThreadStatistics;
+} // namespace VideoCommon::GPUThread
+
 namespace Tegra {
 class DmaPusher;
 struct CommandList;
@@ -237,6 +242,12 @@ public:
     /// Push GPU command entries to be processed
     void PushGPUEntries(s32 channel, Tegra::CommandList&& entries);
 
+    /// Push several GPU command lists to be processed at once
+    void PushGPUEntries(s32 channel, std::span<Tegra::CommandList> entries);
+
+    /// Returns the GPU thread counters of the last presented frame
+    [[nodiscard]] VideoCommon::GPUThread::ThreadStatistics GetThreadStatistics() const;
+
     /// Notify rasterizer that any caches of the specified region should be flushed to Switch memory
     [[nodiscard]] VideoCore::RasterizerDownloadArea OnCPURead(DAddr addr, u64 size);
 
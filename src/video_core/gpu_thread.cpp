@@ -1,12 +1,16 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/assert.h"
+#include "common/logging/log.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
+#include "common/spin_lock.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/frontend/graphics_context.h"
@@ -19,6 +23,135 @@
 
 namespace VideoCommon::GPUThread {
 
+namespace {
+// Bounds of the adaptive spin of the GPU thread, in pause instructions
+constexpr u32 MinSpin = 64;
+constexpr u32 MaxSpin = 1U << 14;
+
+u32 MaxSpinForHost() {
+    // Spinning on a single core host only delays the producer we are waiting for
+    return std::thread::hardware_concurrency() > 1 ? MaxSpin : 0;
+}
+} // Anonymous namespace
+
+CommandRing::CommandRing()
+    : slots(Capacity), max_spin{MaxSpinForHost()}, spin_limit{std::min(MinSpin, max_spin)} {}
+
+CommandRing::~CommandRing() = default;
+
+void CommandRing::Push(CommandData&& data, u64 fence, bool block) {
+    CommandDataContainer& slot{NextSlot()};
+    slot.data = std::move(data);
+    CommitSlot(slot, fence, block);
+}
+
+void CommandRing::PushList(s32 channel, Tegra::CommandList&& entries, u64 fence, bool block) {
+    CommandDataContainer& slot{NextSlot()};
+    if (auto* const submit_list = std::get_if<SubmitListCommand>(&slot.data)) {
+        // Move assigning keeps the storage the slot's lists already have
+        submit_list->channel = channel;
+        submit_list->entries = std::move(entries);
+    } else {
+        slot.data.emplace<SubmitListCommand>(channel, std::move(entries));
+    }
+    CommitSlot(slot, fence, block);
+}
+
+void CommandRing::Publish() {
+    if (pending_index == write_index.load(std::memory_order_relaxed)) {
+        return;
+    }
+    // Sequentially consistent so either the GPU thread sees the new commands before sleeping, or
+    // we see that it is sleeping
+    write_index.store(pending_index, std::memory_order_seq_cst);
+
+    const u64 depth{pending_index - read_index.load(std::memory_order_relaxed)};
+    u64 deepest{max_depth.load(std::memory_order_relaxed)};
+    while (depth > deepest &&
+           !max_depth.compare_exchange_weak(deepest, depth, std::memory_order_relaxed)) {
+    }
+    if (consumer_sleeping.load(std::memory_order_seq_cst)) {
+        wakeups.fetch_add(1, std::memory_order_relaxed);
+        std::scoped_lock lk{mutex};
+        consumer_cv.notify_one();
+    }
+}
+
+CommandDataContainer* CommandRing::Front(std::stop_token stop_token) {
+    const size_t read{read_index.load(std::memory_order_relaxed)};
+    if (read == write_index.load(std::memory_order_acquire) && !Spin(read)) {
+        std::unique_lock lk{mutex};
+        consumer_sleeping.store(true, std::memory_order_seq_cst);
+        Common::CondvarWait(consumer_cv, lk, stop_token, [this, read] {
+            return read != write_index.load(std::memory_order_seq_cst);
+        });
+        consumer_sleeping.store(false, std::memory_order_relaxed);
+        if (stop_token.stop_requested()) {
+            return nullptr;
+        }
+    }
+    return &slots[read % Capacity];
+}
+
+void CommandRing::Pop() {
+    read_index.store(read_index.load(std::memory_order_relaxed) + 1, std::memory_order_seq_cst);
+    if (producer_sleeping.load(std::memory_order_seq_cst)) {
+        std::scoped_lock lk{mutex};
+        producer_cv.notify_one();
+    }
+}
+
+ThreadStatistics CommandRing::TakeStatistics() {
+    return ThreadStatistics{
+        .commands = commands.exchange(0, std::memory_order_relaxed),
+        .max_depth = max_depth.exchange(0, std::memory_order_relaxed),
+        .wakeups = wakeups.exchange(0, std::memory_order_relaxed),
+        .spin_hits = spin_hits.exchange(0, std::memory_order_relaxed),
+        .producer_stalls = producer_stalls.exchange(0, std::memory_order_relaxed),
+    };
+}
+
+CommandDataContainer& CommandRing::NextSlot() {
+    if (pending_index - read_index.load(std::memory_order_acquire) == Capacity) {
+        WaitForSpace();
+    }
+    return slots[pending_index % Capacity];
+}
+
+void CommandRing::CommitSlot(CommandDataContainer& slot, u64 fence, bool block) {
+    slot.fence = fence;
+    slot.block = block;
+    ++pending_index;
+    commands.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool CommandRing::Spin(size_t read) {
+    for (u32 iteration = 0; iteration < spin_limit; ++iteration) {
+        Common::ThreadPause();
+        if (read != write_index.load(std::memory_order_acquire)) {
+            // Work arrives in bursts, spin longer next time
+            spin_limit = std::min(spin_limit * 2, max_spin);
+            spin_hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    spin_limit = std::max(spin_limit / 2, std::min(MinSpin, max_spin));
+    return false;
+}
+
+void CommandRing::WaitForSpace() {
+    // The GPU thread can only free slots it can see
+    Publish();
+    producer_stalls.fetch_add(1, std::memory_order_relaxed);
+
+    std::unique_lock lk{mutex};
+    producer_sleeping.store(true, std::memory_order_seq_cst);
+    producer_cv.wait(lk, [this] {
+        return pending_index - read_index.load(std::memory_order_seq_cst) < Capacity;
+    });
+    producer_sleeping.store(false, std::memory_order_relaxed);
+}
+
 /// Runs the GPU thread
 static void RunThread(std::stop_token stop_token, Core::System& system,
                       VideoCore::RendererBase& renderer, Core::Frontend::GraphicsContext& context,
@@ -32,26 +165,31 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
     auto current_context = context.Acquire();
     VideoCore::RasterizerInterface* const rasterizer = renderer.ReadRasterizer();
 
-    CommandDataContainer next;
-
     while (!stop_token.stop_requested()) {
-        state.queue.PopWait(next, stop_token);
-        if (stop_token.stop_requested()) {
+        CommandDataContainer* const next = state.ring.Front(stop_token);
+        if (!next) {
             break;
         }
-        if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
+        if (auto* submit_list = std::get_if<SubmitListCommand>(&next->data)) {
             scheduler.Push(submit_list->channel, std::move(submit_list->entries));
-        } else if (std::holds_alternative<GPUTickCommand>(next.data)) {
+            // Leave the slot's lists empty, the next list pushed to it reuses their storage
+            submit_list->entries.command_lists.clear();
+            submit_list->entries.prefetch_command_list.clear();
+        } else if (std::holds_alternative<GPUTickCommand>(next->data)) {
             system.GPU().TickWork();
-        } else if (const auto* flush = std::get_if<FlushRegionCommand>(&next.data)) {
+        } else if (const auto* flush = std::get_if<FlushRegionCommand>(&next->data)) {
             rasterizer->FlushRegion(flush->addr, flush->size);
-        } else if (const auto* invalidate = std::get_if<InvalidateRegionCommand>(&next.data)) {
+        } else if (const auto* invalidate = std::get_if<InvalidateRegionCommand>(&next->data)) {
             rasterizer->OnCacheInvalidation(invalidate->addr, invalidate->size);
         } else {
             ASSERT(false);
         }
-        state.signaled_fence.store(next.fence);
-        if (next.block) {
+        const u64 fence{next->fence};
+        const bool block{next->block};
+        state.ring.Pop();
+
+        state.signaled_fence.store(fence);
+        if (block) {
             // We have to lock the write_lock to ensure that the condition_variable wait not get a
             // race between the check and the lock itself.
             std::scoped_lock lk{state.write_lock};
@@ -74,7 +212,23 @@ void ThreadManager::StartThread(VideoCore::RendererBase& renderer,
 }
 
 void ThreadManager::SubmitList(s32 channel, Tegra::CommandList&& entries) {
-    PushCommand(SubmitListCommand(channel, std::move(entries)));
+    SubmitLists(channel, std::span(&entries, 1));
+}
+
+void ThreadManager::SubmitLists(s32 channel, std::span<Tegra::CommandList> lists) {
+    if (lists.empty()) {
+        return;
+    }
+    std::unique_lock lk(state.write_lock);
+    for (Tegra::CommandList& entries : lists) {
+        // In synchronous GPU mode, only the last list has to block the caller
+        const bool block{!is_async && &entries == &lists.back()};
+        state.ring.PushList(channel, std::move(entries), ++state.last_fence, block);
+    }
+    state.ring.Publish();
+    if (!is_async) {
+        WaitForFence(lk, state.last_fence);
+    }
 }
 
 void ThreadManager::FlushRegion(DAddr addr, u64 size) {
@@ -96,6 +250,22 @@ void ThreadManager::TickGPU() {
     PushCommand(GPUTickCommand());
 }
 
+void ThreadManager::OnFrameEnd() {
+    const ThreadStatistics statistics{state.ring.TakeStatistics()};
+    LOG_DEBUG(HW_GPU,
+              "GPU thread frame: {} commands, max depth {}, {} wakeups, {} spin hits, "
+              "{} producer stalls",
+              statistics.commands, statistics.max_depth, statistics.wakeups, statistics.spin_hits,
+              statistics.producer_stalls);
+    std::scoped_lock lk{statistics_mutex};
+    frame_statistics = statistics;
+}
+
+ThreadStatistics ThreadManager::GetFrameStatistics() const {
+    std::scoped_lock lk{statistics_mutex};
+    return frame_statistics;
+}
+
 void ThreadManager::InvalidateRegion(DAddr addr, u64 size) {
     rasterizer->OnCacheInvalidation(addr, size);
 }
@@ -113,15 +283,20 @@ u64 ThreadManager::PushCommand(CommandData&& command_data, bool block) {
 
     std::unique_lock lk(state.write_lock);
     const u64 fence{++state.last_fence};
-    state.queue.EmplaceWait(std::move(command_data), fence, block);
+    state.ring.Push(std::move(command_data), fence, block);
+    state.ring.Publish();
 
     if (block) {
-        Common::CondvarWait(state.cv, lk, thread.get_stop_token(), [this, fence] {
-            return fence <= state.signaled_fence.load(std::memory_order_relaxed);
-        });
+        WaitForFence(lk, fence);
     }
 
     return fence;
 }
 
+void ThreadManager::WaitForFence(std::unique_lock<std::mutex>& lock, u64 fence) {
+    Common::CondvarWait(state.cv, lock, thread.get_stop_token(), [this, fence] {
+        return fence <= state.signaled_fence.load(std::memory_order_relaxed);
+    });
+}
+
 } // namespace VideoCommon::GPUThread
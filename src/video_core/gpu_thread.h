@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,10 +10,11 @@
 #include <condition_variable>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <thread>
 #include <variant>
+#include <vector>
 
-#include "common/bounded_threadsafe_queue.h"
 #include "common/polyfill_thread.h"
 #include "video_core/framebuffer_config.h"
 
@@ -87,11 +91,87 @@ struct CommandDataContainer {
     bool block{};
 };
 
+/// Counters of the traffic between the emulated CPU threads and the GPU thread
+struct ThreadStatistics {
+    u64 commands{};        ///< Commands submitted to the GPU thread
+    u64 max_depth{};       ///< Most commands waiting in the ring at once
+    u64 wakeups{};         ///< Times a producer had to wake up the sleeping GPU thread
+    u64 spin_hits{};       ///< Times the GPU thread found work while spinning instead of sleeping
+    u64 producer_stalls{}; ///< Times a producer waited for the GPU thread to free a slot
+};
+
+/**
+ * Fixed ring of command slots between the emulated CPU threads and the GPU thread. Slots are
+ * allocated once and reused, so submitting a command only moves its payload into place. Pushed
+ * commands become visible in batches on Publish, and the GPU thread only has to be woken up when
+ * it found the ring empty for long enough to go to sleep.
+ */
+class CommandRing final {
+public:
+    static constexpr size_t Capacity = 0x1000;
+
+    CommandRing();
+    ~CommandRing();
+
+    CommandRing(const CommandRing&) = delete;
+    CommandRing& operator=(const CommandRing&) = delete;
+
+    /// Moves a command into the next free slot without making it visible to the GPU thread,
+    /// waiting while the ring is full. Producers must be serialized by the caller.
+    void Push(CommandData&& data, u64 fence, bool block);
+
+    /// Like Push for a command list, moves it into the lists of the slot to reuse their storage
+    void PushList(s32 channel, Tegra::CommandList&& entries, u64 fence, bool block);
+
+    /// Makes the pushed commands visible to the GPU thread, waking it up if it is asleep
+    void Publish();
+
+    /// Returns the oldest published command, spinning and then sleeping while there is none.
+    /// Returns nullptr when a stop was requested.
+    [[nodiscard]] CommandDataContainer* Front(std::stop_token stop_token);
+
+    /// Releases the slot of the command returned by Front
+    void Pop();
+
+    /// Returns the counters accumulated since the last call and resets them
+    [[nodiscard]] ThreadStatistics TakeStatistics();
+
+private:
+    /// Returns the next free slot, waiting while the ring is full
+    CommandDataContainer& NextSlot();
+
+    /// Stores the synchronization data of the slot returned by NextSlot and marks it as pushed
+    void CommitSlot(CommandDataContainer& slot, u64 fence, bool block);
+
+    bool Spin(size_t read);
+    void WaitForSpace();
+
+    std::vector<CommandDataContainer> slots;
+
+    alignas(128) std::atomic<size_t> read_index{};
+    alignas(128) std::atomic<size_t> write_index{};
+    size_t pending_index{}; ///< End of the pushed commands, only accessed by producers
+
+    const u32 max_spin;
+    u32 spin_limit; ///< Iterations the GPU thread spins before sleeping, adapts to the workload
+
+    std::mutex mutex;
+    std::condition_variable_any consumer_cv;
+    std::condition_variable_any producer_cv;
+    std::atomic<bool> consumer_sleeping{};
+    std::atomic<bool> producer_sleeping{};
+
+    std::atomic<u64> commands{};
+    std::atomic<u64> max_depth{};
+    std::atomic<u64> wakeups{};
+    std::atomic<u64> spin_hits{};
+    std::atomic<u64> producer_stalls{};
+};
+
 /// Struct used to synchronize the GPU thread
 struct SynchState final {
-    using CommandQueue = Common::MPSCQueue<CommandDataContainer>;
     std::mutex write_lock;
-    CommandQueue queue;
+    CommandRing ring;
     u64 last_fence{};
     std::atomic<u64> signaled_fence{};
     std::condition_variable_any cv;
@@ -110,6 +190,9 @@ public:
     /// Push GPU command entries to be processed
     void SubmitList(s32 channel, Tegra::CommandList&& entries);
 
+    /// Push several GPU command lists to be processed, waking up the GPU thread at most once
+    void SubmitLists(s32 channel, std::span<Tegra::CommandList> lists);
+
     /// Notify rasterizer that any caches of the specified region should be flushed to Switch memory
     void FlushRegion(DAddr addr, u64 size);
 
@@ -121,16 +204,28 @@ public:
 
     void TickGPU();
 
+    /// Closes the counters of the current frame, called when a frame has been presented
+    void OnFrameEnd();
+
+    /// Returns the counters of the last presented frame
+    [[nodiscard]] ThreadStatistics GetFrameStatistics() const;
+
 private:
     /// Pushes a command to be executed by the GPU thread
     u64 PushCommand(CommandData&& command_data, bool block = false);
 
+    /// Waits until the GPU thread has executed the command with the given fence
+    void WaitForFence(std::unique_lock<std::mutex>& lock, u64 fence);
+
     Core::System& system;
     const bool is_async;
     VideoCore::RasterizerInterface* rasterizer = nullptr;
 
     SynchState state;
     std::jthread thread;
+
+    mutable std::mutex statistics_mutex;
+    ThreadStatistics frame_statistics;
 };
 
 } // namespace VideoCommon::GPUThread
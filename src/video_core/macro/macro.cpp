@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
@@ -20,6 +20,7 @@
 #include "video_core/macro/macro.h"
 #include "video_core/macro/macro_hle.h"
 #include "video_core/macro/macro_interpreter.h"
+#include "video_core/macro/macro_synthesis.h"
 
 #ifdef ARCHITECTURE_x86_64
 #include "video_core/macro/macro_jit_x64.h"
@@ -57,7 +58,25 @@ static void Dump(u64 hash, std::span<const u32> code, bool decompiled = false) {
 MacroEngine::MacroEngine(Engines::Maxwell3D& maxwell3d_)
     : hle_macros{std::make_unique<Tegra::HLEMacro>(maxwell3d_)}, maxwell3d{maxwell3d_} {}
 
-MacroEngine::~MacroEngine() = default;
+MacroEngine::~MacroEngine() {
+    const u32 num_macros = statistics.num_lle_macros + statistics.num_hle_macros;
+    const u64 num_executions = statistics.num_lle_executions + statistics.num_hle_executions;
+    if (num_macros == 0) {
+        return;
+    }
+    const auto& synthesized = statistics.num_synthesized_macros;
+    LOG_INFO(HW_GPU,
+             "Macro HLE coverage: {}/{} macros, {}/{} executions; synthesized {} register "
+             "writes, {} const buffer uploads, {} memory uploads, {} clears, {} draws, {} "
+             "method calls",
+             statistics.num_hle_macros, num_macros, statistics.num_hle_executions, num_executions,
+             synthesized[static_cast<size_t>(Macro::Shape::RegisterWrites)],
+             synthesized[static_cast<size_t>(Macro::Shape::ConstBufferUpload)],
+             synthesized[static_cast<size_t>(Macro::Shape::MemoryUpload)],
+             synthesized[static_cast<size_t>(Macro::Shape::Clear)],
+             synthesized[static_cast<size_t>(Macro::Shape::Draw)],
+             synthesized[static_cast<size_t>(Macro::Shape::MethodCalls)]);
+}
 
 void MacroEngine::AddCode(u32 method, u32 data) {
     uploaded_macro_code[method].push_back(data);
@@ -73,8 +92,10 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
     if (compiled_macro != macro_cache.end()) {
         const auto& cache_info = compiled_macro->second;
         if (cache_info.has_hle_program) {
+            ++statistics.num_hle_executions;
             cache_info.hle_program->Execute(parameters, method);
         } else {
+            ++statistics.num_lle_executions;
             maxwell3d.RefreshParameters();
             cache_info.lle_program->Execute(parameters, method);
         }
@@ -96,36 +117,75 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
         }
         auto& cache_info = macro_cache[method];
 
+        const std::vector<u32>* code = nullptr;
         if (!mid_method.has_value()) {
-            cache_info.lle_program = Compile(macro_code->second);
-            cache_info.hash = Common::HashValue(macro_code->second);
+            code = &macro_code->second;
         } else {
             const auto& macro_cached = uploaded_macro_code[mid_method.value()];
             const auto rebased_method = method - mid_method.value();
-            auto& code = uploaded_macro_code[method];
-            code.resize(macro_cached.size() - rebased_method);
-            std::memcpy(code.data(), macro_cached.data() + rebased_method,
-                        code.size() * sizeof(u32));
-            cache_info.hash = Common::HashValue(code);
-            cache_info.lle_program = Compile(code);
+            auto& rebased_code = uploaded_macro_code[method];
+            rebased_code.resize(macro_cached.size() - rebased_method);
+            std::memcpy(rebased_code.data(), macro_cached.data() + rebased_method,
+                        rebased_code.size() * sizeof(u32));
+            code = &rebased_code;
         }
+        cache_info.hash = Common::HashValue(*code);
+        cache_info.lle_program = GetProgram(cache_info.hash, *code);
 
-        auto hle_program = hle_macros->GetHLEProgram(cache_info.hash);
-        if (!hle_program || Settings::values.disable_macro_hle) {
+        auto hle_program = GetHLEProgram(cache_info, *code);
+        if (!hle_program) {
+            ++statistics.num_lle_macros;
+            ++statistics.num_lle_executions;
             maxwell3d.RefreshParameters();
             cache_info.lle_program->Execute(parameters, method);
         } else {
+            ++statistics.num_hle_macros;
+            ++statistics.num_hle_executions;
             cache_info.has_hle_program = true;
             cache_info.hle_program = std::move(hle_program);
             cache_info.hle_program->Execute(parameters, method);
         }
 
         if (Settings::values.dump_macros) {
-            Dump(cache_info.hash, macro_code->second, cache_info.has_hle_program);
+            Dump(cache_info.hash, *code, cache_info.has_hle_program);
         }
     }
 }
 
+std::unique_ptr<CachedMacro> MacroEngine::GetHLEProgram(const CacheInfo& cache_info,
+                                                        const std::vector<u32>& code) {
+    if (Settings::values.disable_macro_hle) {
+        return nullptr;
+    }
+    if (auto hle_program = hle_macros->GetHLEProgram(cache_info.hash)) {
+        return hle_program;
+    }
+    // Macros whose behavior does not depend on their parameter values or on register state
+    // are replaced by the methods they send
+    std::optional<MacroTrace> trace = TraceMacro(code);
+    if (!trace) {
+        return nullptr;
+    }
+    ++statistics.num_synthesized_macros[static_cast<size_t>(ClassifyTrace(*trace))];
+    return SynthesizeHLEProgram(maxwell3d, std::move(*trace), cache_info.lle_program);
+}
+
+std::shared_ptr<CachedMacro> MacroEngine::GetProgram(u64 hash, const std::vector<u32>& code) {
+    const auto [begin, end] = compiled_programs.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+        if (it->second.code == code) {
+            return it->second.program;
+        }
+    }
+    if (compiled_programs.size() >= MAX_COMPILED_PROGRAMS) {
+        // Programs of uploaded macros are kept alive by the macro cache
+        compiled_programs.clear();
+    }
+    std::shared_ptr<CachedMacro> program{Compile(code)};
+    compiled_programs.emplace(hash, CompiledProgram{code, program});
+    return program;
+}
+
 std::unique_ptr<MacroEngine> GetMacroEngine(Engines::Maxwell3D& maxwell3d) {
     if (Settings::values.disable_macro_jit) {
         return std::make_unique<MacroInterpreter>(maxwell3d);
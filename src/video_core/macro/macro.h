@@ -1,8 +1,12 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -93,6 +97,17 @@ union MethodAddress {
     BitField<12, 6, u32> increment;
 };
 
+/// Native work done by a macro that was synthesized into an HLE program
+enum class Shape : u32 {
+    RegisterWrites,
+    ConstBufferUpload,
+    MemoryUpload,
+    Clear,
+    Draw,
+    MethodCalls,
+};
+constexpr std::size_t NUM_SHAPES = 6;
+
 } // namespace Macro
 
 class HLEMacro;
@@ -127,16 +142,44 @@ protected:
     virtual std::unique_ptr<CachedMacro> Compile(const std::vector<u32>& code) = 0;
 
 private:
+    /// Returns the compiled program for code, compiling it if it was never seen before
+    std::shared_ptr<CachedMacro> GetProgram(u64 hash, const std::vector<u32>& code);
+
     struct CacheInfo {
-        std::unique_ptr<CachedMacro> lle_program{};
+        std::shared_ptr<CachedMacro> lle_program{};
         std::unique_ptr<CachedMacro> hle_program{};
         u64 hash{};
         bool has_hle_program{};
     };
 
+    /// How much of the title's macro work runs natively, logged when the engine is destroyed
+    struct Statistics {
+        u32 num_lle_macros{};
+        u32 num_hle_macros{};
+        std::array<u32, Macro::NUM_SHAPES> num_synthesized_macros{};
+        u64 num_lle_executions{};
+        u64 num_hle_executions{};
+    };
+
+    /// Returns a native program for the macro, either hand written or synthesized from code
+    std::unique_ptr<CachedMacro> GetHLEProgram(const CacheInfo& cache_info,
+                                               const std::vector<u32>& code);
+
     std::unordered_map<u32, CacheInfo> macro_cache;
+    struct CompiledProgram {
+        std::vector<u32> code;
+        std::shared_ptr<CachedMacro> program;
+    };
+
+    /// Bound of compiled_programs, far above the number of macros titles upload
+    static constexpr size_t MAX_COMPILED_PROGRAMS = 0x400;
+
+    /// Compiled programs by code hash, kept when a method is cleared so reuploads are not
+    /// compiled again
+    std::unordered_multimap<u64, CompiledProgram> compiled_programs;
     std::unordered_map<u32, std::vector<u32>> uploaded_macro_code;
     std::unique_ptr<HLEMacro> hle_macros;
+    Statistics statistics;
     Engines::Maxwell3D& maxwell3d;
 };
 
@@ -0,0 +1,452 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <optional>
+#include <utility>
+
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/macro/macro_synthesis.h"
+
+namespace Tegra {
+
+using Maxwell3D = Engines::Maxwell3D;
+
+namespace {
+// Bounds the symbolic execution of macros with constant loops
+constexpr u32 MAX_STEPS = 0x1000;
+
+/// Value of a register: a parameter plus an offset, a constant, or unknown when nullopt
+struct SymbolicValue {
+    u32 parameter{MacroTrace::CONSTANT};
+    u32 offset{};
+
+    [[nodiscard]] bool IsConstant() const {
+        return parameter == MacroTrace::CONSTANT;
+    }
+};
+using Value = std::optional<SymbolicValue>;
+
+Value Constant(u32 value) {
+    return SymbolicValue{MacroTrace::CONSTANT, value};
+}
+
+bool IsConstant(const Value& value) {
+    return value && value->IsConstant();
+}
+
+/// Mirrors MacroInterpreterImpl::Step over symbolic values
+class SymbolicExecutor {
+public:
+    explicit SymbolicExecutor(std::span<const u32> code_) : code{code_} {
+        registers.fill(Constant(0));
+        // $r1 holds the first parameter
+        registers[1] = SymbolicValue{0, 0};
+        trace.num_parameters = 1;
+    }
+
+    std::optional<MacroTrace> Run() {
+        while (true) {
+            const std::optional<bool> keep_executing = Step(false);
+            if (!keep_executing) {
+                return std::nullopt;
+            }
+            if (!*keep_executing) {
+                return std::move(trace);
+            }
+        }
+    }
+
+private:
+    /// Returns whether to keep executing, or nullopt when the macro cannot be traced
+    std::optional<bool> Step(bool is_delay_slot) {
+        if (++num_steps > MAX_STEPS || pc >= code.size()) {
+            return std::nullopt;
+        }
+        const u32 base_address = pc;
+        Macro::Opcode opcode{};
+        opcode.raw = code[pc];
+        ++pc;
+
+        if (delayed_pc) {
+            pc = *delayed_pc;
+            delayed_pc = std::nullopt;
+        }
+
+        const Value& src_a = registers[opcode.src_a];
+        const Value& src_b = registers[opcode.src_b];
+        Value result;
+        switch (opcode.operation) {
+        case Macro::Operation::ALU:
+            result = GetALUResult(opcode.alu_operation, src_a, src_b);
+            break;
+        case Macro::Operation::AddImmediate:
+            if (src_a) {
+                result = SymbolicValue{src_a->parameter,
+                                       src_a->offset + static_cast<u32>(opcode.immediate.Value())};
+            }
+            break;
+        case Macro::Operation::ExtractInsert:
+            if (IsConstant(src_a) && IsConstant(src_b)) {
+                const u32 mask = opcode.GetBitfieldMask();
+                const u32 src = (src_b->offset >> opcode.bf_src_bit) & mask;
+                result = Constant((src_a->offset & ~(mask << opcode.bf_dst_bit)) |
+                                  (src << opcode.bf_dst_bit));
+            }
+            break;
+        case Macro::Operation::ExtractShiftLeftImmediate:
+            if (IsConstant(src_a) && IsConstant(src_b) && src_a->offset < 32) {
+                result = Constant(((src_b->offset >> src_a->offset) & opcode.GetBitfieldMask())
+                                  << opcode.bf_dst_bit);
+            }
+            break;
+        case Macro::Operation::ExtractShiftLeftRegister:
+            if (IsConstant(src_a) && IsConstant(src_b) && src_a->offset < 32) {
+                result = Constant(
+                    ((src_b->offset >> opcode.bf_src_bit) & opcode.GetBitfieldMask())
+                    << src_a->offset);
+            }
+            break;
+        case Macro::Operation::Branch: {
+            if (is_delay_slot || !IsConstant(src_a)) {
+                return std::nullopt;
+            }
+            const bool taken = opcode.branch_condition == Macro::BranchCondition::Zero
+                                   ? src_a->offset == 0
+                                   : src_a->offset != 0;
+            if (taken) {
+                const s64 target = static_cast<s64>(base_address) + opcode.immediate;
+                if (target < 0) {
+                    return std::nullopt;
+                }
+                if (opcode.branch_annul) {
+                    pc = static_cast<u32>(target);
+                    return true;
+                }
+                delayed_pc = static_cast<u32>(target);
+                return Step(true);
+            }
+            return FinishStep(opcode, is_delay_slot);
+        }
+        default:
+            // Register reads depend on state outside of the macro
+            return std::nullopt;
+        }
+        if (!ProcessResult(opcode, result)) {
+            return std::nullopt;
+        }
+        return FinishStep(opcode, is_delay_slot);
+    }
+
+    std::optional<bool> FinishStep(Macro::Opcode opcode, bool is_delay_slot) {
+        if (opcode.is_exit && !is_delay_slot) {
+            if (!Step(true)) {
+                return std::nullopt;
+            }
+            return false;
+        }
+        return true;
+    }
+
+    Value GetALUResult(Macro::ALUOperation operation, const Value& a, const Value& b) {
+        const std::optional<bool> carry_in = std::exchange(carry, std::nullopt);
+        if (IsConstant(a) && IsConstant(b)) {
+            const u32 x = a->offset;
+            const u32 y = b->offset;
+            switch (operation) {
+            case Macro::ALUOperation::Add: {
+                const u64 result = static_cast<u64>(x) + y;
+                carry = result > 0xffffffff;
+                return Constant(static_cast<u32>(result));
+            }
+            case Macro::ALUOperation::AddWithCarry: {
+                if (!carry_in) {
+                    return std::nullopt;
+                }
+                const u64 result = static_cast<u64>(x) + y + (*carry_in ? 1ULL : 0ULL);
+                carry = result > 0xffffffff;
+                return Constant(static_cast<u32>(result));
+            }
+            case Macro::ALUOperation::Subtract: {
+                const u64 result = static_cast<u64>(x) - y;
+                carry = result < 0x100000000;
+                return Constant(static_cast<u32>(result));
+            }
+            case Macro::ALUOperation::SubtractWithBorrow: {
+                if (!carry_in) {
+                    return std::nullopt;
+                }
+                const u64 result = static_cast<u64>(x) - y - (*carry_in ? 0ULL : 1ULL);
+                carry = result < 0x100000000;
+                return Constant(static_cast<u32>(result));
+            }
+            case Macro::ALUOperation::Xor:
+                carry = carry_in;
+                return Constant(x ^ y);
+            case Macro::ALUOperation::Or:
+                carry = carry_in;
+                return Constant(x | y);
+            case Macro::ALUOperation::And:
+                carry = carry_in;
+                return Constant(x & y);
+            case Macro::ALUOperation::AndNot:
+                carry = carry_in;
+                return Constant(x & ~y);
+            case Macro::ALUOperation::Nand:
+                carry = carry_in;
+                return Constant(~(x & y));
+            default:
+                return std::nullopt;
+            }
+        }
+        switch (operation) {
+        case Macro::ALUOperation::Add:
+            // A parameter plus a constant keeps its shape, the carry becomes unknown
+            if (a && IsConstant(b)) {
+                return SymbolicValue{a->parameter, a->offset + b->offset};
+            }
+            if (IsConstant(a) && b) {
+                return SymbolicValue{b->parameter, b->offset + a->offset};
+            }
+            return std::nullopt;
+        case Macro::ALUOperation::Subtract:
+            if (a && IsConstant(b)) {
+                return SymbolicValue{a->parameter, a->offset - b->offset};
+            }
+            return std::nullopt;
+        case Macro::ALUOperation::Xor:
+        case Macro::ALUOperation::Or:
+        case Macro::ALUOperation::And:
+        case Macro::ALUOperation::AndNot:
+        case Macro::ALUOperation::Nand:
+            carry = carry_in;
+            if (operation == Macro::ALUOperation::And &&
+                ((IsConstant(a) && a->offset == 0) || (IsConstant(b) && b->offset == 0))) {
+                return Constant(0);
+            }
+            return std::nullopt;
+        default:
+            return std::nullopt;
+        }
+    }
+
+    Value FetchParameter() {
+        return SymbolicValue{trace.num_parameters++, 0};
+    }
+
+    void SetRegister(u32 index, const Value& value) {
+        if (index != 0) {
+            registers[index] = value;
+        }
+    }
+
+    bool Send(const Value& value) {
+        if (!value || !IsConstant(method_address) || trace.sends.size() >= MAX_STEPS) {
+            return false;
+        }
+        Macro::MethodAddress address{};
+        address.raw = method_address->offset;
+        trace.sends.push_back({
+            .method = address.address,
+            .parameter = value->parameter,
+            .offset = value->offset,
+        });
+        address.address.Assign(address.address.Value() + address.increment.Value());
+        method_address = Constant(address.raw);
+        return true;
+    }
+
+    bool ProcessResult(Macro::Opcode opcode, const Value& result) {
+        switch (opcode.result_operation) {
+        case Macro::ResultOperation::IgnoreAndFetch:
+            SetRegister(opcode.dst, FetchParameter());
+            return true;
+        case Macro::ResultOperation::Move:
+            SetRegister(opcode.dst, result);
+            return true;
+        case Macro::ResultOperation::MoveAndSetMethod:
+            SetRegister(opcode.dst, result);
+            method_address = result;
+            return true;
+        case Macro::ResultOperation::FetchAndSend:
+            SetRegister(opcode.dst, FetchParameter());
+            return Send(result);
+        case Macro::ResultOperation::MoveAndSend:
+            SetRegister(opcode.dst, result);
+            return Send(result);
+        case Macro::ResultOperation::FetchAndSetMethod:
+            SetRegister(opcode.dst, FetchParameter());
+            method_address = result;
+            return true;
+        case Macro::ResultOperation::MoveAndSetMethodFetchAndSend:
+            SetRegister(opcode.dst, result);
+            method_address = result;
+            return Send(FetchParameter());
+        case Macro::ResultOperation::MoveAndSetMethodSend:
+            SetRegister(opcode.dst, result);
+            method_address = result;
+            if (!IsConstant(result)) {
+                return false;
+            }
+            return Send(Constant((result->offset >> 12) & 0b111111));
+        }
+        return false;
+    }
+
+    std::span<const u32> code;
+    u32 pc{};
+    std::optional<u32> delayed_pc;
+    u32 num_steps{};
+
+    std::array<Value, Macro::NUM_MACRO_REGISTERS> registers;
+    Value method_address{Constant(0)};
+    std::optional<bool> carry{false};
+
+    MacroTrace trace;
+};
+
+bool IsConstBufferData(u32 method) {
+    constexpr u32 first = MAXWELL3D_REG_INDEX(const_buffer.buffer);
+    return method >= first && method < first + 16;
+}
+
+bool IsDrawMethod(u32 method) {
+    switch (method) {
+    case MAXWELL3D_REG_INDEX(draw.end):
+    case MAXWELL3D_REG_INDEX(draw.begin):
+    case MAXWELL3D_REG_INDEX(vertex_buffer.count):
+    case MAXWELL3D_REG_INDEX(index_buffer.count):
+    case MAXWELL3D_REG_INDEX(draw_inline_index):
+    case MAXWELL3D_REG_INDEX(index_buffer32_first):
+    case MAXWELL3D_REG_INDEX(index_buffer16_first):
+    case MAXWELL3D_REG_INDEX(index_buffer8_first):
+    case MAXWELL3D_REG_INDEX(vertex_array_instance_first):
+    case MAXWELL3D_REG_INDEX(vertex_array_instance_subsequent):
+        return true;
+    default:
+        return false;
+    }
+}
+
+class HLE_Synthesized final : public CachedMacro {
+public:
+    explicit HLE_Synthesized(Maxwell3D& maxwell3d_, MacroTrace trace_,
+                             std::shared_ptr<CachedMacro> fallback_)
+        : maxwell3d{maxwell3d_}, trace{std::move(trace_)}, fallback{std::move(fallback_)},
+          values(trace.sends.size()) {
+        // Group the sends the same way DmaPusher groups methods
+        const auto& sends = trace.sends;
+        for (u32 first = 0; first < sends.size();) {
+            const u32 method = sends[first].method;
+            u32 count = 1;
+            RunKind kind = RunKind::Method;
+            if (method < Maxwell3D::Regs::NUM_REGS && !maxwell3d.execution_mask[method]) {
+                while (first + count < sends.size() &&
+                       sends[first + count].method == method + count &&
+                       !maxwell3d.execution_mask[method + count]) {
+                    ++count;
+                }
+                kind = count > 1 ? RunKind::Registers : RunKind::Method;
+            } else if (IsConstBufferData(method)) {
+                while (first + count < sends.size() &&
+                       IsConstBufferData(sends[first + count].method)) {
+                    ++count;
+                }
+                kind = RunKind::ConstBuffer;
+            }
+            runs.push_back({kind, method, first, count});
+            first += count;
+        }
+    }
+
+    void Execute(const std::vector<u32>& parameters, u32 method) override {
+        maxwell3d.RefreshParameters();
+        if (parameters.size() != trace.num_parameters) {
+            fallback->Execute(parameters, method);
+            return;
+        }
+        for (size_t index = 0; index < values.size(); ++index) {
+            const MacroTrace::Send& send = trace.sends[index];
+            values[index] = send.parameter == MacroTrace::CONSTANT
+                                ? send.offset
+                                : parameters[send.parameter] + send.offset;
+        }
+        for (const Run& run : runs) {
+            const u32* const data = values.data() + run.first;
+            switch (run.kind) {
+            case RunKind::Method:
+                maxwell3d.CallMethod(run.method, *data, true);
+                break;
+            case RunKind::Registers:
+                maxwell3d.CallMethods(run.method, std::span(data, run.count));
+                break;
+            case RunKind::ConstBuffer:
+                maxwell3d.CallMultiMethod(run.method, data, run.count, run.count);
+                break;
+            }
+        }
+    }
+
+private:
+    enum class RunKind : u32 {
+        Method,
+        Registers,
+        ConstBuffer,
+    };
+
+    struct Run {
+        RunKind kind;
+        u32 method;
+        u32 first;
+        u32 count;
+    };
+
+    Maxwell3D& maxwell3d;
+    MacroTrace trace;
+    std::shared_ptr<CachedMacro> fallback;
+    std::vector<Run> runs;
+    std::vector<u32> values;
+};
+} // Anonymous namespace
+
+std::optional<MacroTrace> TraceMacro(std::span<const u32> code) {
+    return SymbolicExecutor{code}.Run();
+}
+
+Macro::Shape ClassifyTrace(const MacroTrace& trace) {
+    bool has_cb_data = false;
+    bool has_upload = false;
+    bool has_clear = false;
+    bool has_methods = false;
+    for (const MacroTrace::Send& send : trace.sends) {
+        if (IsDrawMethod(send.method)) {
+            return Macro::Shape::Draw;
+        }
+        has_cb_data |= IsConstBufferData(send.method);
+        has_upload |= send.method == MAXWELL3D_REG_INDEX(launch_dma) ||
+                      send.method == MAXWELL3D_REG_INDEX(inline_data);
+        has_clear |= send.method == MAXWELL3D_REG_INDEX(clear_surface);
+        has_methods |= send.method >= Maxwell3D::Regs::NUM_REGS;
+    }
+    if (has_clear) {
+        return Macro::Shape::Clear;
+    }
+    if (has_upload) {
+        return Macro::Shape::MemoryUpload;
+    }
+    if (has_cb_data) {
+        return Macro::Shape::ConstBufferUpload;
+    }
+    if (has_methods) {
+        return Macro::Shape::MethodCalls;
+    }
+    return Macro::Shape::RegisterWrites;
+}
+
+std::unique_ptr<CachedMacro> SynthesizeHLEProgram(Engines::Maxwell3D& maxwell3d,
+                                                  MacroTrace trace,
+                                                  std::shared_ptr<CachedMacro> fallback) {
+    return std::make_unique<HLE_Synthesized>(maxwell3d, std::move(trace), std::move(fallback));
+}
+
+} // namespace Tegra
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/macro/macro.h"
+
+namespace Tegra {
+
+namespace Engines {
+class Maxwell3D;
+}
+
+/// Every method a macro sends, proven for all parameter values by running it symbolically
+struct MacroTrace {
+    static constexpr u32 CONSTANT = ~0U;
+
+    struct Send {
+        u32 method;
+        /// Parameter the value is taken from, or CONSTANT
+        u32 parameter;
+        /// Added to the parameter, or the value itself when constant
+        u32 offset;
+    };
+
+    std::vector<Send> sends;
+    /// Number of parameters the macro consumes
+    u32 num_parameters{};
+};
+
+/// Runs code symbolically. Returns nullopt when its control flow or its methods depend on the
+/// values of its parameters, or when it reads registers.
+[[nodiscard]] std::optional<MacroTrace> TraceMacro(std::span<const u32> code);
+
+/// Classifies the native work done by a trace
+[[nodiscard]] Macro::Shape ClassifyTrace(const MacroTrace& trace);
+
+/// Builds a native implementation of trace. Calls with an unexpected number of parameters are
+/// passed to fallback.
+[[nodiscard]] std::unique_ptr<CachedMacro> SynthesizeHLEProgram(
+    Engines::Maxwell3D& maxwell3d, MacroTrace trace, std::shared_ptr<CachedMacro> fallback);
+
+} // namespace Tegra
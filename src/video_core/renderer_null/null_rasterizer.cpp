@@ -1,14 +1,111 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
 #include "common/alignment.h"
+#include "common/settings.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/memory_manager.h"
 #include "video_core/renderer_null/null_rasterizer.h"
+#include "video_core/surface.h"
+#include "video_core/texture_cache/image_info.h"
+#include "video_core/texture_cache/util.h"
 
 namespace Null {
 
+namespace {
+
+using VideoCore::Surface::PixelFormat;
+
+u8 ToUnorm8(f32 value) {
+    return static_cast<u8>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+}
+
+u8 ToSrgb8(f32 value) {
+    value = std::clamp(value, 0.0f, 1.0f);
+    value = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    return ToUnorm8(value);
+}
+
+u16 ToHalf(f32 value) {
+    const u32 bits = std::bit_cast<u32>(value);
+    const u32 sign = (bits >> 16) & 0x8000;
+    const u32 float_exponent = (bits >> 23) & 0xff;
+    u32 mantissa = bits & 0x7fffff;
+    if (float_exponent == 0xff) {
+        return static_cast<u16>(sign | 0x7c00 | (mantissa != 0 ? 0x200 : 0));
+    }
+    const s32 exponent = static_cast<s32>(float_exponent) - 127 + 15;
+    if (exponent >= 0x1f) {
+        return static_cast<u16>(sign | 0x7c00);
+    }
+    if (exponent <= 0) {
+        if (exponent < -10) {
+            return static_cast<u16>(sign);
+        }
+        mantissa |= 0x800000;
+        const u32 shift = static_cast<u32>(14 - exponent);
+        return static_cast<u16>((sign | (mantissa >> shift)) + ((mantissa >> (shift - 1)) & 1));
+    }
+    const u32 half = sign | (static_cast<u32>(exponent) << 10) | (mantissa >> 13);
+    // Rounding may carry into the exponent, which still yields the nearest value
+    return static_cast<u16>(half + ((mantissa >> 12) & 1));
+}
+
+/// Encodes a clear color in the given format, returning the size of a texel or zero when the
+/// format is not supported
+size_t EncodeClearColor(PixelFormat format, const std::array<f32, 4>& color,
+                        std::array<u8, 16>& texel) {
+    switch (format) {
+    case PixelFormat::A8B8G8R8_UNORM:
+        texel = {ToUnorm8(color[0]), ToUnorm8(color[1]), ToUnorm8(color[2]), ToUnorm8(color[3])};
+        return 4;
+    case PixelFormat::A8B8G8R8_SRGB:
+        texel = {ToSrgb8(color[0]), ToSrgb8(color[1]), ToSrgb8(color[2]), ToUnorm8(color[3])};
+        return 4;
+    case PixelFormat::B8G8R8A8_UNORM:
+        texel = {ToUnorm8(color[2]), ToUnorm8(color[1]), ToUnorm8(color[0]), ToUnorm8(color[3])};
+        return 4;
+    case PixelFormat::B8G8R8A8_SRGB:
+        texel = {ToSrgb8(color[2]), ToSrgb8(color[1]), ToSrgb8(color[0]), ToUnorm8(color[3])};
+        return 4;
+    case PixelFormat::A2B10G10R10_UNORM: {
+        const auto unorm = [&color](size_t index, f32 max) {
+            return static_cast<u32>(std::lround(std::clamp(color[index], 0.0f, 1.0f) * max));
+        };
+        const u32 value = unorm(0, 1023.0f) | unorm(1, 1023.0f) << 10 | unorm(2, 1023.0f) << 20 |
+                          unorm(3, 3.0f) << 30;
+        std::memcpy(texel.data(), &value, sizeof(value));
+        return sizeof(value);
+    }
+    case PixelFormat::R16G16B16A16_FLOAT: {
+        const std::array<u16, 4> value{ToHalf(color[0]), ToHalf(color[1]), ToHalf(color[2]),
+                                       ToHalf(color[3])};
+        std::memcpy(texel.data(), value.data(), sizeof(value));
+        return sizeof(value);
+    }
+    case PixelFormat::R32G32B32A32_FLOAT:
+        std::memcpy(texel.data(), color.data(), sizeof(color));
+        return sizeof(color);
+    case PixelFormat::R32_FLOAT:
+        std::memcpy(texel.data(), color.data(), sizeof(f32));
+        return sizeof(f32);
+    default:
+        return 0;
+    }
+}
+
+} // Anonymous namespace
+
 AccelerateDMA::AccelerateDMA() = default;
 
 bool AccelerateDMA::BufferCopy(GPUVAddr start_address, GPUVAddr end_address, u64 amount) {
@@ -18,13 +115,30 @@ bool AccelerateDMA::BufferClear(GPUVAddr src_address, u64 amount, u32 value) {
     return true;
 }
 
-RasterizerNull::RasterizerNull(Tegra::GPU& gpu) : m_gpu{gpu} {}
+RasterizerNull::RasterizerNull(Tegra::GPU& gpu, Tegra::MaxwellDeviceMemoryManager& device_memory)
+    : m_gpu{gpu} {
+    if (Settings::values.null_renderer_translate_shaders.GetValue()) {
+        m_shader_cache.emplace(device_memory);
+    }
+}
 RasterizerNull::~RasterizerNull() = default;
 
-void RasterizerNull::Draw(bool is_indexed, u32 instance_count) {}
+void RasterizerNull::Draw(bool is_indexed, u32 instance_count) {
+    if (m_shader_cache) {
+        m_shader_cache->TranslateGraphics();
+    }
+}
 void RasterizerNull::DrawTexture() {}
-void RasterizerNull::Clear(u32 layer_count) {}
-void RasterizerNull::DispatchCompute() {}
+void RasterizerNull::Clear(u32 layer_count) {
+    if (m_shader_cache) {
+        ClearColorTarget();
+    }
+}
+void RasterizerNull::DispatchCompute() {
+    if (m_shader_cache) {
+        m_shader_cache->TranslateCompute();
+    }
+}
 void RasterizerNull::ResetCounter(VideoCommon::QueryType type) {}
 void RasterizerNull::Query(GPUVAddr gpu_addr, VideoCommon::QueryType type,
                            VideoCommon::QueryPropertiesFlags flags, u32 payload, u32 subreport) {
@@ -47,11 +161,22 @@ void RasterizerNull::FlushRegion(DAddr addr, u64 size, VideoCommon::CacheType) {
 bool RasterizerNull::MustFlushRegion(DAddr addr, u64 size, VideoCommon::CacheType) {
     return false;
 }
-void RasterizerNull::InvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType) {}
+void RasterizerNull::InvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType which) {
+    if (m_shader_cache && True(which & VideoCommon::CacheType::ShaderCache)) {
+        m_shader_cache->InvalidateRegion(addr, size);
+    }
+}
 bool RasterizerNull::OnCPUWrite(PAddr addr, u64 size) {
+    if (m_shader_cache) {
+        m_shader_cache->InvalidateRegion(addr, size);
+    }
     return false;
 }
-void RasterizerNull::OnCacheInvalidation(PAddr addr, u64 size) {}
+void RasterizerNull::OnCacheInvalidation(PAddr addr, u64 size) {
+    if (m_shader_cache && addr != 0 && size != 0) {
+        m_shader_cache->InvalidateRegion(addr, size);
+    }
+}
 VideoCore::RasterizerDownloadArea RasterizerNull::GetFlushArea(PAddr addr, u64 size) {
     VideoCore::RasterizerDownloadArea new_area{
         .start_address = Common::AlignDown(addr, Core::DEVICE_PAGESIZE),
@@ -61,7 +186,11 @@ VideoCore::RasterizerDownloadArea RasterizerNull::GetFlushArea(PAddr addr, u64 s
     return new_area;
 }
 void RasterizerNull::InvalidateGPUCache() {}
-void RasterizerNull::UnmapMemory(DAddr addr, u64 size) {}
+void RasterizerNull::UnmapMemory(DAddr addr, u64 size) {
+    if (m_shader_cache) {
+        m_shader_cache->OnCacheInvalidation(addr, size);
+    }
+}
 void RasterizerNull::ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) {}
 void RasterizerNull::SignalFence(std::function<void()>&& func) {
     func();
@@ -76,7 +205,10 @@ void RasterizerNull::SignalSyncPoint(u32 value) {
 }
 void RasterizerNull::SignalReference() {}
 void RasterizerNull::ReleaseFences(bool) {}
-void RasterizerNull::FlushAndInvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType) {}
+void RasterizerNull::FlushAndInvalidateRegion(DAddr addr, u64 size,
+                                              VideoCommon::CacheType which) {
+    InvalidateRegion(addr, size, which);
+}
 void RasterizerNull::WaitForIdle() {}
 void RasterizerNull::FragmentBarrier() {}
 void RasterizerNull::TiledCacheBarrier() {}
@@ -96,12 +228,58 @@ void RasterizerNull::LoadDiskResources(u64 title_id, std::stop_token stop_loadin
                                        const VideoCore::DiskResourceLoadCallback& callback) {}
 void RasterizerNull::InitializeChannel(Tegra::Control::ChannelState& channel) {
     CreateChannel(channel);
+    if (m_shader_cache) {
+        m_shader_cache->CreateChannel(channel);
+    }
 }
 void RasterizerNull::BindChannel(Tegra::Control::ChannelState& channel) {
     BindToChannel(channel.bind_id);
+    if (m_shader_cache) {
+        m_shader_cache->BindToChannel(channel.bind_id);
+    }
 }
 void RasterizerNull::ReleaseChannel(s32 channel_id) {
     EraseChannel(channel_id);
+    if (m_shader_cache) {
+        m_shader_cache->EraseChannel(channel_id);
+    }
+}
+
+void RasterizerNull::ClearColorTarget() {
+    const auto& regs = maxwell3d->regs;
+    const auto& clear = regs.clear_surface;
+    if (!clear.R || !clear.G || !clear.B || !clear.A) {
+        // Masked clears would have to preserve the other components of every texel
+        return;
+    }
+    const auto& rt = regs.rt[clear.RT];
+    const GPUVAddr gpu_addr = rt.Address();
+    if (clear.RT >= regs.rt_control.count || gpu_addr == 0 ||
+        rt.format == Tegra::RenderTargetFormat::NONE) {
+        return;
+    }
+    const VideoCommon::ImageInfo info(rt, regs.anti_alias_samples_mode);
+    if (info.resources.levels > 1 || info.resources.layers > 1) {
+        return;
+    }
+    const auto& scissor = regs.scissor_test[0];
+    if (regs.clear_control.use_scissor != 0 && scissor.enable != 0 &&
+        (scissor.min_x != 0 || scissor.min_y != 0 || scissor.max_x < info.size.width ||
+         scissor.max_y < info.size.height)) {
+        // Only full clears write the same texel everywhere, whatever the layout of the target is
+        return;
+    }
+    std::array<u8, 16> texel{};
+    const size_t texel_size = EncodeClearColor(info.format, regs.clear_color, texel);
+    if (texel_size == 0) {
+        return;
+    }
+    const size_t size = VideoCommon::CalculateGuestSizeInBytes(info);
+    m_clear_buffer.resize(size);
+    for (size_t offset = 0; offset + texel_size <= size; offset += texel_size) {
+        std::memcpy(m_clear_buffer.data() + offset, texel.data(), texel_size);
+    }
+    gpu_memory->WriteBlock(gpu_addr, m_clear_buffer.data(), size);
 }
 
 } // namespace Null
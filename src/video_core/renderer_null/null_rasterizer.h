@@ -1,12 +1,20 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "common/common_types.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/engines/maxwell_dma.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_null/null_shader_cache.h"
 
 namespace Core {
 class System;
@@ -34,7 +42,7 @@ public:
 class RasterizerNull final : public VideoCore::RasterizerInterface,
                              protected VideoCommon::ChannelSetupCaches<VideoCommon::ChannelInfo> {
 public:
-    explicit RasterizerNull(Tegra::GPU& gpu);
+    explicit RasterizerNull(Tegra::GPU& gpu, Tegra::MaxwellDeviceMemoryManager& device_memory);
     ~RasterizerNull() override;
 
     void Draw(bool is_indexed, u32 instance_count) override;
@@ -84,8 +92,14 @@ public:
     void ReleaseChannel(s32 channel_id) override;
 
 private:
+    /// Writes the clear color to guest memory when the clear covers the whole color target
+    void ClearColorTarget();
+
     Tegra::GPU& m_gpu;
     AccelerateDMA m_accelerate_dma;
+    /// Only present when shader translation is enabled
+    std::optional<ShaderCache> m_shader_cache;
+    std::vector<u8> m_clear_buffer;
 };
 
 } // namespace Null
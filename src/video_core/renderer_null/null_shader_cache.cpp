@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "common/cityhash.h"
+#include "common/logging/log.h"
+#include "shader_recompiler/compile_statistics.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
+#include "shader_recompiler/program_header.h"
+#include "video_core/engines/kepler_compute.h"
+#include "video_core/renderer_null/null_shader_cache.h"
+#include "video_core/shader_environment.h"
+
+namespace Null {
+
+using Shader::Maxwell::MergeDualVertexPrograms;
+
+ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_)
+    : VideoCommon::ShaderCache{device_memory_},
+      host_info{
+          .support_float64 = true,
+          .support_float16 = true,
+          .support_int64 = true,
+          .needs_demote_reorder = false,
+          .support_snorm_render_buffer = true,
+          .support_viewport_index_layer = true,
+          .min_ssbo_alignment = 16,
+          .support_geometry_shader_passthrough = false,
+          .support_conditional_barrier = true,
+      } {}
+
+ShaderCache::~ShaderCache() {
+    if (translated.empty()) {
+        return;
+    }
+    LOG_INFO(Render, "Translated {} graphics and {} compute pipelines ({} failed) in {} ms",
+             statistics.num_graphics, statistics.num_compute, statistics.num_failed,
+             std::chrono::duration_cast<std::chrono::milliseconds>(statistics.translate_time)
+                 .count());
+    Shader::CompileStatistics::Dump();
+}
+
+void ShaderCache::TranslateGraphics() {
+    if (!RefreshStages(unique_hashes)) {
+        return;
+    }
+    const u64 key = Common::CityHash64(reinterpret_cast<const char*>(unique_hashes.data()),
+                                       sizeof(unique_hashes));
+    if (!translated.insert(key).second) {
+        return;
+    }
+    GraphicsEnvironments environments;
+    GetGraphicsEnvironments(environments, unique_hashes);
+
+    const auto start = std::chrono::steady_clock::now();
+    const Shader::CompileStatistics::PipelineTimer pipeline_timer;
+    pools.ReleaseContents();
+    const Shader::ArenaScope arena_scope{&pools.arena};
+    try {
+        std::array<Shader::IR::Program, Tegra::Engines::Maxwell3D::Regs::MaxShaderProgram>
+            programs;
+        const bool uses_vertex_a = unique_hashes[0] != 0;
+        size_t env_index = 0;
+        for (size_t index = 0; index < programs.size(); ++index) {
+            if (unique_hashes[index] == 0) {
+                continue;
+            }
+            Shader::Environment& env = *environments.env_ptrs[env_index++];
+            const u32 cfg_offset =
+                static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader));
+            auto program = translation_cache.Translate(pools.inst, pools.block, pools.flow_block,
+                                                       env, unique_hashes[index], cfg_offset,
+                                                       index == 0, host_info);
+            if (!uses_vertex_a || index != 1) {
+                programs[index] = std::move(program);
+            } else {
+                programs[index] = MergeDualVertexPrograms(programs[0], program, env);
+            }
+        }
+        ++statistics.num_graphics;
+    } catch (const Shader::Exception& exception) {
+        ++statistics.num_failed;
+        LOG_ERROR(Render, "{}", exception.what());
+    }
+    statistics.translate_time += std::chrono::steady_clock::now() - start;
+}
+
+void ShaderCache::TranslateCompute() {
+    const VideoCommon::ShaderInfo* const shader = ComputeShader();
+    if (!shader || !translated.insert(shader->unique_hash).second) {
+        return;
+    }
+    const GPUVAddr program_base = kepler_compute->regs.code_loc.Address();
+    const auto& qmd = kepler_compute->launch_description;
+    VideoCommon::ComputeEnvironment env{*kepler_compute, *gpu_memory, program_base,
+                                        qmd.program_start};
+    env.SetCachedSize(shader->size_bytes);
+
+    const auto start = std::chrono::steady_clock::now();
+    const Shader::CompileStatistics::PipelineTimer pipeline_timer;
+    pools.ReleaseContents();
+    const Shader::ArenaScope arena_scope{&pools.arena};
+    try {
+        [[maybe_unused]] const Shader::IR::Program program =
+            translation_cache.Translate(pools.inst, pools.block, pools.flow_block, env,
+                                        shader->unique_hash, env.StartAddress(), false, host_info);
+        ++statistics.num_compute;
+    } catch (const Shader::Exception& exception) {
+        ++statistics.num_failed;
+        LOG_ERROR(Render, "{}", exception.what());
+    }
+    statistics.translate_time += std::chrono::steady_clock::now() - start;
+}
+
+} // namespace Null
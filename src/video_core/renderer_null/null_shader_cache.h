@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <unordered_set>
+
+#include "common/common_types.h"
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/object_pool.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/shader_cache.h"
+
+namespace Null {
+
+/**
+ * Translates the guest shaders used by draws and dispatches to IR without emitting host code,
+ * so headless runs go through the same decode, control flow and optimization passes as a
+ * hardware backend. Translations are cached by the hashes of their stages.
+ */
+class ShaderCache final : public VideoCommon::ShaderCache {
+public:
+    struct Statistics {
+        u64 num_graphics{};
+        u64 num_compute{};
+        u64 num_failed{};
+        std::chrono::nanoseconds translate_time{};
+    };
+
+    explicit ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory);
+    ~ShaderCache();
+
+    /// Translates the shaders bound to the 3D engine when they have not been seen yet
+    void TranslateGraphics();
+
+    /// Translates the shader launched by the compute engine when it has not been seen yet
+    void TranslateCompute();
+
+    [[nodiscard]] const Statistics& GetStatistics() const noexcept {
+        return statistics;
+    }
+
+private:
+    struct Pools {
+        void ReleaseContents() {
+            flow_block.ReleaseContents();
+            block.ReleaseContents();
+            inst.ReleaseContents();
+            arena.Reset();
+        }
+
+        Shader::Arena arena;
+        Shader::ObjectPool<Shader::IR::Inst> inst{8192};
+        Shader::ObjectPool<Shader::IR::Block> block{32};
+        Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block{32};
+    };
+
+    Pools pools;
+    Shader::HostTranslateInfo host_info;
+    Shader::Maxwell::TranslationCache translation_cache;
+    std::array<u64, Tegra::Engines::Maxwell3D::Regs::MaxShaderProgram> unique_hashes{};
+    std::unordered_set<u64> translated;
+    Statistics statistics;
+};
+
+} // namespace Null
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -5,6 +8,7 @@
 
 #include <array>
 #include <type_traits>
+#include <utility>
 
 #include "common/common_types.h"
 #include "shader_recompiler/shader_info.h"
@@ -69,6 +73,11 @@ public:
         gpu_memory = gpu_memory_;
     }
 
+    /// Returns true only the first time it is called, used to stamp cached pipelines as used
+    [[nodiscard]] bool MarkUsed() noexcept {
+        return !std::exchange(is_used, true);
+    }
+
 private:
     void WaitForBuild();
 
@@ -94,6 +103,7 @@ private:
     std::condition_variable built_condvar;
     OGLSync built_fence{};
     bool is_built{false};
+    bool is_used{false};
 };
 
 } // namespace OpenGL
@@ -107,6 +107,11 @@ public:
 
     [[nodiscard]] bool IsBuilt() noexcept;
 
+    /// Returns true only the first time it is called, used to stamp cached pipelines as used
+    [[nodiscard]] bool MarkUsed() noexcept {
+        return !std::exchange(is_used, true);
+    }
+
     template <typename Spec>
     static auto MakeConfigureSpecFunc() {
         return [](GraphicsPipeline* pipeline, bool is_indexed) {
@@ -164,6 +169,7 @@ private:
     std::condition_variable built_condvar;
     OGLSync built_fence{};
     bool is_built{false};
+    bool is_used{false};
 };
 
 } // namespace OpenGL
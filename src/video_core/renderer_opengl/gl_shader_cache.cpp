@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
@@ -21,6 +21,7 @@
 #include "shader_recompiler/backend/glasm/emit_glasm.h"
 #include "shader_recompiler/backend/glsl/emit_glsl.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/compile_statistics.h"
 #include "shader_recompiler/frontend/ir/program.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
 #include "shader_recompiler/frontend/maxwell/translate_program.h"
@@ -45,7 +46,6 @@ using Shader::Backend::SPIRV::EmitSPIRV;
 using Shader::Maxwell::ConvertLegacyToGeneric;
 using Shader::Maxwell::GenerateGeometryPassthrough;
 using Shader::Maxwell::MergeDualVertexPrograms;
-using Shader::Maxwell::TranslateProgram;
 using VideoCommon::ComputeEnvironment;
 using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
@@ -56,6 +56,12 @@ using Context = ShaderContext::Context;
 
 constexpr u32 CACHE_VERSION = 10;
 
+/// Maximum number of deferred pipelines being built in the background at the same time
+constexpr size_t MAX_DEFERRED_IN_FLIGHT = 2;
+
+/// Frames between write backs of pipeline usage stamps
+constexpr u32 USAGE_WRITE_INTERVAL = 600;
+
 template <typename Container>
 auto MakeSpan(Container& container) {
     return std::span(container.data(), container.size());
@@ -257,7 +263,13 @@ ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
     }
 }
 
-ShaderCache::~ShaderCache() = default;
+ShaderCache::~ShaderCache() {
+    deferred_stop.request_stop();
+    if (!shader_cache_filename.empty()) {
+        VideoCommon::WritePipelineUsage(shader_cache_filename, shader_cache_index);
+    }
+    Shader::CompileStatistics::Dump();
+}
 
 void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                                     const VideoCore::DiskResourceLoadCallback& callback) {
@@ -294,12 +306,19 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
             workers->QueueWork(std::move(work));
         }
     }};
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const auto load_compute{[&](VideoCommon::PipelineCacheRecord record) {
         ComputePipelineKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-        queue_work([this, key, env_ = std::move(env), &state, &callback](Context* ctx) mutable {
-            ctx->pools.ReleaseContents();
-            auto pipeline{CreateComputePipeline(ctx->pools, key, env_, true)};
+        if (!record.ReadKey(key)) {
+            return;
+        }
+        queue_work([this, key, record_ = std::move(record), &state,
+                    &callback](Context* ctx) mutable {
+            std::vector<FileEnvironment> envs{record_.DecodeEnvironments()};
+            std::unique_ptr<ComputePipeline> pipeline;
+            if (!envs.empty()) {
+                ctx->pools.ReleaseContents();
+                pipeline = CreateComputePipeline(ctx->pools, key, envs.front(), true);
+            }
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
                 compute_cache.emplace(key, std::move(pipeline));
@@ -311,16 +330,23 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto load_graphics{[&](VideoCommon::PipelineCacheRecord record) {
         GraphicsPipelineKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-        queue_work([this, key, envs_ = std::move(envs), &state, &callback](Context* ctx) mutable {
-            boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
-            for (auto& env : envs_) {
-                env_ptrs.push_back(&env);
+        if (!record.ReadKey(key)) {
+            return;
+        }
+        queue_work([this, key, record_ = std::move(record), &state,
+                    &callback](Context* ctx) mutable {
+            std::vector<FileEnvironment> envs{record_.DecodeEnvironments()};
+            std::unique_ptr<GraphicsPipeline> pipeline;
+            if (!envs.empty()) {
+                boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
+                for (auto& env : envs) {
+                    env_ptrs.push_back(&env);
+                }
+                ctx->pools.ReleaseContents();
+                pipeline = CreateGraphicsPipeline(ctx->pools, key, MakeSpan(env_ptrs), false, true);
             }
-            ctx->pools.ReleaseContents();
-            auto pipeline{CreateGraphicsPipeline(ctx->pools, key, MakeSpan(env_ptrs), false, true)};
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
                 graphics_cache.emplace(key, std::move(pipeline));
@@ -332,7 +358,19 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    LoadPipelines(stop_loading, shader_cache_filename, CACHE_VERSION, load_compute, load_graphics);
+    deferred_pipelines = LoadPipelines(stop_loading, shader_cache_filename, CACHE_VERSION,
+                                       shader_cache_index, load_compute, load_graphics);
+    if (strict_context_required || !use_asynchronous_shaders) {
+        // There are no workers left after boot to build them, do it now
+        for (VideoCommon::PipelineCacheRecord& record : deferred_pipelines) {
+            if (record.IsCompute()) {
+                load_compute(std::move(record));
+            } else {
+                load_graphics(std::move(record));
+            }
+        }
+        deferred_pipelines.clear();
+    }
 
     LOG_INFO(Render_OpenGL, "Total Pipeline Count: {}", state.total);
 
@@ -349,6 +387,13 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         workers.reset();
     }
 
+    const auto translation_statistics{translation_cache.GetStatistics()};
+    LOG_INFO(Render_OpenGL, "Reused {} of {} decoded shader programs",
+             translation_statistics.hits,
+             translation_statistics.hits + translation_statistics.misses +
+                 translation_statistics.uncacheable);
+    Shader::CompileStatistics::Dump();
+
     if (Settings::values.optimize_spirv_output.GetValue() != Settings::SpirvOptimizeMode::Always) {
         this->optimize_spirv_output = false;
     }
@@ -379,6 +424,80 @@ GraphicsPipeline* ShaderCache::CurrentGraphicsPipeline() {
     return CurrentGraphicsPipelineSlowPath();
 }
 
+void ShaderCache::TickFrame() {
+    const u32 frame{++shader_cache_index.frame};
+    if (!shader_cache_filename.empty() && frame % USAGE_WRITE_INTERVAL == 0) {
+        VideoCommon::WritePipelineUsage(shader_cache_filename, shader_cache_index);
+    }
+    BuildDeferredPipelines();
+}
+
+void ShaderCache::BuildDeferredPipelines() {
+    {
+        std::scoped_lock lock{deferred_mutex};
+        for (auto& [key, pipeline] : deferred_graphics) {
+            graphics_cache.try_emplace(key, std::move(pipeline));
+        }
+        for (auto& [key, pipeline] : deferred_compute) {
+            compute_cache.try_emplace(key, std::move(pipeline));
+        }
+        deferred_graphics.clear();
+        deferred_compute.clear();
+    }
+    while (!deferred_pipelines.empty() && deferred_in_flight < MAX_DEFERRED_IN_FLIGHT) {
+        VideoCommon::PipelineCacheRecord record{std::move(deferred_pipelines.back())};
+        deferred_pipelines.pop_back();
+        if (record.IsCompute()) {
+            ComputePipelineKey key;
+            if (!record.ReadKey(key) || compute_cache.contains(key)) {
+                continue;
+            }
+            ++deferred_in_flight;
+            workers->QueueWork([this, key, record_ = std::move(record),
+                                stop_token = deferred_stop.get_token()](Context* ctx) {
+                if (!stop_token.stop_requested()) {
+                    std::vector<FileEnvironment> envs{record_.DecodeEnvironments()};
+                    if (!envs.empty()) {
+                        ctx->pools.ReleaseContents();
+                        auto pipeline{CreateComputePipeline(ctx->pools, key, envs.front(), true)};
+                        if (pipeline) {
+                            std::scoped_lock lock{deferred_mutex};
+                            deferred_compute.emplace_back(key, std::move(pipeline));
+                        }
+                    }
+                }
+                --deferred_in_flight;
+            });
+        } else {
+            GraphicsPipelineKey key;
+            if (!record.ReadKey(key) || graphics_cache.contains(key)) {
+                continue;
+            }
+            ++deferred_in_flight;
+            workers->QueueWork([this, key, record_ = std::move(record),
+                                stop_token = deferred_stop.get_token()](Context* ctx) {
+                if (!stop_token.stop_requested()) {
+                    std::vector<FileEnvironment> envs{record_.DecodeEnvironments()};
+                    if (!envs.empty()) {
+                        boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
+                        for (auto& env : envs) {
+                            env_ptrs.push_back(&env);
+                        }
+                        ctx->pools.ReleaseContents();
+                        auto pipeline{CreateGraphicsPipeline(ctx->pools, key, MakeSpan(env_ptrs),
+                                                             false, true)};
+                        if (pipeline) {
+                            std::scoped_lock lock{deferred_mutex};
+                            deferred_graphics.emplace_back(key, std::move(pipeline));
+                        }
+                    }
+                }
+                --deferred_in_flight;
+            });
+        }
+    }
+}
+
 GraphicsPipeline* ShaderCache::CurrentGraphicsPipelineSlowPath() {
     const auto [pair, is_new]{graphics_cache.try_emplace(graphics_key)};
     auto& pipeline{pair->second};
@@ -388,6 +507,9 @@ GraphicsPipeline* ShaderCache::CurrentGraphicsPipelineSlowPath() {
     if (!pipeline) {
         return nullptr;
     }
+    if (!is_new && pipeline->MarkUsed()) {
+        VideoCommon::MarkPipelineUsed(shader_cache_index, graphics_key);
+    }
     current_pipeline = pipeline.get();
     return BuiltPipeline(current_pipeline);
 }
@@ -428,6 +550,9 @@ ComputePipeline* ShaderCache::CurrentComputePipeline() {
     const auto [pair, is_new]{compute_cache.try_emplace(key)};
     auto& pipeline{pair->second};
     if (!is_new) {
+        if (pipeline && pipeline->MarkUsed()) {
+            VideoCommon::MarkPipelineUsed(shader_cache_index, key);
+        }
         return pipeline.get();
     }
     pipeline = CreateComputePipeline(key, shader);
@@ -444,13 +569,19 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline() {
     if (!pipeline || shader_cache_filename.empty()) {
         return pipeline;
     }
+    if (VideoCommon::IsPipelineStored(shader_cache_index, graphics_key)) {
+        // Deferred pipeline of the cache that was needed before it was built
+        VideoCommon::MarkPipelineUsed(shader_cache_index, graphics_key);
+        return pipeline;
+    }
     boost::container::static_vector<const GenericEnvironment*, Maxwell::MaxShaderProgram> env_ptrs;
     for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
         if (graphics_key.unique_hashes[index] != 0) {
             env_ptrs.push_back(&environments.envs[index]);
         }
     }
-    SerializePipeline(graphics_key, env_ptrs, shader_cache_filename, CACHE_VERSION);
+    SerializePipeline(graphics_key, env_ptrs, shader_cache_filename, CACHE_VERSION,
+                      shader_cache_index);
     return pipeline;
 }
 
@@ -460,6 +591,8 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
     bool force_context_flush) try {
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
+    Shader::CompileStatistics::PipelineTimer pipeline_timer;
+    const Shader::ArenaScope arena_scope{&pools.arena};
     size_t env_index{};
     u32 total_storage_buffers{};
     std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
@@ -485,7 +618,9 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
         ++env_index;
 
         const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
-        Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, index == 0);
+        auto program{translation_cache.Translate(pools.inst, pools.block, pools.flow_block, env,
+                                                 key.unique_hashes[index], cfg_offset, index == 0,
+                                                 host_info)};
 
         if (Settings::values.dump_shaders) {
             env.Dump(hash, key.unique_hashes[index]);
@@ -493,17 +628,16 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
 
         if (!uses_vertex_a || index != 1) {
             // Normal path
-            programs[index] = TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
+            programs[index] = std::move(program);
 
             total_storage_buffers +=
                 Shader::NumDescriptors(programs[index].info.storage_buffers_descriptors);
         } else {
             // VertexB path when VertexA is present.
             auto& program_va{programs[0]};
-            auto program_vb{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
             total_storage_buffers +=
-                Shader::NumDescriptors(program_vb.info.storage_buffers_descriptors);
-            programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
+                Shader::NumDescriptors(program.info.storage_buffers_descriptors);
+            programs[index] = MergeDualVertexPrograms(program_va, program, env);
         }
 
         if (programs[index].info.requires_layer_emulation) {
@@ -549,6 +683,8 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline(
                 EmitSPIRV(profile, runtime_info, program, binding, this->optimize_spirv_output);
             break;
         }
+        pipeline_timer.AddOutputSize(sources[stage_index].size() +
+                                     sources_spirv[stage_index].size() * sizeof(u32));
         previous_program = &program;
     }
     auto* const thread_worker{use_shader_workers ? workers.get() : nullptr};
@@ -573,8 +709,12 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
     if (!pipeline || shader_cache_filename.empty()) {
         return pipeline;
     }
+    if (VideoCommon::IsPipelineStored(shader_cache_index, key)) {
+        VideoCommon::MarkPipelineUsed(shader_cache_index, key);
+        return pipeline;
+    }
     SerializePipeline(key, std::array<const GenericEnvironment*, 1>{&env}, shader_cache_filename,
-                      CACHE_VERSION);
+                      CACHE_VERSION, shader_cache_index);
     return pipeline;
 }
 
@@ -583,14 +723,16 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
     bool force_context_flush) try {
     auto hash = key.Hash();
     LOG_INFO(Render_OpenGL, "0x{:016x}", hash);
-
-    Shader::Maxwell::Flow::CFG cfg{env, pools.flow_block, env.StartAddress()};
+    Shader::CompileStatistics::PipelineTimer pipeline_timer;
+    const Shader::ArenaScope arena_scope{&pools.arena};
 
     if (Settings::values.dump_shaders) {
         env.Dump(hash, key.unique_hash);
     }
 
-    auto program{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
+    auto program{translation_cache.Translate(pools.inst, pools.block, pools.flow_block, env,
+                                             key.unique_hash, env.StartAddress(), false,
+                                             host_info)};
     const u32 num_storage_buffers{Shader::NumDescriptors(program.info.storage_buffers_descriptors)};
     Shader::RuntimeInfo info;
     info.glasm_use_storage_buffers = num_storage_buffers <= device.GetMaxGLASMStorageBufferBlocks();
@@ -608,6 +750,7 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
         code_spirv = EmitSPIRV(profile, program, this->optimize_spirv_output);
         break;
     }
+    pipeline_timer.AddOutputSize(code.size() + code_spirv.size() * sizeof(u32));
 
     return std::make_unique<ComputePipeline>(device, texture_cache, buffer_cache, program_manager,
                                              program.info, code, code_spirv, force_context_flush);
@@ -1,13 +1,22 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
+#include <stop_token>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/thread_worker.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
 #include "shader_recompiler/host_translate_info.h"
 #include "shader_recompiler/profile.h"
 #include "video_core/renderer_opengl/gl_compute_pipeline.h"
@@ -42,6 +51,8 @@ public:
 
     [[nodiscard]] ComputePipeline* CurrentComputePipeline();
 
+    void TickFrame();
+
 private:
     GraphicsPipeline* CurrentGraphicsPipelineSlowPath();
 
@@ -64,6 +75,9 @@ private:
 
     std::unique_ptr<ShaderWorker> CreateWorkers() const;
 
+    /// Moves pipelines built in the background into the caches and queues more of them
+    void BuildDeferredPipelines();
+
     Core::Frontend::EmuWindow& emu_window;
     const Device& device;
     TextureCache& texture_cache;
@@ -85,7 +99,21 @@ private:
     Shader::Profile profile;
     Shader::HostTranslateInfo host_info;
 
+    /// Decoded programs shared by the pipelines built on every worker
+    Shader::Maxwell::TranslationCache translation_cache;
+
     std::filesystem::path shader_cache_filename;
+    VideoCommon::PipelineCacheIndex shader_cache_index;
+
+    /// Cached pipelines not used recently, built in the background after boot
+    std::vector<VideoCommon::PipelineCacheRecord> deferred_pipelines;
+    std::mutex deferred_mutex;
+    std::vector<std::pair<GraphicsPipelineKey, std::unique_ptr<GraphicsPipeline>>>
+        deferred_graphics;
+    std::vector<std::pair<ComputePipelineKey, std::unique_ptr<ComputePipeline>>> deferred_compute;
+    std::atomic<size_t> deferred_in_flight{};
+    std::stop_source deferred_stop;
+
     std::unique_ptr<ShaderWorker> workers;
 };
 
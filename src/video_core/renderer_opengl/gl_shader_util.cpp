@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,6 +10,7 @@
 
 #include "common/logging/log.h"
 #include "common/settings.h"
+#include "shader_recompiler/compile_statistics.h"
 #include "video_core/renderer_opengl/gl_shader_util.h"
 
 namespace OpenGL {
@@ -63,6 +67,7 @@ static void LogShader(GLuint shader, std::string_view code = {}) {
 }
 
 OGLProgram CreateProgram(std::string_view code, GLenum stage) {
+    const Shader::CompileStatistics::PhaseTimer timer{"Driver"};
     OGLShader shader;
     shader.handle = glCreateShader(stage);
 
@@ -77,6 +82,7 @@ OGLProgram CreateProgram(std::string_view code, GLenum stage) {
 }
 
 OGLProgram CreateProgram(std::span<const u32> code, GLenum stage) {
+    const Shader::CompileStatistics::PhaseTimer timer{"Driver"};
     OGLShader shader;
     shader.handle = glCreateShader(stage);
 
@@ -90,6 +96,7 @@ OGLProgram CreateProgram(std::span<const u32> code, GLenum stage) {
 }
 
 OGLAssemblyProgram CompileProgram(std::string_view code, GLenum target) {
+    const Shader::CompileStatistics::PhaseTimer timer{"Driver"};
     OGLAssemblyProgram program;
     glGenProgramsARB(1, &program.handle);
     glNamedProgramStringEXT(program.handle, target, GL_PROGRAM_FORMAT_ASCII_ARB,
@@ -390,6 +390,11 @@ bool BufferCacheRuntime::CanReorderUpload(const Buffer& buffer,
     return can_use_upload_cmdbuf;
 }
 
+bool BufferCacheRuntime::CanReorderUploadFrom(const StagingBufferRef& upload_staging) const {
+    // Only copies from the stream buffer are recorded in the upload command buffer
+    return upload_staging.buffer == staging_pool.StreamBuf();
+}
+
 void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
                                     std::span<const VideoCommon::BufferCopy> copies, bool barrier,
                                     bool can_reorder_upload) {
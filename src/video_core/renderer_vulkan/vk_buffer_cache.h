@@ -99,6 +99,8 @@ public:
 
     bool CanReorderUpload(const Buffer& buffer, std::span<const VideoCommon::BufferCopy> copies);
 
+    bool CanReorderUploadFrom(const StagingBufferRef& upload_staging) const;
+
     void FreeDeferredStagingBuffer(StagingBufferRef& ref);
 
     void PreCopyBarrier();
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -6,6 +9,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <utility>
 
 #include "common/common_types.h"
 #include "common/thread_worker.h"
@@ -45,6 +49,11 @@ public:
     void Configure(Tegra::Engines::KeplerCompute& kepler_compute, Tegra::MemoryManager& gpu_memory,
                    Scheduler& scheduler, BufferCache& buffer_cache, TextureCache& texture_cache);
 
+    /// Returns true only the first time it is called, used to stamp cached pipelines as used
+    [[nodiscard]] bool MarkUsed() noexcept {
+        return !std::exchange(is_used, true);
+    }
+
 private:
     const Device& device;
     vk::PipelineCache& pipeline_cache;
@@ -63,6 +72,7 @@ private:
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
+    bool is_used{false};
 };
 
 } // namespace Vulkan
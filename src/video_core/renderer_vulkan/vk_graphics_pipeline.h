@@ -12,6 +12,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <type_traits>
+#include <utility>
 
 #include "common/thread_worker.h"
 #include "shader_recompiler/shader_info.h"
@@ -107,6 +108,11 @@ public:
         return is_built.load(std::memory_order::relaxed);
     }
 
+    /// Returns true only the first time it is called, used to stamp cached pipelines as used
+    [[nodiscard]] bool MarkUsed() noexcept {
+        return !std::exchange(is_used, true);
+    }
+
     template <typename Spec>
     static auto MakeConfigureSpecFunc() {
         return [](GraphicsPipeline* pl, bool is_indexed) { return pl->ConfigureImpl<Spec>(is_indexed); };
@@ -160,6 +166,7 @@ private:
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
     bool uses_push_descriptor{false};
+    bool is_used{false};
 };
 
 } // namespace Vulkan
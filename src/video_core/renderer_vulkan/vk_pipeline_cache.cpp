@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
@@ -19,9 +19,11 @@
 #include "common/thread_worker.h"
 #include "core/core.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/compile_statistics.h"
 #include "shader_recompiler/environment.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
 #include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
 #include "shader_recompiler/program_header.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
@@ -55,9 +57,14 @@ using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
 using VideoCommon::GraphicsEnvironment;
 
-constexpr u32 CACHE_VERSION = 12;
 constexpr std::array<char, 8> VULKAN_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'c', 'h'};
 
+/// Maximum number of deferred pipelines being built in the background at the same time
+constexpr size_t MAX_DEFERRED_IN_FLIGHT = 2;
+
+/// Frames between write backs of pipeline usage stamps
+constexpr u32 USAGE_WRITE_INTERVAL = 600;
+
 template <typename Container>
 auto MakeSpan(Container& container) {
     return std::span(container.data(), container.size());
@@ -143,10 +150,57 @@ Shader::AttributeType AttributeType(const FixedPipelineState& state, size_t inde
     return Shader::AttributeType::Disabled;
 }
 
-Shader::RuntimeInfo MakeRuntimeInfo(std::span<const Shader::IR::Program> programs,
-                                    const GraphicsPipelineCacheKey& key,
-                                    const Shader::IR::Program& program,
-                                    const Shader::IR::Program* previous_program) {
+size_t GetTotalPipelineWorkers() {
+    const size_t max_core_threads =
+        std::max<size_t>(static_cast<size_t>(std::thread::hardware_concurrency()), 2ULL) - 1ULL;
+#ifdef ANDROID
+    // Leave at least a few cores free in android
+    constexpr size_t free_cores = 3ULL;
+    if (max_core_threads <= free_cores) {
+        return 1ULL;
+    }
+    return max_core_threads - free_cores;
+#else
+    return max_core_threads;
+#endif
+}
+
+Shader::IR::Program TranslateStage(ShaderPools& pools, Shader::Environment& env, u64 code_hash,
+                                   u32 start_address, bool exits_to_dispatcher,
+                                   const Shader::HostTranslateInfo& host_info,
+                                   Shader::Maxwell::TranslationCache* translation_cache) {
+    if (translation_cache) {
+        return translation_cache->Translate(pools.inst, pools.block, pools.flow_block, env,
+                                            code_hash, start_address, exits_to_dispatcher,
+                                            host_info);
+    }
+    Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, start_address, exits_to_dispatcher);
+    return TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
+}
+} // Anonymous namespace
+
+size_t ComputePipelineCacheKey::Hash() const noexcept {
+    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
+    return static_cast<size_t>(hash);
+}
+
+bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) const noexcept {
+    return std::memcmp(&rhs, this, sizeof *this) == 0;
+}
+
+size_t GraphicsPipelineCacheKey::Hash() const noexcept {
+    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
+    return static_cast<size_t>(hash);
+}
+
+bool GraphicsPipelineCacheKey::operator==(const GraphicsPipelineCacheKey& rhs) const noexcept {
+    return std::memcmp(&rhs, this, Size()) == 0;
+}
+
+Shader::RuntimeInfo MakeGraphicsRuntimeInfo(std::span<const Shader::IR::Program> programs,
+                                            const GraphicsPipelineCacheKey& key,
+                                            const Shader::IR::Program& program,
+                                            const Shader::IR::Program* previous_program) {
     Shader::RuntimeInfo info;
     if (previous_program) {
         info.previous_stage_stores = previous_program->info.stores;
@@ -265,39 +319,127 @@ Shader::RuntimeInfo MakeRuntimeInfo(std::span<const Shader::IR::Program> program
     return info;
 }
 
-size_t GetTotalPipelineWorkers() {
-    const size_t max_core_threads =
-        std::max<size_t>(static_cast<size_t>(std::thread::hardware_concurrency()), 2ULL) - 1ULL;
-#ifdef ANDROID
-    // Leave at least a few cores free in android
-    constexpr size_t free_cores = 3ULL;
-    if (max_core_threads <= free_cores) {
-        return 1ULL;
-    }
-    return max_core_threads - free_cores;
-#else
-    return max_core_threads;
-#endif
-}
+GraphicsPipelineShaders TranslateGraphicsPrograms(
+    ShaderPools& pools, const GraphicsPipelineCacheKey& key,
+    std::span<Shader::Environment* const> envs, const Shader::HostTranslateInfo& host_info,
+    Shader::Maxwell::TranslationCache* translation_cache) {
+    const u64 hash{key.Hash()};
+    GraphicsPipelineShaders shaders;
+    auto& programs{shaders.programs};
+    size_t env_index{0};
+    const bool uses_vertex_a{key.unique_hashes[0] != 0};
+    const bool uses_vertex_b{key.unique_hashes[1] != 0};
 
-} // Anonymous namespace
+    // Layer passthrough generation for devices without VK_EXT_shader_viewport_index_layer
+    Shader::IR::Program* layer_source_program{};
 
-size_t ComputePipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
-    return static_cast<size_t>(hash);
+    for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+        const bool is_emulated_stage = layer_source_program != nullptr &&
+                                       index == static_cast<u32>(Maxwell::ShaderType::Geometry);
+        if (key.unique_hashes[index] == 0 && is_emulated_stage) {
+            auto topology = MaxwellToOutputTopology(key.state.topology);
+            programs[index] = GenerateGeometryPassthrough(pools.inst, pools.block, host_info,
+                                                          *layer_source_program, topology);
+            continue;
+        }
+        if (key.unique_hashes[index] == 0) {
+            continue;
+        }
+        Shader::Environment& env{*envs[env_index]};
+        ++env_index;
+
+        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+        auto program{TranslateStage(pools, env, key.unique_hashes[index], cfg_offset, index == 0,
+                                    host_info, translation_cache)};
+        if (!uses_vertex_a || index != 1) {
+            // Normal path
+            programs[index] = std::move(program);
+        } else {
+            // VertexB path when VertexA is present.
+            auto& program_va{programs[0]};
+            programs[index] = MergeDualVertexPrograms(program_va, program, env);
+        }
+
+        if (Settings::values.dump_shaders) {
+            env.Dump(hash, key.unique_hashes[index]);
+        }
+
+        if (programs[index].info.requires_layer_emulation) {
+            layer_source_program = &programs[index];
+        }
+    }
+
+    for (size_t index = uses_vertex_a && uses_vertex_b ? 1 : 0; index < Maxwell::MaxShaderProgram;
+         ++index) {
+        const bool is_emulated_stage = layer_source_program != nullptr &&
+                                       index == static_cast<u32>(Maxwell::ShaderType::Geometry);
+        if (key.unique_hashes[index] == 0 && !is_emulated_stage) {
+            continue;
+        }
+        UNIMPLEMENTED_IF(index == 0);
+        shaders.enabled[index - 1] = true;
+    }
+    return shaders;
 }
 
-bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) const noexcept {
-    return std::memcmp(&rhs, this, sizeof *this) == 0;
+GraphicsPipelineShaders TranslateGraphicsPipeline(
+    ShaderPools& pools, const GraphicsPipelineCacheKey& key,
+    std::span<Shader::Environment* const> envs, const Shader::Profile& profile,
+    const Shader::HostTranslateInfo& host_info, bool optimize, const SpirvCache* spirv_cache,
+    Shader::Maxwell::TranslationCache* translation_cache) {
+    const Shader::ArenaScope arena_scope{&pools.arena};
+    GraphicsPipelineShaders shaders{
+        TranslateGraphicsPrograms(pools, key, envs, host_info, translation_cache)};
+    const Shader::IR::Program* previous_stage{};
+    Shader::Backend::Bindings binding;
+    for (size_t stage_index = 0; stage_index < Maxwell::MaxShaderStage; ++stage_index) {
+        if (!shaders.enabled[stage_index]) {
+            continue;
+        }
+        Shader::IR::Program& program{shaders.programs[stage_index + 1]};
+        const auto runtime_info{
+            MakeGraphicsRuntimeInfo(shaders.programs, key, program, previous_stage)};
+        ConvertLegacyToGeneric(program, runtime_info);
+        SpirvCache::Entry& stage{shaders.stages[stage_index]};
+        if (const SpirvCache::Entry* const cached{
+                spirv_cache ? spirv_cache->Find(key, stage_index) : nullptr}) {
+            stage = *cached;
+            binding = cached->bindings;
+        } else {
+            stage.code = EmitSPIRV(profile, runtime_info, program, binding, optimize);
+            stage.bindings = binding;
+        }
+        previous_stage = &program;
+    }
+    return shaders;
 }
 
-size_t GraphicsPipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
-    return static_cast<size_t>(hash);
+Shader::IR::Program TranslateComputeProgram(ShaderPools& pools, const ComputePipelineCacheKey& key,
+                                            Shader::Environment& env,
+                                            const Shader::HostTranslateInfo& host_info,
+                                            Shader::Maxwell::TranslationCache* translation_cache) {
+    // Dump it before error.
+    if (Settings::values.dump_shaders) {
+        env.Dump(key.Hash(), key.unique_hash);
+    }
+    return TranslateStage(pools, env, key.unique_hash, env.StartAddress(), false, host_info,
+                          translation_cache);
 }
 
-bool GraphicsPipelineCacheKey::operator==(const GraphicsPipelineCacheKey& rhs) const noexcept {
-    return std::memcmp(&rhs, this, Size()) == 0;
+ComputePipelineShader TranslateComputePipeline(
+    ShaderPools& pools, const ComputePipelineCacheKey& key, Shader::Environment& env,
+    const Shader::Profile& profile, const Shader::HostTranslateInfo& host_info, bool optimize,
+    const SpirvCache* spirv_cache, Shader::Maxwell::TranslationCache* translation_cache) {
+    const Shader::ArenaScope arena_scope{&pools.arena};
+    ComputePipelineShader shader{
+        .program = TranslateComputeProgram(pools, key, env, host_info, translation_cache),
+    };
+    if (const SpirvCache::Entry* const cached{spirv_cache ? spirv_cache->Find(key, 0) : nullptr}) {
+        shader.stage = *cached;
+    } else {
+        shader.stage.code = EmitSPIRV(profile, shader.program, optimize);
+    }
+    return shader;
 }
 
 PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
@@ -424,10 +566,17 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
 }
 
 PipelineCache::~PipelineCache() {
+    deferred_stop.request_stop();
+    // Pending serializations append to the file and update the index
+    serialization_thread.WaitForRequests();
+    if (!pipeline_cache_filename.empty()) {
+        VideoCommon::WritePipelineUsage(pipeline_cache_filename, pipeline_cache_index);
+    }
     if (use_vulkan_pipeline_cache && !vulkan_pipeline_cache_filename.empty()) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
-                                     CACHE_VERSION);
+                                     PIPELINE_CACHE_VERSION);
     }
+    Shader::CompileStatistics::Dump();
 }
 
 GraphicsPipeline* PipelineCache::CurrentGraphicsPipeline() {
@@ -463,6 +612,9 @@ ComputePipeline* PipelineCache::CurrentComputePipeline() {
     const auto [pair, is_new]{compute_cache.try_emplace(key)};
     auto& pipeline{pair->second};
     if (!is_new) {
+        if (pipeline && pipeline->MarkUsed()) {
+            VideoCommon::MarkPipelineUsed(pipeline_cache_index, key);
+        }
         return pipeline.get();
     }
     pipeline = CreateComputePipeline(key, shader);
@@ -482,10 +634,15 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     }
     pipeline_cache_filename = base_dir / "vulkan.bin";
 
+    // Record what SPIR-V is emitted for, so caches for this device can be precompiled offline
+    spirv_target = MakeSpirvCacheTarget(profile, host_info);
+    SerializeSpirvCacheTarget(base_dir / SPIRV_CACHE_TARGET_FILENAME, spirv_target);
+    spirv_cache.Load(base_dir / SPIRV_CACHE_FILENAME, PIPELINE_CACHE_VERSION, spirv_target);
+
     if (use_vulkan_pipeline_cache) {
         vulkan_pipeline_cache_filename = base_dir / "vulkan_pipelines.bin";
         vulkan_pipeline_cache =
-            LoadVulkanPipelineCache(vulkan_pipeline_cache_filename, CACHE_VERSION);
+            LoadVulkanPipelineCache(vulkan_pipeline_cache_filename, PIPELINE_CACHE_VERSION);
     }
 
     struct {
@@ -499,13 +656,19 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         state.statistics = std::make_unique<PipelineStatistics>(device);
     }
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const auto load_compute{[&](VideoCommon::PipelineCacheRecord record) {
         ComputePipelineCacheKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-
-        workers.QueueWork([this, key, env_ = std::move(env), &state, &callback]() mutable {
-            ShaderPools pools;
-            auto pipeline{CreateComputePipeline(pools, key, env_, state.statistics.get(), false)};
+        if (!record.ReadKey(key)) {
+            return;
+        }
+        workers.QueueWork([this, key, record_ = std::move(record), &state, &callback]() mutable {
+            std::vector<FileEnvironment> envs{record_.DecodeEnvironments()};
+            std::unique_ptr<ComputePipeline> pipeline;
+            if (!envs.empty()) {
+                ShaderPools pools;
+                pipeline = CreateComputePipeline(pools, key, envs.front(),
+                                                 state.statistics.get(), false);
+            }
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
                 compute_cache.emplace(key, std::move(pipeline));
@@ -517,31 +680,36 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto is_compatible{[this](const GraphicsPipelineCacheKey& key) {
+        return (key.state.extended_dynamic_state != 0) ==
+                   dynamic_features.has_extended_dynamic_state &&
+               (key.state.extended_dynamic_state_2 != 0) ==
+                   dynamic_features.has_extended_dynamic_state_2 &&
+               (key.state.extended_dynamic_state_2_extra != 0) ==
+                   dynamic_features.has_extended_dynamic_state_2_extra &&
+               (key.state.extended_dynamic_state_3_blend != 0) ==
+                   dynamic_features.has_extended_dynamic_state_3_blend &&
+               (key.state.extended_dynamic_state_3_enables != 0) ==
+                   dynamic_features.has_extended_dynamic_state_3_enables &&
+               (key.state.dynamic_vertex_input != 0) == dynamic_features.has_dynamic_vertex_input;
+    }};
+    const auto load_graphics{[&](VideoCommon::PipelineCacheRecord record) {
         GraphicsPipelineCacheKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-
-        if ((key.state.extended_dynamic_state != 0) !=
-                dynamic_features.has_extended_dynamic_state ||
-            (key.state.extended_dynamic_state_2 != 0) !=
-                dynamic_features.has_extended_dynamic_state_2 ||
-            (key.state.extended_dynamic_state_2_extra != 0) !=
-                dynamic_features.has_extended_dynamic_state_2_extra ||
-            (key.state.extended_dynamic_state_3_blend != 0) !=
-                dynamic_features.has_extended_dynamic_state_3_blend ||
-            (key.state.extended_dynamic_state_3_enables != 0) !=
-                dynamic_features.has_extended_dynamic_state_3_enables ||
-            (key.state.dynamic_vertex_input != 0) != dynamic_features.has_dynamic_vertex_input) {
+        if (!record.ReadKey(key) || !is_compatible(key)) {
             return;
         }
-        workers.QueueWork([this, key, envs_ = std::move(envs), &state, &callback]() mutable {
-            ShaderPools pools;
-            boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
-            for (auto& env : envs_) {
-                env_ptrs.push_back(&env);
+        workers.QueueWork([this, key, record_ = std::move(record), &state, &callback]() mutable {
+            std::vector<FileEnvironment> envs{record_.DecodeEnvironments()};
+            std::unique_ptr<GraphicsPipeline> pipeline;
+            if (!envs.empty()) {
+                ShaderPools pools;
+                boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
+                for (auto& env : envs) {
+                    env_ptrs.push_back(&env);
+                }
+                pipeline = CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs),
+                                                  state.statistics.get(), false);
             }
-            auto pipeline{CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs),
-                                                 state.statistics.get(), false)};
 
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
@@ -554,8 +722,13 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
         });
         ++state.total;
     }};
-    VideoCommon::LoadPipelines(stop_loading, pipeline_cache_filename, CACHE_VERSION, load_compute,
-                               load_graphics);
+    deferred_pipelines =
+        VideoCommon::LoadPipelines(stop_loading, pipeline_cache_filename, PIPELINE_CACHE_VERSION,
+                                   pipeline_cache_index, load_compute, load_graphics);
+    std::erase_if(deferred_pipelines, [&](const VideoCommon::PipelineCacheRecord& record) {
+        GraphicsPipelineCacheKey key;
+        return !record.IsCompute() && (!record.ReadKey(key) || !is_compatible(key));
+    });
 
     LOG_INFO(Render_Vulkan, "Total Pipeline Count: {}", state.total);
 
@@ -568,18 +741,107 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
 
     if (use_vulkan_pipeline_cache) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
-                                     CACHE_VERSION);
+                                     PIPELINE_CACHE_VERSION);
     }
 
     if (state.statistics) {
         state.statistics->Report();
     }
 
+    const auto translation_statistics{translation_cache.GetStatistics()};
+    LOG_INFO(Render_Vulkan, "Reused {} of {} decoded shader programs",
+             translation_statistics.hits,
+             translation_statistics.hits + translation_statistics.misses +
+                 translation_statistics.uncacheable);
+    Shader::CompileStatistics::Dump();
+
     if (Settings::values.optimize_spirv_output.GetValue() != Settings::SpirvOptimizeMode::Always) {
         this->optimize_spirv_output = false;
     }
 }
 
+void PipelineCache::TickFrame() {
+    const u32 frame{++pipeline_cache_index.frame};
+    if (!pipeline_cache_filename.empty() && frame % USAGE_WRITE_INTERVAL == 0) {
+        serialization_thread.QueueWork([this] {
+            VideoCommon::WritePipelineUsage(pipeline_cache_filename, pipeline_cache_index);
+        });
+    }
+    BuildDeferredPipelines();
+}
+
+void PipelineCache::BuildDeferredPipelines() {
+    {
+        std::scoped_lock lock{deferred_mutex};
+        for (auto& [key, pipeline] : deferred_graphics) {
+            graphics_cache.try_emplace(key, std::move(pipeline));
+        }
+        for (auto& [key, pipeline] : deferred_compute) {
+            compute_cache.try_emplace(key, std::move(pipeline));
+        }
+        deferred_graphics.clear();
+        deferred_compute.clear();
+    }
+    while (!deferred_pipelines.empty() && deferred_in_flight < MAX_DEFERRED_IN_FLIGHT) {
+        VideoCommon::PipelineCacheRecord record{std::move(deferred_pipelines.back())};
+        deferred_pipelines.pop_back();
+        if (record.IsCompute()) {
+            ComputePipelineCacheKey key;
+            if (!record.ReadKey(key) || compute_cache.contains(key)) {
+                continue;
+            }
+            ++deferred_in_flight;
+            workers.QueueWork([this, key, record_ = std::move(record),
+                               stop_token = deferred_stop.get_token()] {
+                if (!stop_token.stop_requested()) {
+                    std::vector<FileEnvironment> envs{record_.DecodeEnvironments()};
+                    if (!envs.empty()) {
+                        ShaderPools pools;
+                        auto pipeline{
+                            CreateComputePipeline(pools, key, envs.front(), nullptr, false)};
+                        if (pipeline) {
+                            std::scoped_lock lock{deferred_mutex};
+                            deferred_compute.emplace_back(key, std::move(pipeline));
+                        }
+                    }
+                }
+                --deferred_in_flight;
+            });
+        } else {
+            GraphicsPipelineCacheKey key;
+            if (!record.ReadKey(key) || graphics_cache.contains(key)) {
+                continue;
+            }
+            ++deferred_in_flight;
+            workers.QueueWork([this, key, record_ = std::move(record),
+                               stop_token = deferred_stop.get_token()] {
+                if (!stop_token.stop_requested()) {
+                    std::vector<FileEnvironment> envs{record_.DecodeEnvironments()};
+                    if (!envs.empty()) {
+                        ShaderPools pools;
+                        boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
+                        for (auto& env : envs) {
+                            env_ptrs.push_back(&env);
+                        }
+                        auto pipeline{
+                            CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs), nullptr, false)};
+                        if (pipeline) {
+                            std::scoped_lock lock{deferred_mutex};
+                            deferred_graphics.emplace_back(key, std::move(pipeline));
+                        }
+                    }
+                }
+                --deferred_in_flight;
+            });
+        }
+    }
+}
+
+const SpirvCache* PipelineCache::UsableSpirvCache() const {
+    // Resolution scaling and loop safety checks are baked into the emitted code
+    return MatchesCurrentSettings(spirv_target) ? &spirv_cache : nullptr;
+}
+
 GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
     const auto [pair, is_new]{graphics_cache.try_emplace(graphics_key)};
     auto& pipeline{pair->second};
@@ -589,6 +851,9 @@ GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
     if (!pipeline) {
         return nullptr;
     }
+    if (!is_new && pipeline->MarkUsed()) {
+        VideoCommon::MarkPipelineUsed(pipeline_cache_index, graphics_key);
+    }
     if (current_pipeline) {
         current_pipeline->AddTransition(pipeline.get());
     }
@@ -622,85 +887,32 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     ShaderPools& pools, const GraphicsPipelineCacheKey& key,
     std::span<Shader::Environment* const> envs, PipelineStatistics* statistics,
     bool build_in_parallel) try {
-    auto hash = key.Hash();
-    LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
-    size_t env_index{0};
-    std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
-    const bool uses_vertex_a{key.unique_hashes[0] != 0};
-    const bool uses_vertex_b{key.unique_hashes[1] != 0};
-
-    // Layer passthrough generation for devices without VK_EXT_shader_viewport_index_layer
-    Shader::IR::Program* layer_source_program{};
-
-    for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
-        const bool is_emulated_stage = layer_source_program != nullptr &&
-                                       index == static_cast<u32>(Maxwell::ShaderType::Geometry);
-        if (key.unique_hashes[index] == 0 && is_emulated_stage) {
-            auto topology = MaxwellToOutputTopology(key.state.topology);
-            programs[index] = GenerateGeometryPassthrough(pools.inst, pools.block, host_info,
-                                                          *layer_source_program, topology);
-            continue;
-        }
-        if (key.unique_hashes[index] == 0) {
-            continue;
-        }
-        Shader::Environment& env{*envs[env_index]};
-        ++env_index;
-
-        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
-        Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, index == 0);
-        if (!uses_vertex_a || index != 1) {
-            // Normal path
-            programs[index] = TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
-        } else {
-            // VertexB path when VertexA is present.
-            auto& program_va{programs[0]};
-            auto program_vb{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
-            programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
-        }
+    LOG_INFO(Render_Vulkan, "0x{:016x}", key.Hash());
+    Shader::CompileStatistics::PipelineTimer pipeline_timer;
+    const GraphicsPipelineShaders shaders{TranslateGraphicsPipeline(
+        pools, key, envs, profile, host_info, optimize_spirv_output, UsableSpirvCache(),
+        &translation_cache)};
 
-        if (Settings::values.dump_shaders) {
-            env.Dump(hash, key.unique_hashes[index]);
-        }
-
-        if (programs[index].info.requires_layer_emulation) {
-            layer_source_program = &programs[index];
-        }
-    }
-    std::array<const Shader::Info*, Maxwell::MaxShaderStage> infos{};
     std::array<vk::ShaderModule, Maxwell::MaxShaderStage> modules;
-
-    const Shader::IR::Program* previous_stage{};
-    Shader::Backend::Bindings binding;
-    for (size_t index = uses_vertex_a && uses_vertex_b ? 1 : 0; index < Maxwell::MaxShaderProgram;
-         ++index) {
-        const bool is_emulated_stage = layer_source_program != nullptr &&
-                                       index == static_cast<u32>(Maxwell::ShaderType::Geometry);
-        if (key.unique_hashes[index] == 0 && !is_emulated_stage) {
+    for (size_t stage_index = 0; stage_index < Maxwell::MaxShaderStage; ++stage_index) {
+        if (!shaders.enabled[stage_index]) {
             continue;
         }
-        UNIMPLEMENTED_IF(index == 0);
-
-        Shader::IR::Program& program{programs[index]};
-        const size_t stage_index{index - 1};
-        infos[stage_index] = &program.info;
-
-        const auto runtime_info{MakeRuntimeInfo(programs, key, program, previous_stage)};
-        ConvertLegacyToGeneric(program, runtime_info);
-        const std::vector<u32> code{EmitSPIRV(profile, runtime_info, program, binding, this->optimize_spirv_output)};
+        const std::vector<u32>& code{shaders.stages[stage_index].code};
+        pipeline_timer.AddOutputSize(code.size() * sizeof(u32));
         device.SaveShader(code);
         modules[stage_index] = BuildShader(device, code);
         if (device.HasDebuggingToolAttached()) {
-            const std::string name{fmt::format("Shader {:016x}", key.unique_hashes[index])};
+            const std::string name{
+                fmt::format("Shader {:016x}", key.unique_hashes[stage_index + 1])};
             modules[stage_index].SetObjectNameEXT(name.c_str());
         }
-        previous_stage = &program;
     }
     Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
     return std::make_unique<GraphicsPipeline>(
         scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
         descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache, key,
-        std::move(modules), infos);
+        std::move(modules), shaders.Infos());
 
 } catch (const Shader::Exception& exception) {
     auto hash = key.Hash();
@@ -730,6 +942,11 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
     if (!pipeline || pipeline_cache_filename.empty()) {
         return pipeline;
     }
+    if (VideoCommon::IsPipelineStored(pipeline_cache_index, graphics_key)) {
+        // Deferred pipeline of the cache that was needed before it was built
+        VideoCommon::MarkPipelineUsed(pipeline_cache_index, graphics_key);
+        return pipeline;
+    }
     serialization_thread.QueueWork([this, key = graphics_key, envs = std::move(environments.envs)] {
         boost::container::static_vector<const GenericEnvironment*, Maxwell::MaxShaderProgram>
             env_ptrs;
@@ -738,7 +955,8 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
                 env_ptrs.push_back(&envs[index]);
             }
         }
-        SerializePipeline(key, env_ptrs, pipeline_cache_filename, CACHE_VERSION);
+        SerializePipeline(key, env_ptrs, pipeline_cache_filename, PIPELINE_CACHE_VERSION,
+                          pipeline_cache_index);
     });
     return pipeline;
 }
@@ -755,9 +973,13 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     if (!pipeline || pipeline_cache_filename.empty()) {
         return pipeline;
     }
+    if (VideoCommon::IsPipelineStored(pipeline_cache_index, key)) {
+        VideoCommon::MarkPipelineUsed(pipeline_cache_index, key);
+        return pipeline;
+    }
     serialization_thread.QueueWork([this, key, env_ = std::move(env)] {
         SerializePipeline(key, std::array<const GenericEnvironment*, 1>{&env_},
-                          pipeline_cache_filename, CACHE_VERSION);
+                          pipeline_cache_filename, PIPELINE_CACHE_VERSION, pipeline_cache_index);
     });
     return pipeline;
 }
@@ -773,17 +995,13 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
 
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
 
-    Shader::Maxwell::Flow::CFG cfg{env, pools.flow_block, env.StartAddress()};
-
-    // Dump it before error.
-    if (Settings::values.dump_shaders) {
-        env.Dump(hash, key.unique_hash);
-    }
-
-    auto program{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
-    const std::vector<u32> code{EmitSPIRV(profile, program, this->optimize_spirv_output)};
-    device.SaveShader(code);
-    vk::ShaderModule spv_module{BuildShader(device, code)};
+    Shader::CompileStatistics::PipelineTimer pipeline_timer;
+    const ComputePipelineShader shader{TranslateComputePipeline(
+        pools, key, env, profile, host_info, optimize_spirv_output, UsableSpirvCache(),
+        &translation_cache)};
+    pipeline_timer.AddOutputSize(shader.stage.code.size() * sizeof(u32));
+    device.SaveShader(shader.stage.code);
+    vk::ShaderModule spv_module{BuildShader(device, shader.stage.code)};
     if (device.HasDebuggingToolAttached()) {
         const auto name{fmt::format("Shader {:016x}", key.unique_hash)};
         spv_module.SetObjectNameEXT(name.c_str());
@@ -791,7 +1009,8 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
     return std::make_unique<ComputePipeline>(device, vulkan_pipeline_cache, descriptor_pool,
                                              guest_descriptor_queue, thread_worker, statistics,
-                                             &shader_notify, program.info, std::move(spv_module));
+                                             &shader_notify, shader.program.info,
+                                             std::move(spv_module));
 
 } catch (const Shader::Exception& exception) {
     LOG_ERROR(Render_Vulkan, "{}", exception.what());
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -5,26 +8,36 @@
 
 #include <array>
 #include <cstddef>
+#include <atomic>
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <stop_token>
 #include <type_traits>
+#include <utility>
 #include <unordered_map>
 #include <vector>
 
 #include "common/common_types.h"
 #include "common/thread_worker.h"
+#include "shader_recompiler/arena.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/program.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
 #include "shader_recompiler/host_translate_info.h"
 #include "shader_recompiler/object_pool.h"
 #include "shader_recompiler/profile.h"
+#include "shader_recompiler/runtime_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 #include "video_core/renderer_vulkan/vk_compute_pipeline.h"
 #include "video_core/renderer_vulkan/vk_graphics_pipeline.h"
+#include "video_core/renderer_vulkan/vk_spirv_cache.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/shader_cache.h"
 
@@ -32,8 +45,8 @@ namespace Core {
 class System;
 }
 
-namespace Shader::IR {
-struct Program;
+namespace Shader {
+class Environment;
 }
 
 namespace VideoCore {
@@ -44,6 +57,9 @@ namespace Vulkan {
 
 using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
+/// Version of the pipeline cache files written by the Vulkan renderer
+constexpr u32 PIPELINE_CACHE_VERSION = 12;
+
 struct ComputePipelineCacheKey {
     u64 unique_hash;
     u32 shared_memory_size;
@@ -90,13 +106,73 @@ struct ShaderPools {
         flow_block.ReleaseContents();
         block.ReleaseContents();
         inst.ReleaseContents();
+        arena.Reset();
     }
 
+    /// Containers of the IR in the pools allocate from it
+    Shader::Arena arena;
     Shader::ObjectPool<Shader::IR::Inst> inst{8192};
     Shader::ObjectPool<Shader::IR::Block> block{32};
     Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block{32};
 };
 
+/// Translated programs of a graphics pipeline and the SPIR-V of each of its stages
+struct GraphicsPipelineShaders {
+    std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
+    std::array<SpirvCache::Entry, Maxwell::MaxShaderStage> stages;
+    std::array<bool, Maxwell::MaxShaderStage> enabled{};
+
+    /// Returns the info of each enabled stage, pointing into programs
+    [[nodiscard]] std::array<const Shader::Info*, Maxwell::MaxShaderStage> Infos() const {
+        std::array<const Shader::Info*, Maxwell::MaxShaderStage> infos{};
+        for (size_t stage = 0; stage < infos.size(); ++stage) {
+            infos[stage] = enabled[stage] ? &programs[stage + 1].info : nullptr;
+        }
+        return infos;
+    }
+};
+
+/// Translated program of a compute pipeline and its SPIR-V
+struct ComputePipelineShader {
+    Shader::IR::Program program;
+    SpirvCache::Entry stage;
+};
+
+/// Translates the shaders of a graphics pipeline without emitting code for them, marking the
+/// stages that are enabled. Programs are decoded through translation_cache when it is not null.
+[[nodiscard]] GraphicsPipelineShaders TranslateGraphicsPrograms(
+    ShaderPools& pools, const GraphicsPipelineCacheKey& key,
+    std::span<Shader::Environment* const> envs, const Shader::HostTranslateInfo& host_info,
+    Shader::Maxwell::TranslationCache* translation_cache);
+
+/// Returns the runtime info a stage of a graphics pipeline is emitted with, given the programs
+/// of the pipeline and the program of the previous enabled stage
+[[nodiscard]] Shader::RuntimeInfo MakeGraphicsRuntimeInfo(
+    std::span<const Shader::IR::Program> programs, const GraphicsPipelineCacheKey& key,
+    const Shader::IR::Program& program, const Shader::IR::Program* previous_program);
+
+/// Translates the shaders of a graphics pipeline and emits SPIR-V for them.
+/// Stages found in spirv_cache are not emitted again. Programs are decoded through
+/// translation_cache when it is not null. Does not need a device, so it can be used to build
+/// pipeline caches offline.
+[[nodiscard]] GraphicsPipelineShaders TranslateGraphicsPipeline(
+    ShaderPools& pools, const GraphicsPipelineCacheKey& key,
+    std::span<Shader::Environment* const> envs, const Shader::Profile& profile,
+    const Shader::HostTranslateInfo& host_info, bool optimize, const SpirvCache* spirv_cache,
+    Shader::Maxwell::TranslationCache* translation_cache);
+
+/// Translates the shader of a compute pipeline without emitting code for it, see above
+[[nodiscard]] Shader::IR::Program TranslateComputeProgram(
+    ShaderPools& pools, const ComputePipelineCacheKey& key, Shader::Environment& env,
+    const Shader::HostTranslateInfo& host_info,
+    Shader::Maxwell::TranslationCache* translation_cache);
+
+/// Translates the shader of a compute pipeline and emits SPIR-V for it, see above
+[[nodiscard]] ComputePipelineShader TranslateComputePipeline(
+    ShaderPools& pools, const ComputePipelineCacheKey& key, Shader::Environment& env,
+    const Shader::Profile& profile, const Shader::HostTranslateInfo& host_info, bool optimize,
+    const SpirvCache* spirv_cache, Shader::Maxwell::TranslationCache* translation_cache);
+
 class PipelineCache : public VideoCommon::ShaderCache {
 public:
     explicit PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, const Device& device,
@@ -113,6 +189,8 @@ public:
     void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                            const VideoCore::DiskResourceLoadCallback& callback);
 
+    void TickFrame();
+
 private:
     [[nodiscard]] GraphicsPipeline* CurrentGraphicsPipelineSlowPath();
 
@@ -140,6 +218,12 @@ private:
     vk::PipelineCache LoadVulkanPipelineCache(const std::filesystem::path& filename,
                                               u32 expected_cache_version);
 
+    /// Moves pipelines built in the background into the caches and queues more of them
+    void BuildDeferredPipelines();
+
+    /// Returns the precompiled stages, or null when settings baked into them changed since load
+    [[nodiscard]] const SpirvCache* UsableSpirvCache() const;
+
     const Device& device;
     Scheduler& scheduler;
     DescriptorPool& descriptor_pool;
@@ -163,7 +247,26 @@ private:
     Shader::Profile profile;
     Shader::HostTranslateInfo host_info;
 
+    /// Stages precompiled offline for this device
+    SpirvCache spirv_cache;
+    /// Target the loaded stages were built for, including the settings at load time
+    SpirvCacheTarget spirv_target{};
+
+    /// Decoded programs shared by the pipelines built on every worker
+    Shader::Maxwell::TranslationCache translation_cache;
+
     std::filesystem::path pipeline_cache_filename;
+    VideoCommon::PipelineCacheIndex pipeline_cache_index;
+
+    /// Cached pipelines not used recently, built in the background after boot
+    std::vector<VideoCommon::PipelineCacheRecord> deferred_pipelines;
+    std::mutex deferred_mutex;
+    std::vector<std::pair<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>>>
+        deferred_graphics;
+    std::vector<std::pair<ComputePipelineCacheKey, std::unique_ptr<ComputePipeline>>>
+        deferred_compute;
+    std::atomic<size_t> deferred_in_flight{};
+    std::stop_source deferred_stop;
 
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
@@ -0,0 +1,320 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <type_traits>
+
+#include "common/cityhash.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_vulkan/vk_spirv_cache.h"
+
+namespace Vulkan {
+namespace {
+constexpr std::array<char, 8> TARGET_MAGIC_NUMBER{'e', 'd', 'e', 'n', 's', 'p', 'v', 't'};
+constexpr std::array<char, 8> CACHE_MAGIC_NUMBER{'e', 'd', 'e', 'n', 's', 'p', 'v', 'c'};
+constexpr u32 FORMAT_VERSION = 2;
+
+// Fields are visited one by one so padding never ends up in files or hashes
+template <typename Target, typename Func>
+void VisitFields(Target& target, Func&& func) {
+    func(target.profile.supported_spirv);
+    func(target.profile.unified_descriptor_binding);
+    func(target.profile.support_descriptor_aliasing);
+    func(target.profile.support_int8);
+    func(target.profile.support_int16);
+    func(target.profile.support_int64);
+    func(target.profile.support_vertex_instance_id);
+    func(target.profile.support_float_controls);
+    func(target.profile.support_separate_denorm_behavior);
+    func(target.profile.support_separate_rounding_mode);
+    func(target.profile.support_fp16_denorm_preserve);
+    func(target.profile.support_fp32_denorm_preserve);
+    func(target.profile.support_fp16_denorm_flush);
+    func(target.profile.support_fp32_denorm_flush);
+    func(target.profile.support_fp16_signed_zero_nan_preserve);
+    func(target.profile.support_fp32_signed_zero_nan_preserve);
+    func(target.profile.support_fp64_signed_zero_nan_preserve);
+    func(target.profile.support_explicit_workgroup_layout);
+    func(target.profile.support_vote);
+    func(target.profile.support_viewport_index_layer_non_geometry);
+    func(target.profile.support_viewport_mask);
+    func(target.profile.support_typeless_image_loads);
+    func(target.profile.support_demote_to_helper_invocation);
+    func(target.profile.support_int64_atomics);
+    func(target.profile.support_derivative_control);
+    func(target.profile.support_geometry_shader_passthrough);
+    func(target.profile.support_native_ndc);
+    func(target.profile.support_gl_nv_gpu_shader_5);
+    func(target.profile.support_gl_amd_gpu_shader_half_float);
+    func(target.profile.support_gl_texture_shadow_lod);
+    func(target.profile.support_gl_warp_intrinsics);
+    func(target.profile.support_gl_variable_aoffi);
+    func(target.profile.support_gl_sparse_textures);
+    func(target.profile.support_gl_derivative_control);
+    func(target.profile.support_scaled_attributes);
+    func(target.profile.support_multi_viewport);
+    func(target.profile.support_geometry_streams);
+    func(target.profile.warp_size_potentially_larger_than_guest);
+    func(target.profile.lower_left_origin_mode);
+    func(target.profile.need_declared_frag_colors);
+    func(target.profile.need_fastmath_off);
+    func(target.profile.need_gather_subpixel_offset);
+    func(target.profile.has_broken_spirv_clamp);
+    func(target.profile.has_broken_spirv_position_input);
+    func(target.profile.has_broken_unsigned_image_offsets);
+    func(target.profile.has_broken_signed_operations);
+    func(target.profile.has_broken_fp16_float_controls);
+    func(target.profile.has_gl_component_indexing_bug);
+    func(target.profile.has_gl_precise_bug);
+    func(target.profile.has_gl_cbuf_ftou_bug);
+    func(target.profile.has_gl_bool_ref_bug);
+    func(target.profile.ignore_nan_fp_comparisons);
+    func(target.profile.has_broken_spirv_subgroup_mask_vector_extract_dynamic);
+    func(target.profile.gl_max_compute_smem_size);
+    func(target.profile.has_broken_robust);
+    func(target.profile.min_ssbo_alignment);
+    func(target.profile.max_user_clip_distances);
+    func(target.host_info.support_float64);
+    func(target.host_info.support_float16);
+    func(target.host_info.support_int64);
+    func(target.host_info.needs_demote_reorder);
+    func(target.host_info.support_snorm_render_buffer);
+    func(target.host_info.support_viewport_index_layer);
+    func(target.host_info.min_ssbo_alignment);
+    func(target.host_info.support_geometry_shader_passthrough);
+    func(target.host_info.support_conditional_barrier);
+    func(target.resolution_info.up_scale);
+    func(target.resolution_info.down_shift);
+    func(target.resolution_info.up_factor);
+    func(target.resolution_info.down_factor);
+    func(target.resolution_info.active);
+    func(target.resolution_info.downscale);
+    func(target.disable_shader_loop_safety_checks);
+}
+
+std::vector<char> SerializeFields(const SpirvCacheTarget& target) {
+    std::vector<char> bytes;
+    VisitFields(target, [&bytes](const auto& field) {
+        const auto* const data{reinterpret_cast<const char*>(&field)};
+        bytes.insert(bytes.end(), data, data + sizeof(field));
+    });
+    return bytes;
+}
+
+template <typename T>
+void Write(std::ofstream& file, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+void Read(std::ifstream& file, T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    file.read(reinterpret_cast<char*>(&value), sizeof(value));
+}
+} // Anonymous namespace
+
+SpirvCacheTarget MakeSpirvCacheTarget(const Shader::Profile& profile,
+                                      const Shader::HostTranslateInfo& host_info) {
+    return SpirvCacheTarget{
+        .profile = profile,
+        .host_info = host_info,
+        .resolution_info = Settings::values.resolution_info,
+        .disable_shader_loop_safety_checks =
+            Settings::values.disable_shader_loop_safety_checks.GetValue(),
+    };
+}
+
+bool MatchesCurrentSettings(const SpirvCacheTarget& target) {
+    const auto& resolution_info{Settings::values.resolution_info};
+    return target.resolution_info.up_scale == resolution_info.up_scale &&
+           target.resolution_info.down_shift == resolution_info.down_shift &&
+           target.resolution_info.up_factor == resolution_info.up_factor &&
+           target.resolution_info.down_factor == resolution_info.down_factor &&
+           target.resolution_info.active == resolution_info.active &&
+           target.resolution_info.downscale == resolution_info.downscale &&
+           target.disable_shader_loop_safety_checks ==
+               Settings::values.disable_shader_loop_safety_checks.GetValue();
+}
+
+void ApplySpirvCacheTargetSettings(const SpirvCacheTarget& target) {
+    Settings::values.resolution_info = target.resolution_info;
+    Settings::values.disable_shader_loop_safety_checks.SetValue(
+        target.disable_shader_loop_safety_checks);
+}
+
+u64 SpirvCacheTargetHash(const SpirvCacheTarget& target) {
+    const std::vector<char> bytes{SerializeFields(target)};
+    return Common::CityHash64(bytes.data(), bytes.size());
+}
+
+void SerializeSpirvCacheTarget(const std::filesystem::path& filename,
+                               const SpirvCacheTarget& target) try {
+    std::ofstream file(filename, std::ios::binary);
+    file.exceptions(std::ofstream::failbit);
+    const std::vector<char> bytes{SerializeFields(target)};
+    file.write(TARGET_MAGIC_NUMBER.data(), TARGET_MAGIC_NUMBER.size());
+    Write(file, FORMAT_VERSION);
+    Write(file, static_cast<u32>(bytes.size()));
+    file.write(bytes.data(), bytes.size());
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "Failed to write SPIR-V cache target {}: {}",
+              Common::FS::PathToUTF8String(filename), e.what());
+}
+
+std::optional<SpirvCacheTarget> LoadSpirvCacheTarget(const std::filesystem::path& filename) try {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    file.exceptions(std::ifstream::failbit);
+    std::array<char, 8> magic_number;
+    u32 format_version;
+    u32 size;
+    file.read(magic_number.data(), magic_number.size());
+    Read(file, format_version);
+    Read(file, size);
+    SpirvCacheTarget target{};
+    if (magic_number != TARGET_MAGIC_NUMBER || format_version != FORMAT_VERSION ||
+        size != SerializeFields(target).size()) {
+        LOG_ERROR(Common_Filesystem, "Invalid SPIR-V cache target {}",
+                  Common::FS::PathToUTF8String(filename));
+        return std::nullopt;
+    }
+    VisitFields(target, [&file](auto& field) { Read(file, field); });
+    return target;
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "Failed to read SPIR-V cache target {}: {}",
+              Common::FS::PathToUTF8String(filename), e.what());
+    return std::nullopt;
+}
+
+void SpirvCache::Load(const std::filesystem::path& filename, u32 cache_version,
+                      const SpirvCacheTarget& target) try {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return;
+    }
+    file.exceptions(std::ifstream::failbit);
+    file.seekg(0, std::ios::end);
+    const u64 file_size{static_cast<u64>(file.tellg())};
+    file.seekg(0, std::ios::beg);
+    std::array<char, 8> magic_number;
+    u32 format_version;
+    u32 file_cache_version;
+    u64 target_hash;
+    u64 count;
+    file.read(magic_number.data(), magic_number.size());
+    Read(file, format_version);
+    Read(file, file_cache_version);
+    Read(file, target_hash);
+    Read(file, count);
+    if (magic_number != CACHE_MAGIC_NUMBER || format_version != FORMAT_VERSION ||
+        file_cache_version != cache_version) {
+        LOG_INFO(Render_Vulkan, "Ignoring outdated SPIR-V cache {}",
+                 Common::FS::PathToUTF8String(filename));
+        return;
+    }
+    if (target_hash != SpirvCacheTargetHash(target)) {
+        LOG_WARNING(Render_Vulkan, "SPIR-V cache {} was built for a different device, ignoring it",
+                    Common::FS::PathToUTF8String(filename));
+        return;
+    }
+    // Check sizes before allocating, a corrupted size could exhaust memory
+    const auto fits{[&](u64 size) { return size <= file_size - static_cast<u64>(file.tellg()); }};
+    std::unordered_map<u64, StoredEntry> loaded;
+    for (u64 index = 0; index < count; ++index) {
+        u32 key_size;
+        u32 num_words;
+        StoredEntry stored;
+        Read(file, stored.stage);
+        Read(file, key_size);
+        if (!fits(key_size)) {
+            LOG_ERROR(Render_Vulkan, "SPIR-V cache {} is corrupted, ignoring it",
+                      Common::FS::PathToUTF8String(filename));
+            return;
+        }
+        stored.pipeline_key.resize(key_size);
+        file.read(stored.pipeline_key.data(), key_size);
+        Read(file, stored.entry.bindings);
+        Read(file, num_words);
+        if (!fits(u64{num_words} * sizeof(u32))) {
+            LOG_ERROR(Render_Vulkan, "SPIR-V cache {} is corrupted, ignoring it",
+                      Common::FS::PathToUTF8String(filename));
+            return;
+        }
+        stored.entry.code.resize(num_words);
+        file.read(reinterpret_cast<char*>(stored.entry.code.data()), num_words * sizeof(u32));
+        const u64 key{MakeKey(stored.pipeline_key, static_cast<size_t>(stored.stage))};
+        loaded.insert_or_assign(key, std::move(stored));
+    }
+    std::scoped_lock lock{mutex};
+    entries.merge(loaded);
+    LOG_INFO(Render_Vulkan, "Loaded {} precompiled shader stages", entries.size());
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "Failed to read SPIR-V cache {}: {}",
+              Common::FS::PathToUTF8String(filename), e.what());
+}
+
+void SpirvCache::Save(const std::filesystem::path& filename, u32 cache_version,
+                      const SpirvCacheTarget& target) const try {
+    std::ofstream file(filename, std::ios::binary);
+    file.exceptions(std::ofstream::failbit);
+    std::scoped_lock lock{mutex};
+    file.write(CACHE_MAGIC_NUMBER.data(), CACHE_MAGIC_NUMBER.size());
+    Write(file, FORMAT_VERSION);
+    Write(file, cache_version);
+    Write(file, SpirvCacheTargetHash(target));
+    Write(file, static_cast<u64>(entries.size()));
+    for (const auto& [key, stored] : entries) {
+        Write(file, stored.stage);
+        Write(file, static_cast<u32>(stored.pipeline_key.size()));
+        file.write(stored.pipeline_key.data(), stored.pipeline_key.size());
+        Write(file, stored.entry.bindings);
+        Write(file, static_cast<u32>(stored.entry.code.size()));
+        file.write(reinterpret_cast<const char*>(stored.entry.code.data()),
+                   stored.entry.code.size() * sizeof(u32));
+    }
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "Failed to write SPIR-V cache {}: {}",
+              Common::FS::PathToUTF8String(filename), e.what());
+    static_cast<void>(Common::FS::RemoveFile(filename));
+}
+
+const SpirvCache::Entry* SpirvCache::Find(std::span<const char> pipeline_key,
+                                          size_t stage) const {
+    std::scoped_lock lock{mutex};
+    const auto it{entries.find(MakeKey(pipeline_key, stage))};
+    if (it == entries.end() || it->second.stage != stage ||
+        !std::ranges::equal(it->second.pipeline_key, pipeline_key)) {
+        return nullptr;
+    }
+    return &it->second.entry;
+}
+
+void SpirvCache::Insert(std::span<const char> pipeline_key, size_t stage, Entry entry) {
+    std::scoped_lock lock{mutex};
+    // Entries are never replaced, so pointers returned by Find stay valid
+    entries.try_emplace(MakeKey(pipeline_key, stage),
+                        StoredEntry{
+                            .pipeline_key{pipeline_key.begin(), pipeline_key.end()},
+                            .stage = static_cast<u64>(stage),
+                            .entry = std::move(entry),
+                        });
+}
+
+size_t SpirvCache::Size() const {
+    std::scoped_lock lock{mutex};
+    return entries.size();
+}
+
+u64 SpirvCache::MakeKey(std::span<const char> pipeline_key, size_t stage) noexcept {
+    return Common::CityHash64WithSeed(pipeline_key.data(), pipeline_key.size(),
+                                      static_cast<u64>(stage));
+}
+
+} // namespace Vulkan
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/settings.h"
+#include "shader_recompiler/backend/bindings.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/profile.h"
+
+namespace Vulkan {
+
+/// Files stored next to the pipeline cache of a title
+constexpr const char* SPIRV_CACHE_TARGET_FILENAME = "vulkan_target.bin";
+constexpr const char* SPIRV_CACHE_FILENAME = "vulkan_spirv.bin";
+
+/// Host properties and settings SPIR-V is emitted for. The renderer records its target next to
+/// the pipeline cache so SPIR-V can be emitted for the same host without a device.
+struct SpirvCacheTarget {
+    Shader::Profile profile;
+    Shader::HostTranslateInfo host_info;
+    /// Scale baked into shaders by the rescaling pass
+    Settings::ResolutionScalingInfo resolution_info;
+    bool disable_shader_loop_safety_checks;
+};
+
+/// Returns the target of the given host with the current settings
+[[nodiscard]] SpirvCacheTarget MakeSpirvCacheTarget(const Shader::Profile& profile,
+                                                    const Shader::HostTranslateInfo& host_info);
+
+/// Returns true when the current settings emit the same SPIR-V as the settings of target
+[[nodiscard]] bool MatchesCurrentSettings(const SpirvCacheTarget& target);
+
+/// Makes the current settings match target, for tools emitting SPIR-V for it
+void ApplySpirvCacheTargetSettings(const SpirvCacheTarget& target);
+
+/// Returns a hash of every field of target that affects the emitted SPIR-V
+[[nodiscard]] u64 SpirvCacheTargetHash(const SpirvCacheTarget& target);
+
+void SerializeSpirvCacheTarget(const std::filesystem::path& filename,
+                               const SpirvCacheTarget& target);
+
+[[nodiscard]] std::optional<SpirvCacheTarget> LoadSpirvCacheTarget(
+    const std::filesystem::path& filename);
+
+/// Optimized SPIR-V of pipeline stages built ahead of time, keyed by pipeline key and stage.
+/// Stages found here skip SPIR-V emission and optimization when their pipeline is built.
+class SpirvCache {
+public:
+    struct Entry {
+        std::vector<u32> code;
+        /// Bindings after emitting the stage, the next stage continues from these
+        Shader::Backend::Bindings bindings;
+    };
+
+    /// Loads a cache file, entries built for a different target or cache version are ignored
+    void Load(const std::filesystem::path& filename, u32 cache_version,
+              const SpirvCacheTarget& target);
+
+    void Save(const std::filesystem::path& filename, u32 cache_version,
+              const SpirvCacheTarget& target) const;
+
+    [[nodiscard]] const Entry* Find(std::span<const char> pipeline_key, size_t stage) const;
+
+    template <typename Key>
+    [[nodiscard]] const Entry* Find(const Key& pipeline_key, size_t stage) const {
+        static_assert(std::has_unique_object_representations_v<Key>);
+        return Find(AsBytes(pipeline_key), stage);
+    }
+
+    void Insert(std::span<const char> pipeline_key, size_t stage, Entry entry);
+
+    template <typename Key>
+    void Insert(const Key& pipeline_key, size_t stage, Entry entry) {
+        static_assert(std::has_unique_object_representations_v<Key>);
+        Insert(AsBytes(pipeline_key), stage, std::move(entry));
+    }
+
+    [[nodiscard]] size_t Size() const;
+
+private:
+    struct StoredEntry {
+        /// Full pipeline key, verified on lookups so hash collisions never return other code
+        std::vector<char> pipeline_key;
+        u64 stage;
+        Entry entry;
+    };
+
+    /// Returns the bytes the key compares, graphics keys skip the dynamic state they don't use
+    template <typename Key>
+    [[nodiscard]] static std::span<const char> AsBytes(const Key& pipeline_key) noexcept {
+        const auto* const data{reinterpret_cast<const char*>(&pipeline_key)};
+        if constexpr (requires { pipeline_key.Size(); }) {
+            return std::span(data, pipeline_key.Size());
+        } else {
+            return std::span(data, sizeof(pipeline_key));
+        }
+    }
+
+    [[nodiscard]] static u64 MakeKey(std::span<const char> pipeline_key, size_t stage) noexcept;
+
+    mutable std::mutex mutex;
+    std::unordered_map<u64, StoredEntry> entries;
+};
+
+} // namespace Vulkan
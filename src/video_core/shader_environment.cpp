@@ -1,9 +1,15 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -13,9 +19,11 @@
 #include "common/common_types.h"
 #include "common/div_ceil.h"
 #include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/polyfill_ranges.h"
+#include "common/zstd_compression.h"
 #include "shader_recompiler/environment.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/memory_manager.h"
@@ -25,10 +33,134 @@
 
 namespace VideoCommon {
 
-constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h'};
+constexpr std::array<char, 8> MAGIC_NUMBER{'e', 'd', 'e', 'n', 'p', 'c', 'c', 'h'};
+constexpr std::array<char, 8> LEGACY_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h'};
+
+/// Version of the container layout, independent from the backend cache version
+constexpr u32 CONTAINER_VERSION = 2;
+
+/// Pipelines used within this many loading sessions are built before boot, the rest lazily
+constexpr u32 HOT_SESSIONS = 2;
 
 constexpr size_t INST_SIZE = sizeof(u64);
 
+namespace {
+/*
+ * Pipeline cache file layout:
+ *
+ *   FileHeader
+ *   { RecordHeader, payload }...
+ *
+ * Records are only ever appended. Environment records hold a zstd compressed environment and are
+ * written once per unique environment. Pipeline records reference the environments they use by
+ * content hash and hold the backend pipeline key uncompressed. The record headers form the table
+ * of contents of the file and can be walked without touching any compressed payload.
+ *
+ * The loading session counter in the header and the usage stamps in pipeline records are the only
+ * fields rewritten in place.
+ */
+struct FileHeader {
+    std::array<char, 8> magic;
+    u32 container_version;
+    u32 cache_version;
+    u32 session;
+    u32 reserved;
+};
+static_assert(sizeof(FileHeader) == 24);
+
+enum class RecordType : u32 {
+    Environment,
+    Pipeline,
+};
+
+struct RecordHeader {
+    RecordType type;
+    u32 size; ///< Size in bytes of the payload following the header
+};
+static_assert(sizeof(RecordHeader) == 8);
+
+struct EnvironmentRecord {
+    u64 hash; ///< Hash of the uncompressed environment
+    u32 size; ///< Size in bytes of the uncompressed environment
+    Shader::Stage stage;
+};
+static_assert(sizeof(EnvironmentRecord) == 16);
+
+struct PipelineRecord {
+    u32 num_envs;
+    u32 key_size;
+    PipelineUsage usage;
+};
+static_assert(sizeof(PipelineRecord) == 16);
+
+u64 HashKey(std::span<const char> key) {
+    return Common::CityHash64(key.data(), key.size());
+}
+
+/// Overwrites a value of an existing file in place
+template <typename T>
+void WriteInPlace(std::fstream& file, size_t offset, const T& value) {
+    file.seekp(static_cast<std::streamoff>(offset))
+        .write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/// Appends trivially copyable values to a byte vector
+class ByteWriter {
+public:
+    explicit ByteWriter(std::vector<u8>& out_) : out{out_} {}
+
+    ByteWriter& Write(const void* data, size_t size) {
+        const u8* const bytes{static_cast<const u8*>(data)};
+        out.insert(out.end(), bytes, bytes + size);
+        return *this;
+    }
+
+    template <typename T>
+    ByteWriter& Write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return Write(&value, sizeof(value));
+    }
+
+private:
+    std::vector<u8>& out;
+};
+
+/// Reads trivially copyable values from a byte span, failing instead of reading out of bounds
+class ByteReader {
+public:
+    explicit ByteReader(std::span<const u8> data_) : data{data_} {}
+
+    ByteReader& Read(void* dest, size_t size) {
+        if (failed || size > Remaining()) {
+            failed = true;
+            return *this;
+        }
+        std::memcpy(dest, data.data() + offset, size);
+        offset += size;
+        return *this;
+    }
+
+    template <typename T>
+    ByteReader& Read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return Read(&value, sizeof(value));
+    }
+
+    [[nodiscard]] size_t Remaining() const noexcept {
+        return data.size() - offset;
+    }
+
+    [[nodiscard]] bool Failed() const noexcept {
+        return failed;
+    }
+
+private:
+    std::span<const u8> data;
+    size_t offset{};
+    bool failed{};
+};
+} // Anonymous namespace
+
 using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
 static u64 MakeCbufKey(u32 index, u32 offset) {
@@ -149,6 +281,10 @@ u64 GenericEnvironment::ReadInstruction(u32 address) {
     return gpu_memory->Read<u64>(program_base + address);
 }
 
+bool GenericEnvironment::HasUnboundInstructions() const {
+    return has_unbound_instructions;
+}
+
 std::optional<u64> GenericEnvironment::Analyze() {
     const std::optional<u64> size{TryFindSize()};
     if (!size) {
@@ -193,53 +329,45 @@ void GenericEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
     DumpImpl(pipeline_hash, shader_hash, code, read_highest, read_lowest, initial_offset, stage);
 }
 
-void GenericEnvironment::Serialize(std::ofstream& file) const {
+void GenericEnvironment::Serialize(std::vector<u8>& out) const {
     const u64 code_size{static_cast<u64>(CachedSizeBytes())};
     const u64 num_texture_types{static_cast<u64>(texture_types.size())};
     const u64 num_texture_pixel_formats{static_cast<u64>(texture_pixel_formats.size())};
     const u64 num_cbuf_values{static_cast<u64>(cbuf_values.size())};
     const u64 num_cbuf_replacement_values{static_cast<u64>(cbuf_replacements.size())};
 
-    file.write(reinterpret_cast<const char*>(&code_size), sizeof(code_size))
-        .write(reinterpret_cast<const char*>(&num_texture_types), sizeof(num_texture_types))
-        .write(reinterpret_cast<const char*>(&num_texture_pixel_formats),
-               sizeof(num_texture_pixel_formats))
-        .write(reinterpret_cast<const char*>(&num_cbuf_values), sizeof(num_cbuf_values))
-        .write(reinterpret_cast<const char*>(&num_cbuf_replacement_values),
-               sizeof(num_cbuf_replacement_values))
-        .write(reinterpret_cast<const char*>(&local_memory_size), sizeof(local_memory_size))
-        .write(reinterpret_cast<const char*>(&texture_bound), sizeof(texture_bound))
-        .write(reinterpret_cast<const char*>(&start_address), sizeof(start_address))
-        .write(reinterpret_cast<const char*>(&cached_lowest), sizeof(cached_lowest))
-        .write(reinterpret_cast<const char*>(&cached_highest), sizeof(cached_highest))
-        .write(reinterpret_cast<const char*>(&viewport_transform_state),
-               sizeof(viewport_transform_state))
-        .write(reinterpret_cast<const char*>(&stage), sizeof(stage))
-        .write(reinterpret_cast<const char*>(code.data()), code_size);
+    ByteWriter writer{out};
+    writer.Write(code_size)
+        .Write(num_texture_types)
+        .Write(num_texture_pixel_formats)
+        .Write(num_cbuf_values)
+        .Write(num_cbuf_replacement_values)
+        .Write(local_memory_size)
+        .Write(texture_bound)
+        .Write(start_address)
+        .Write(cached_lowest)
+        .Write(cached_highest)
+        .Write(viewport_transform_state)
+        .Write(stage)
+        .Write(code.data(), code_size);
     for (const auto& [key, type] : texture_types) {
-        file.write(reinterpret_cast<const char*>(&key), sizeof(key))
-            .write(reinterpret_cast<const char*>(&type), sizeof(type));
+        writer.Write(key).Write(type);
     }
     for (const auto& [key, format] : texture_pixel_formats) {
-        file.write(reinterpret_cast<const char*>(&key), sizeof(key))
-            .write(reinterpret_cast<const char*>(&format), sizeof(format));
+        writer.Write(key).Write(format);
     }
     for (const auto& [key, type] : cbuf_values) {
-        file.write(reinterpret_cast<const char*>(&key), sizeof(key))
-            .write(reinterpret_cast<const char*>(&type), sizeof(type));
+        writer.Write(key).Write(type);
     }
     for (const auto& [key, type] : cbuf_replacements) {
-        file.write(reinterpret_cast<const char*>(&key), sizeof(key))
-            .write(reinterpret_cast<const char*>(&type), sizeof(type));
+        writer.Write(key).Write(type);
     }
     if (stage == Shader::Stage::Compute) {
-        file.write(reinterpret_cast<const char*>(&workgroup_size), sizeof(workgroup_size))
-            .write(reinterpret_cast<const char*>(&shared_memory_size), sizeof(shared_memory_size));
+        writer.Write(workgroup_size).Write(shared_memory_size);
     } else {
-        file.write(reinterpret_cast<const char*>(&sph), sizeof(sph));
+        writer.Write(sph);
         if (stage == Shader::Stage::Geometry) {
-            file.write(reinterpret_cast<const char*>(&gp_passthrough_mask),
-                       sizeof(gp_passthrough_mask));
+            writer.Write(gp_passthrough_mask);
         }
     }
 }
@@ -448,68 +576,66 @@ u32 ComputeEnvironment::ReadViewportTransformState() {
     return viewport_transform_state;
 }
 
-void FileEnvironment::Deserialize(std::ifstream& file) {
+bool FileEnvironment::Deserialize(std::span<const u8> data) {
     u64 code_size{};
     u64 num_texture_types{};
     u64 num_texture_pixel_formats{};
     u64 num_cbuf_values{};
     u64 num_cbuf_replacement_values{};
-    file.read(reinterpret_cast<char*>(&code_size), sizeof(code_size))
-        .read(reinterpret_cast<char*>(&num_texture_types), sizeof(num_texture_types))
-        .read(reinterpret_cast<char*>(&num_texture_pixel_formats),
-              sizeof(num_texture_pixel_formats))
-        .read(reinterpret_cast<char*>(&num_cbuf_values), sizeof(num_cbuf_values))
-        .read(reinterpret_cast<char*>(&num_cbuf_replacement_values),
-              sizeof(num_cbuf_replacement_values))
-        .read(reinterpret_cast<char*>(&local_memory_size), sizeof(local_memory_size))
-        .read(reinterpret_cast<char*>(&texture_bound), sizeof(texture_bound))
-        .read(reinterpret_cast<char*>(&start_address), sizeof(start_address))
-        .read(reinterpret_cast<char*>(&read_lowest), sizeof(read_lowest))
-        .read(reinterpret_cast<char*>(&read_highest), sizeof(read_highest))
-        .read(reinterpret_cast<char*>(&viewport_transform_state), sizeof(viewport_transform_state))
-        .read(reinterpret_cast<char*>(&stage), sizeof(stage));
+    ByteReader reader{data};
+    reader.Read(code_size)
+        .Read(num_texture_types)
+        .Read(num_texture_pixel_formats)
+        .Read(num_cbuf_values)
+        .Read(num_cbuf_replacement_values)
+        .Read(local_memory_size)
+        .Read(texture_bound)
+        .Read(start_address)
+        .Read(read_lowest)
+        .Read(read_highest)
+        .Read(viewport_transform_state)
+        .Read(stage);
+    if (reader.Failed() || code_size > reader.Remaining()) {
+        return false;
+    }
     code.resize(Common::DivCeil(code_size, sizeof(u64)));
-    file.read(reinterpret_cast<char*>(code.data()), code_size);
-    for (size_t i = 0; i < num_texture_types; ++i) {
+    reader.Read(code.data(), code_size);
+    for (size_t i = 0; i < num_texture_types && !reader.Failed(); ++i) {
         u32 key;
         Shader::TextureType type;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&type), sizeof(type));
+        reader.Read(key).Read(type);
         texture_types.emplace(key, type);
     }
-    for (size_t i = 0; i < num_texture_pixel_formats; ++i) {
+    for (size_t i = 0; i < num_texture_pixel_formats && !reader.Failed(); ++i) {
         u32 key;
         Shader::TexturePixelFormat format;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&format), sizeof(format));
+        reader.Read(key).Read(format);
         texture_pixel_formats.emplace(key, format);
     }
-    for (size_t i = 0; i < num_cbuf_values; ++i) {
+    for (size_t i = 0; i < num_cbuf_values && !reader.Failed(); ++i) {
         u64 key;
         u32 value;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&value), sizeof(value));
+        reader.Read(key).Read(value);
         cbuf_values.emplace(key, value);
     }
-    for (size_t i = 0; i < num_cbuf_replacement_values; ++i) {
+    for (size_t i = 0; i < num_cbuf_replacement_values && !reader.Failed(); ++i) {
         u64 key;
         Shader::ReplaceConstant value;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&value), sizeof(value));
+        reader.Read(key).Read(value);
         cbuf_replacements.emplace(key, value);
     }
     if (stage == Shader::Stage::Compute) {
-        file.read(reinterpret_cast<char*>(&workgroup_size), sizeof(workgroup_size))
-            .read(reinterpret_cast<char*>(&shared_memory_size), sizeof(shared_memory_size));
+        reader.Read(workgroup_size).Read(shared_memory_size);
         initial_offset = 0;
     } else {
-        file.read(reinterpret_cast<char*>(&sph), sizeof(sph));
+        reader.Read(sph);
         initial_offset = sizeof(sph);
         if (stage == Shader::Stage::Geometry) {
-            file.read(reinterpret_cast<char*>(&gp_passthrough_mask), sizeof(gp_passthrough_mask));
+            reader.Read(gp_passthrough_mask);
         }
     }
     is_proprietary_driver = texture_bound == 2;
+    return !reader.Failed();
 }
 
 void FileEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
@@ -582,8 +708,32 @@ std::optional<Shader::ReplaceConstant> FileEnvironment::GetReplaceConstBuffer(u3
     return it->second;
 }
 
+std::vector<FileEnvironment> PipelineCacheRecord::DecodeEnvironments() const {
+    const std::span<const u8> data{file->Data()};
+    std::vector<FileEnvironment> envs(environments.size());
+    for (size_t index = 0; index < environments.size(); ++index) {
+        const EnvironmentLocation& location{environments[index]};
+        const std::vector<u8> decompressed{Common::Compression::DecompressDataZSTD(
+            data.subspan(location.offset, location.compressed_size), location.size)};
+        if (decompressed.size() != location.size ||
+            Common::CityHash64(reinterpret_cast<const char*>(decompressed.data()),
+                               decompressed.size()) != location.hash) {
+            LOG_ERROR(Common_Filesystem, "Corrupted environment 0x{:016x} in pipeline cache",
+                      location.hash);
+            return {};
+        }
+        if (!envs[index].Deserialize(decompressed)) {
+            LOG_ERROR(Common_Filesystem, "Malformed environment 0x{:016x} in pipeline cache",
+                      location.hash);
+            return {};
+        }
+    }
+    return envs;
+}
+
 void SerializePipeline(std::span<const char> key, std::span<const GenericEnvironment* const> envs,
-                       const std::filesystem::path& filename, u32 cache_version) try {
+                       const std::filesystem::path& filename, u32 cache_version,
+                       PipelineCacheIndex& index) try {
     std::ofstream file(filename, std::ios::binary | std::ios::ate | std::ios::app);
     file.exceptions(std::ifstream::failbit);
     if (!file.is_open()) {
@@ -591,83 +741,361 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
                   Common::FS::PathToUTF8String(filename));
         return;
     }
+    std::unique_lock lock{index.mutex};
     if (file.tellp() == 0) {
-        // Write header
-        file.write(MAGIC_NUMBER.data(), MAGIC_NUMBER.size())
-            .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
+        // Write header, anything we knew about the file is gone
+        const FileHeader header{
+            .magic = MAGIC_NUMBER,
+            .container_version = CONTAINER_VERSION,
+            .cache_version = cache_version,
+            .session = index.session,
+            .reserved = 0,
+        };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        index.environments.clear();
+        index.usage.clear();
+        index.dirty_usage.clear();
     }
     if (!std::ranges::all_of(envs, &GenericEnvironment::CanBeSerialized)) {
         return;
     }
-    const u32 num_envs{static_cast<u32>(envs.size())};
-    file.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
+    const size_t file_offset{static_cast<size_t>(file.tellp())};
+    std::vector<u64> env_hashes;
+    env_hashes.reserve(envs.size());
+    // Environments written by this record, only added to the index once the record is stored
+    std::vector<u64> new_env_hashes;
+
+    std::vector<u8> record;
+    std::vector<u8> serialized;
     for (const GenericEnvironment* const env : envs) {
-        env->Serialize(file);
+        serialized.clear();
+        env->Serialize(serialized);
+        const u64 hash{
+            Common::CityHash64(reinterpret_cast<const char*>(serialized.data()), serialized.size())};
+        env_hashes.push_back(hash);
+        if (index.environments.contains(hash) ||
+            std::ranges::find(new_env_hashes, hash) != new_env_hashes.end()) {
+            continue;
+        }
+        lock.unlock();
+        const std::vector<u8> compressed{
+            Common::Compression::CompressDataZSTDDefault(serialized.data(), serialized.size())};
+        if (compressed.empty()) {
+            LOG_ERROR(Common_Filesystem, "Failed to compress pipeline environment");
+            return;
+        }
+        const RecordHeader record_header{
+            .type = RecordType::Environment,
+            .size = static_cast<u32>(sizeof(EnvironmentRecord) + compressed.size()),
+        };
+        const EnvironmentRecord env_record{
+            .hash = hash,
+            .size = static_cast<u32>(serialized.size()),
+            .stage = env->ShaderStage(),
+        };
+        ByteWriter{record}
+            .Write(record_header)
+            .Write(env_record)
+            .Write(compressed.data(), compressed.size());
+        lock.lock();
+        new_env_hashes.push_back(hash);
     }
-    file.write(key.data(), key.size_bytes());
+    const RecordHeader record_header{
+        .type = RecordType::Pipeline,
+        .size = static_cast<u32>(sizeof(PipelineRecord) + env_hashes.size() * sizeof(u64) +
+                                 key.size_bytes()),
+    };
+    const PipelineUsage usage{
+        .session = index.session,
+        .frame = index.frame.load(std::memory_order_relaxed),
+    };
+    const PipelineRecord pipeline_record{
+        .num_envs = static_cast<u32>(env_hashes.size()),
+        .key_size = static_cast<u32>(key.size_bytes()),
+        .usage = usage,
+    };
+    const size_t usage_offset{file_offset + record.size() + sizeof(RecordHeader) +
+                              offsetof(PipelineRecord, usage)};
+    lock.unlock();
+
+    ByteWriter{record}
+        .Write(record_header)
+        .Write(pipeline_record)
+        .Write(env_hashes.data(), env_hashes.size() * sizeof(u64))
+        .Write(key.data(), key.size_bytes());
+
+    file.write(reinterpret_cast<const char*>(record.data()), record.size());
+    file.flush();
+
+    lock.lock();
+    index.environments.insert(new_env_hashes.begin(), new_env_hashes.end());
+    index.usage.insert_or_assign(HashKey(key), PipelineCacheIndex::UsageEntry{
+                                                   .offset = usage_offset,
+                                                   .usage = usage,
+                                               });
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
+    {
+        std::scoped_lock lock{index.mutex};
+        index.environments.clear();
+        index.usage.clear();
+        index.dirty_usage.clear();
+    }
     if (!Common::FS::RemoveFile(filename)) {
         LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
                   Common::FS::PathToUTF8String(filename));
     }
 }
 
-void LoadPipelines(
-    std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics) try {
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
-        return;
+namespace {
+struct TableOfContents {
+    std::unordered_map<u64, PipelineCacheRecord::EnvironmentLocation> environments;
+    std::unordered_map<u64, Shader::Stage> stages;
+    std::unordered_map<u64, PipelineCacheIndex::UsageEntry> usage;
+    std::vector<PipelineCacheRecord> pipelines;
+    size_t valid_size{};
+};
+
+/// Walks the record headers of a mapped cache file, stopping at the first truncated record
+TableOfContents ReadTableOfContents(const std::shared_ptr<const Common::FS::MappedFile>& file) {
+    const std::span<const u8> data{file->Data()};
+    TableOfContents toc;
+    size_t offset{sizeof(FileHeader)};
+    while (offset < data.size()) {
+        RecordHeader record_header;
+        ByteReader reader{data.subspan(offset)};
+        reader.Read(record_header);
+        if (reader.Failed() || record_header.size > reader.Remaining()) {
+            break;
+        }
+        const size_t payload_offset{offset + sizeof(RecordHeader)};
+        const std::span<const u8> payload{data.subspan(payload_offset, record_header.size)};
+        ByteReader payload_reader{payload};
+        if (record_header.type == RecordType::Environment) {
+            EnvironmentRecord env_record;
+            payload_reader.Read(env_record);
+            if (payload_reader.Failed()) {
+                break;
+            }
+            toc.environments.emplace(env_record.hash,
+                                     PipelineCacheRecord::EnvironmentLocation{
+                                         .offset = payload_offset + sizeof(EnvironmentRecord),
+                                         .compressed_size = payload_reader.Remaining(),
+                                         .size = env_record.size,
+                                         .hash = env_record.hash,
+                                     });
+            toc.stages.emplace(env_record.hash, env_record.stage);
+        } else if (record_header.type == RecordType::Pipeline) {
+            PipelineRecord pipeline_record;
+            payload_reader.Read(pipeline_record);
+            if (payload_reader.Failed() || pipeline_record.num_envs == 0 ||
+                payload_reader.Remaining() !=
+                    pipeline_record.num_envs * sizeof(u64) + pipeline_record.key_size) {
+                break;
+            }
+            std::vector<PipelineCacheRecord::EnvironmentLocation> locations;
+            locations.reserve(pipeline_record.num_envs);
+            bool is_compute{};
+            for (u32 i = 0; i < pipeline_record.num_envs; ++i) {
+                u64 hash;
+                payload_reader.Read(hash);
+                const auto it{toc.environments.find(hash)};
+                if (it == toc.environments.end()) {
+                    break;
+                }
+                is_compute = toc.stages.at(hash) == Shader::Stage::Compute;
+                locations.push_back(it->second);
+            }
+            if (locations.size() == pipeline_record.num_envs) {
+                const std::span<const u8> key{payload.last(pipeline_record.key_size)};
+                toc.usage.insert_or_assign(
+                    HashKey(std::span(reinterpret_cast<const char*>(key.data()), key.size())),
+                    PipelineCacheIndex::UsageEntry{
+                        .offset = payload_offset + offsetof(PipelineRecord, usage),
+                        .usage = pipeline_record.usage,
+                    });
+                toc.pipelines.emplace_back(file, key, std::move(locations), pipeline_record.usage,
+                                           is_compute);
+            } else {
+                LOG_WARNING(Common_Filesystem, "Skipping pipeline with unknown environments");
+            }
+        } else {
+            break;
+        }
+        offset = payload_offset + record_header.size;
     }
-    file.exceptions(std::ifstream::failbit);
-    const auto end{file.tellg()};
-    file.seekg(0, std::ios::beg);
+    toc.valid_size = offset;
+    return toc;
+}
 
-    std::array<char, 8> magic_number;
-    u32 cache_version;
-    file.read(magic_number.data(), magic_number.size())
-        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
-    if (magic_number != MAGIC_NUMBER || cache_version != expected_cache_version) {
-        file.close();
+} // Anonymous namespace
+
+std::vector<PipelineCacheRecord> LoadPipelines(
+    std::stop_token stop_loading, const std::filesystem::path& filename,
+    u32 expected_cache_version, PipelineCacheIndex& index,
+    Common::UniqueFunction<void, PipelineCacheRecord> load_compute,
+    Common::UniqueFunction<void, PipelineCacheRecord> load_graphics) {
+    {
+        std::scoped_lock lock{index.mutex};
+        index.environments.clear();
+        index.usage.clear();
+        index.dirty_usage.clear();
+        index.session = 0;
+        index.frame = 0;
+    }
+    auto file{std::make_shared<Common::FS::MappedFile>(filename)};
+    if (!file->IsOpen()) {
+        return {};
+    }
+    FileHeader header{};
+    ByteReader{file->Data()}.Read(header);
+    const bool is_legacy{header.magic == LEGACY_MAGIC_NUMBER};
+    if (header.magic != MAGIC_NUMBER || header.container_version != CONTAINER_VERSION ||
+        header.cache_version != expected_cache_version) {
+        file->Close();
         if (Common::FS::RemoveFile(filename)) {
-            if (magic_number != MAGIC_NUMBER) {
-                LOG_ERROR(Common_Filesystem, "Invalid pipeline cache file");
-            }
-            if (cache_version != expected_cache_version) {
+            if (is_legacy || header.magic == MAGIC_NUMBER) {
                 LOG_INFO(Common_Filesystem, "Deleting old pipeline cache");
+            } else {
+                LOG_ERROR(Common_Filesystem, "Invalid pipeline cache file");
             }
         } else {
             LOG_ERROR(Common_Filesystem,
                       "Invalid pipeline cache file and failed to delete it in \"{}\"",
                       Common::FS::PathToUTF8String(filename));
         }
-        return;
+        return {};
     }
-    while (file.tellg() != end) {
-        if (stop_loading.stop_requested()) {
-            return;
+    TableOfContents toc{ReadTableOfContents(file)};
+    if (const size_t valid_size = toc.valid_size; valid_size != file->Data().size()) {
+        // Interrupted write, drop the partial record so new records can be appended after it
+        LOG_WARNING(Common_Filesystem, "Truncating pipeline cache from {} to {} bytes",
+                    file->Data().size(), valid_size);
+        toc = {};
+        file->Close();
+        std::error_code ec;
+        std::filesystem::resize_file(filename, valid_size, ec);
+        if (ec) {
+            LOG_ERROR(Common_Filesystem, "Failed to truncate pipeline cache file {}: {}",
+                      Common::FS::PathToUTF8String(filename), ec.message());
+            static_cast<void>(Common::FS::RemoveFile(filename));
+            return {};
+        }
+        file = std::make_shared<Common::FS::MappedFile>(filename);
+        toc = ReadTableOfContents(file);
+    }
+    const u32 last_session{header.session};
+    try {
+        std::fstream out(filename, std::ios::binary | std::ios::in | std::ios::out);
+        out.exceptions(std::ios::failbit);
+        WriteInPlace(out, offsetof(FileHeader, session), last_session + 1);
+    } catch (const std::ios_base::failure& e) {
+        LOG_ERROR(Common_Filesystem, "Failed to update pipeline cache session: {}", e.what());
+    }
+    {
+        std::scoped_lock lock{index.mutex};
+        for (const auto& [hash, location] : toc.environments) {
+            index.environments.insert(hash);
         }
-        u32 num_envs{};
-        file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
-        std::vector<FileEnvironment> envs(num_envs);
-        for (FileEnvironment& env : envs) {
-            env.Deserialize(file);
+        index.usage = std::move(toc.usage);
+        index.session = last_session + 1;
+    }
+    // Build what was needed early in recent sessions first, leave the rest for after boot
+    const auto is_hot{[last_session](const PipelineCacheRecord& record) {
+        return record.Usage().session + HOT_SESSIONS > last_session;
+    }};
+    const auto cold_begin{std::stable_partition(toc.pipelines.begin(), toc.pipelines.end(), is_hot)};
+    std::stable_sort(toc.pipelines.begin(), cold_begin, [](const auto& lhs, const auto& rhs) {
+        return lhs.Usage().frame < rhs.Usage().frame;
+    });
+    std::stable_sort(cold_begin, toc.pipelines.end(), [](const auto& lhs, const auto& rhs) {
+        const PipelineUsage lhs_usage{lhs.Usage()};
+        const PipelineUsage rhs_usage{rhs.Usage()};
+        if (lhs_usage.session != rhs_usage.session) {
+            return lhs_usage.session < rhs_usage.session;
         }
-        if (envs.front().ShaderStage() == Shader::Stage::Compute) {
-            load_compute(file, std::move(envs.front()));
+        return lhs_usage.frame > rhs_usage.frame;
+    });
+    for (auto it = toc.pipelines.begin(); it != cold_begin; ++it) {
+        if (stop_loading.stop_requested()) {
+            return {};
+        }
+        if (it->IsCompute()) {
+            load_compute(std::move(*it));
         } else {
-            load_graphics(file, std::move(envs));
+            load_graphics(std::move(*it));
         }
     }
+    LOG_INFO(Common_Filesystem, "Pipeline cache session {}: {} recently used, {} deferred",
+             last_session + 1, std::distance(toc.pipelines.begin(), cold_begin),
+             std::distance(cold_begin, toc.pipelines.end()));
+    return std::vector<PipelineCacheRecord>(std::make_move_iterator(cold_begin),
+                                            std::make_move_iterator(toc.pipelines.end()));
+}
 
-} catch (const std::ios_base::failure& e) {
-    LOG_ERROR(Common_Filesystem, "{}", e.what());
-    if (!Common::FS::RemoveFile(filename)) {
-        LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
+std::vector<PipelineCacheRecord> ReadPipelines(const std::filesystem::path& filename,
+                                               u32 expected_cache_version) {
+    auto file{std::make_shared<Common::FS::MappedFile>(filename)};
+    if (!file->IsOpen()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open pipeline cache {}",
+                  Common::FS::PathToUTF8String(filename));
+        return {};
+    }
+    FileHeader header{};
+    ByteReader{file->Data()}.Read(header);
+    if (header.magic != MAGIC_NUMBER || header.container_version != CONTAINER_VERSION ||
+        header.cache_version != expected_cache_version) {
+        LOG_ERROR(Common_Filesystem, "Pipeline cache {} is invalid or outdated",
                   Common::FS::PathToUTF8String(filename));
+        return {};
+    }
+    return ReadTableOfContents(file).pipelines;
+}
+
+bool IsPipelineStored(PipelineCacheIndex& index, std::span<const char> key) {
+    const u64 key_hash{HashKey(key)};
+    std::scoped_lock lock{index.mutex};
+    return index.usage.contains(key_hash);
+}
+
+void MarkPipelineUsed(PipelineCacheIndex& index, std::span<const char> key) {
+    const u64 key_hash{HashKey(key)};
+    std::scoped_lock lock{index.mutex};
+    const auto it{index.usage.find(key_hash)};
+    if (it == index.usage.end() || it->second.usage.session == index.session) {
+        return;
+    }
+    it->second.usage = PipelineUsage{
+        .session = index.session,
+        .frame = index.frame.load(std::memory_order_relaxed),
+    };
+    index.dirty_usage.push_back(key_hash);
+}
+
+void WritePipelineUsage(const std::filesystem::path& filename, PipelineCacheIndex& index) {
+    std::vector<PipelineCacheIndex::UsageEntry> entries;
+    {
+        std::scoped_lock lock{index.mutex};
+        entries.reserve(index.dirty_usage.size());
+        for (const u64 key_hash : index.dirty_usage) {
+            if (const auto it = index.usage.find(key_hash); it != index.usage.end()) {
+                entries.push_back(it->second);
+            }
+        }
+        index.dirty_usage.clear();
+    }
+    if (entries.empty()) {
+        return;
+    }
+    try {
+        std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+        file.exceptions(std::ios::failbit);
+        for (const PipelineCacheIndex::UsageEntry& entry : entries) {
+            WriteInPlace(file, entry.offset, entry.usage);
+        }
+    } catch (const std::ios_base::failure& e) {
+        LOG_ERROR(Common_Filesystem, "Failed to write pipeline usage: {}", e.what());
     }
 }
 
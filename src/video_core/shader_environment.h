@@ -1,17 +1,23 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
-#include <iosfwd>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "common/common_types.h"
@@ -20,6 +26,10 @@
 #include "shader_recompiler/environment.h"
 #include "video_core/engines/maxwell_3d.h"
 
+namespace Common::FS {
+class MappedFile;
+}
+
 namespace Tegra {
 class Memorymanager;
 }
@@ -44,6 +54,8 @@ public:
 
     [[nodiscard]] u64 ReadInstruction(u32 address) final;
 
+    [[nodiscard]] bool HasUnboundInstructions() const final;
+
     [[nodiscard]] std::optional<u64> Analyze();
 
     void SetCachedSize(size_t size_bytes);
@@ -60,7 +72,7 @@ public:
 
     void Dump(u64 pipeline_hash, u64 shader_hash) override;
 
-    void Serialize(std::ofstream& file) const;
+    void Serialize(std::vector<u8>& out) const;
 
     bool HasHLEMacroState() const override {
         return has_hle_engine_state;
@@ -165,10 +177,16 @@ public:
     FileEnvironment& operator=(const FileEnvironment&) = delete;
     FileEnvironment(const FileEnvironment&) = delete;
 
-    void Deserialize(std::ifstream& file);
+    /// Deserializes an environment written by GenericEnvironment::Serialize.
+    /// Returns false when the data is truncated or malformed.
+    [[nodiscard]] bool Deserialize(std::span<const u8> data);
 
     [[nodiscard]] u64 ReadInstruction(u32 address) override;
 
+    [[nodiscard]] bool HasUnboundInstructions() const override {
+        return false;
+    }
+
     [[nodiscard]] u32 ReadCbufValue(u32 cbuf_index, u32 cbuf_offset) override;
 
     [[nodiscard]] Shader::TextureType ReadTextureType(u32 handle) override;
@@ -212,21 +230,138 @@ private:
     u32 viewport_transform_state = 1;
 };
 
+/// Usage stamp stored with every pipeline of a pipeline cache file
+struct PipelineUsage {
+    u32 session; ///< Loading session in which the pipeline was last used
+    u32 frame;   ///< Frame of that session in which the pipeline was first used
+};
+
+/// Contents of a pipeline cache file known to the emulator.
+/// Populated by LoadPipelines and kept up to date by SerializePipeline, so environments shared
+/// between pipelines are only stored once in the file and usage stamps can be written back.
+struct PipelineCacheIndex {
+    struct UsageEntry {
+        size_t offset; ///< Offset of the usage stamp in the file
+        PipelineUsage usage;
+    };
+
+    std::mutex mutex;
+
+    /// Content hashes of the environments stored in the file
+    std::unordered_set<u64> environments;
+
+    /// Usage stamps of the pipelines stored in the file, keyed by pipeline key hash
+    std::unordered_map<u64, UsageEntry> usage;
+
+    /// Key hashes of the pipelines whose usage stamp has to be written back
+    std::vector<u64> dirty_usage;
+
+    /// Current loading session, incremented every time the file is loaded
+    u32 session{};
+
+    /// Frames presented in the current session
+    std::atomic<u32> frame{};
+};
+
+/// Pipeline stored in a memory mapped pipeline cache file.
+/// Records are cheap to copy and can be decoded concurrently from worker threads.
+class PipelineCacheRecord {
+public:
+    struct EnvironmentLocation {
+        size_t offset;
+        size_t compressed_size;
+        size_t size;
+        u64 hash;
+    };
+
+    explicit PipelineCacheRecord(std::shared_ptr<const Common::FS::MappedFile> file_,
+                                 std::span<const u8> key_,
+                                 std::vector<EnvironmentLocation> environments_,
+                                 PipelineUsage usage_, bool is_compute_)
+        : file{std::move(file_)}, key{key_}, environments{std::move(environments_)},
+          usage{usage_}, is_compute{is_compute_} {}
+
+    [[nodiscard]] bool IsCompute() const noexcept {
+        return is_compute;
+    }
+
+    [[nodiscard]] PipelineUsage Usage() const noexcept {
+        return usage;
+    }
+
+    /// Copies the pipeline key of the record, returns false when the stored size does not match
+    template <typename Key>
+    [[nodiscard]] bool ReadKey(Key& out_key) const {
+        static_assert(std::is_trivially_copyable_v<Key>);
+        if (key.size() != sizeof(Key)) {
+            return false;
+        }
+        std::memcpy(&out_key, key.data(), sizeof(Key));
+        return true;
+    }
+
+    /// Decompresses and deserializes the environments of the pipeline.
+    /// Returns an empty vector when the stored data is corrupted.
+    [[nodiscard]] std::vector<FileEnvironment> DecodeEnvironments() const;
+
+private:
+    std::shared_ptr<const Common::FS::MappedFile> file;
+    std::span<const u8> key;
+    std::vector<EnvironmentLocation> environments;
+    PipelineUsage usage{};
+    bool is_compute{};
+};
+
 void SerializePipeline(std::span<const char> key, std::span<const GenericEnvironment* const> envs,
-                       const std::filesystem::path& filename, u32 cache_version);
+                       const std::filesystem::path& filename, u32 cache_version,
+                       PipelineCacheIndex& index);
 
 template <typename Key, typename Envs>
 void SerializePipeline(const Key& key, const Envs& envs, const std::filesystem::path& filename,
-                       u32 cache_version) {
+                       u32 cache_version, PipelineCacheIndex& index) {
     static_assert(std::is_trivially_copyable_v<Key>);
     static_assert(std::has_unique_object_representations_v<Key>);
     SerializePipeline(std::span(reinterpret_cast<const char*>(&key), sizeof(key)),
-                      std::span(envs.data(), envs.size()), filename, cache_version);
+                      std::span(envs.data(), envs.size()), filename, cache_version, index);
+}
+
+/**
+ * Loads the pipelines of a cache file.
+ * Pipelines used in recent sessions are passed to the load callbacks, in the order they were first
+ * needed by the guest. The remaining pipelines are returned to be built lazily after boot.
+ *
+ * @returns Records of the pipelines that were not used recently, most recently used last.
+ */
+[[nodiscard]] std::vector<PipelineCacheRecord> LoadPipelines(
+    std::stop_token stop_loading, const std::filesystem::path& filename,
+    u32 expected_cache_version, PipelineCacheIndex& index,
+    Common::UniqueFunction<void, PipelineCacheRecord> load_compute,
+    Common::UniqueFunction<void, PipelineCacheRecord> load_graphics);
+
+/// Reads every pipeline of a cache file without modifying it, in the order they were stored.
+/// Returns an empty vector when the file is missing, invalid or from another cache version.
+[[nodiscard]] std::vector<PipelineCacheRecord> ReadPipelines(const std::filesystem::path& filename,
+                                                             u32 expected_cache_version);
+
+/// Returns true when a pipeline is stored in the cache file of an index
+[[nodiscard]] bool IsPipelineStored(PipelineCacheIndex& index, std::span<const char> key);
+
+template <typename Key>
+[[nodiscard]] bool IsPipelineStored(PipelineCacheIndex& index, const Key& key) {
+    static_assert(std::has_unique_object_representations_v<Key>);
+    return IsPipelineStored(index, std::span(reinterpret_cast<const char*>(&key), sizeof(key)));
+}
+
+/// Stamps a stored pipeline as used in the current session, if it has not been already
+void MarkPipelineUsed(PipelineCacheIndex& index, std::span<const char> key);
+
+template <typename Key>
+void MarkPipelineUsed(PipelineCacheIndex& index, const Key& key) {
+    static_assert(std::has_unique_object_representations_v<Key>);
+    MarkPipelineUsed(index, std::span(reinterpret_cast<const char*>(&key), sizeof(key)));
 }
 
-void LoadPipelines(
-    std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics);
+/// Writes the pending usage stamps of an index back to its pipeline cache file
+void WritePipelineUsage(const std::filesystem::path& filename, PipelineCacheIndex& index);
 
 } // namespace VideoCommon
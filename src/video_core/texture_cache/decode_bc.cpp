@@ -1,21 +1,55 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <span>
+#include <thread>
 #include <bc_decoder.h>
 
+#if defined(ARCHITECTURE_x86_64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#elif defined(ARCHITECTURE_arm64)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wshadow"
+#include <sse2neon.h>
+#pragma GCC diagnostic pop
+#endif
+
 #include "common/common_types.h"
+#include "common/div_ceil.h"
+#include "common/logging/log.h"
 #include "video_core/texture_cache/decode_bc.h"
+#include "video_core/texture_cache/decode_bptc.h"
+#include "video_core/textures/workers.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include "common/x64/cpu_detect.h"
+#endif
 
 namespace VideoCommon {
 
 namespace {
 constexpr u32 BLOCK_SIZE = 4;
 
+/// Minimum number of blocks decoded by a single worker task, smaller images are decoded inline.
+constexpr u32 MIN_BAND_BLOCKS = 4096;
+
 using VideoCore::Surface::PixelFormat;
 
+/// Decodes a whole 4x4 block, writing rows pitch bytes apart.
+using FullBlockFn = void (*)(const u8* src, u8* dst, size_t pitch);
+
 constexpr bool IsSigned(PixelFormat pixel_format) {
     switch (pixel_format) {
     case PixelFormat::BC4_SNORM:
@@ -41,6 +75,309 @@ constexpr u32 BlockSize(PixelFormat pixel_format) {
         return 16;
     }
 }
+
+bool HasSSSE3() {
+#if defined(ARCHITECTURE_x86_64)
+    const auto& cpu_caps{Common::GetCPUCaps()};
+    return cpu_caps.ssse3;
+#elif defined(ARCHITECTURE_arm64)
+    return true;
+#else
+    return false;
+#endif
+}
+
+template <typename T>
+T Load(const u8* src) {
+    T value;
+    std::memcpy(&value, src, sizeof(value));
+    return value;
+}
+
+/// Expands a RGB565 color to a RGBA8 texel, replicating the high bits into the low bits.
+constexpr std::array<u32, 3> Expand565(u32 color) {
+    return {
+        ((color & 0xF800) >> 8) | ((color & 0xE000) >> 13),
+        ((color & 0x07E0) >> 3) | ((color & 0x0600) >> 9),
+        ((color & 0x001F) << 3) | ((color & 0x001C) >> 2),
+    };
+}
+
+constexpr u32 PackRGBA8(const std::array<u32, 3>& rgb, u32 alpha) {
+    return rgb[0] | (rgb[1] << 8) | (rgb[2] << 16) | (alpha << 24);
+}
+
+/**
+ * Builds the four entry palette of a BC1 style color block.
+ * When separate_alpha is false (BC1), blocks with c0 <= c1 use three colors and transparent black.
+ */
+template <bool separate_alpha>
+std::array<u32, 4> ColorPalette(u32 c0, u32 c1) {
+    const std::array<u32, 3> e0 = Expand565(c0);
+    const std::array<u32, 3> e1 = Expand565(c1);
+    std::array<u32, 3> e2;
+    std::array<u32, 3> e3;
+    if (separate_alpha || c0 > c1) {
+        for (size_t i = 0; i < 3; ++i) {
+            e2[i] = (e0[i] * 2 + e1[i]) / 3;
+            e3[i] = (e1[i] * 2 + e0[i]) / 3;
+        }
+        return {PackRGBA8(e0, 0xFF), PackRGBA8(e1, 0xFF), PackRGBA8(e2, 0xFF),
+                PackRGBA8(e3, 0xFF)};
+    }
+    for (size_t i = 0; i < 3; ++i) {
+        e2[i] = (e0[i] + e1[i]) >> 1;
+    }
+    return {PackRGBA8(e0, 0xFF), PackRGBA8(e1, 0xFF), PackRGBA8(e2, 0xFF), 0};
+}
+
+/// Builds the eight entry palette of a BC4 style channel block.
+template <bool is_signed>
+std::array<u8, 8> ChannelPalette(u64 data) {
+    int c0;
+    int c1;
+    if constexpr (is_signed) {
+        c0 = static_cast<s8>(data & 0xFF);
+        c1 = static_cast<s8>((data >> 8) & 0xFF);
+    } else {
+        c0 = static_cast<u8>(data & 0xFF);
+        c1 = static_cast<u8>((data >> 8) & 0xFF);
+    }
+    std::array<u8, 8> palette;
+    palette[0] = static_cast<u8>(c0);
+    palette[1] = static_cast<u8>(c1);
+    if (c0 > c1) {
+        for (int i = 2; i < 8; ++i) {
+            palette[i] = static_cast<u8>(((8 - i) * c0 + (i - 1) * c1) / 7);
+        }
+    } else {
+        for (int i = 2; i < 6; ++i) {
+            palette[i] = static_cast<u8>(((6 - i) * c0 + (i - 1) * c1) / 5);
+        }
+        palette[6] = is_signed ? 0x80 : 0x00;
+        palette[7] = is_signed ? 0x7F : 0xFF;
+    }
+    return palette;
+}
+
+/// Returns the 3-bit palette index of texel i in a BC4 style channel block.
+constexpr u32 ChannelIndex(u64 data, u32 i) {
+    return static_cast<u32>((data >> (16 + i * 3)) & 7);
+}
+
+template <bool separate_alpha>
+void DecodeColorBlock(const u8* src, u8* dst, size_t pitch) {
+    const std::array<u32, 4> palette =
+        ColorPalette<separate_alpha>(Load<u16>(src), Load<u16>(src + 2));
+    const u32 indices = Load<u32>(src + 4);
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        std::array<u32, BLOCK_SIZE> row;
+        for (u32 x = 0; x < BLOCK_SIZE; ++x) {
+            row[x] = palette[(indices >> ((y * BLOCK_SIZE + x) * 2)) & 3];
+        }
+        std::memcpy(dst + y * pitch, row.data(), sizeof(row));
+    }
+}
+
+template <bool is_signed>
+void DecodeChannelBlock(const u8* src, u8* dst, size_t pitch, size_t bpp) {
+    const u64 data = Load<u64>(src);
+    const std::array<u8, 8> palette = ChannelPalette<is_signed>(data);
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        for (u32 x = 0; x < BLOCK_SIZE; ++x) {
+            dst[y * pitch + x * bpp] = palette[ChannelIndex(data, y * BLOCK_SIZE + x)];
+        }
+    }
+}
+
+void DecodeBc1Block(const u8* src, u8* dst, size_t pitch) {
+    DecodeColorBlock<false>(src, dst, pitch);
+}
+
+void DecodeBc3Block(const u8* src, u8* dst, size_t pitch) {
+    DecodeColorBlock<true>(src + 8, dst, pitch);
+    DecodeChannelBlock<false>(src, dst + 3, pitch, 4);
+}
+
+template <bool is_signed>
+void DecodeBc4Block(const u8* src, u8* dst, size_t pitch) {
+    DecodeChannelBlock<is_signed>(src, dst, pitch, 1);
+}
+
+template <bool is_signed>
+void DecodeBc5Block(const u8* src, u8* dst, size_t pitch) {
+    DecodeChannelBlock<is_signed>(src, dst, pitch, 2);
+    DecodeChannelBlock<is_signed>(src + 8, dst + 1, pitch, 2);
+}
+
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+/// Byte shuffles expanding a row of four 2-bit color indices into four RGBA8 palette entries.
+constexpr auto COLOR_ROW_SHUFFLES = [] {
+    std::array<std::array<u8, 16>, 256> shuffles{};
+    for (u32 row = 0; row < 256; ++row) {
+        for (u32 x = 0; x < BLOCK_SIZE; ++x) {
+            const u32 index = (row >> (x * 2)) & 3;
+            for (u32 byte = 0; byte < 4; ++byte) {
+                shuffles[row][x * 4 + byte] = static_cast<u8>(index * 4 + byte);
+            }
+        }
+    }
+    return shuffles;
+}();
+
+/// Byte shuffles moving the four alpha values of a row into the alpha bytes of RGBA8 texels.
+constexpr auto ALPHA_ROW_SHUFFLES = [] {
+    std::array<std::array<u8, 16>, BLOCK_SIZE> shuffles{};
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        shuffles[y].fill(0x80);
+        for (u32 x = 0; x < BLOCK_SIZE; ++x) {
+            shuffles[y][x * 4 + 3] = static_cast<u8>(y * BLOCK_SIZE + x);
+        }
+    }
+    return shuffles;
+}();
+
+__m128i LoadShuffle(const std::array<u8, 16>& shuffle) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffle.data()));
+}
+
+/// Spreads eight packed 3-bit values into the low bits of eight bytes.
+constexpr u64 SpreadIndices(u64 bits) {
+    bits = (bits & 0xFFF) | ((bits & 0xFFF000) << 20);
+    bits = (bits & 0x0000003F0000003FULL) | ((bits & 0x00000FC000000FC0ULL) << 10);
+    return (bits & 0x0007000700070007ULL) | ((bits & 0x0038003800380038ULL) << 5);
+}
+
+/// Returns the sixteen 3-bit indices of a channel block, one per byte.
+__m128i ChannelIndices(u64 data) {
+    const u64 low = SpreadIndices((data >> 16) & 0xFFFFFF);
+    const u64 high = SpreadIndices(data >> 40);
+    return _mm_set_epi64x(static_cast<s64>(high), static_cast<s64>(low));
+}
+
+/// Loads the channel palette into the low eight bytes of palette and returns the texel indices.
+template <bool is_signed>
+__m128i DecodeChannelSSSE3(const u8* src, __m128i& palette) {
+    const u64 data = Load<u64>(src);
+    const std::array<u8, 8> entries = ChannelPalette<is_signed>(data);
+    palette = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(entries.data()));
+    return ChannelIndices(data);
+}
+
+template <bool separate_alpha>
+__m128i ColorPaletteSSSE3(const u8* src) {
+    const std::array<u32, 4> palette =
+        ColorPalette<separate_alpha>(Load<u16>(src), Load<u16>(src + 2));
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(palette.data()));
+}
+
+void DecodeBc1BlockSSSE3(const u8* src, u8* dst, size_t pitch) {
+    const __m128i palette = ColorPaletteSSSE3<false>(src);
+    const u32 indices = Load<u32>(src + 4);
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        const __m128i shuffle = LoadShuffle(COLOR_ROW_SHUFFLES[(indices >> (y * 8)) & 0xFF]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + y * pitch),
+                         _mm_shuffle_epi8(palette, shuffle));
+    }
+}
+
+void DecodeBc3BlockSSSE3(const u8* src, u8* dst, size_t pitch) {
+    __m128i alpha_palette;
+    const __m128i alpha_indices = DecodeChannelSSSE3<false>(src, alpha_palette);
+    const __m128i alpha = _mm_shuffle_epi8(alpha_palette, alpha_indices);
+    const __m128i palette = ColorPaletteSSSE3<true>(src + 8);
+    const __m128i color_mask = _mm_set1_epi32(0x00FFFFFF);
+    const u32 indices = Load<u32>(src + 12);
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        const __m128i shuffle = LoadShuffle(COLOR_ROW_SHUFFLES[(indices >> (y * 8)) & 0xFF]);
+        const __m128i color = _mm_and_si128(_mm_shuffle_epi8(palette, shuffle), color_mask);
+        const __m128i row_alpha = _mm_shuffle_epi8(alpha, LoadShuffle(ALPHA_ROW_SHUFFLES[y]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + y * pitch),
+                         _mm_or_si128(color, row_alpha));
+    }
+}
+
+template <bool is_signed>
+void DecodeBc4BlockSSSE3(const u8* src, u8* dst, size_t pitch) {
+    __m128i palette;
+    const __m128i indices = DecodeChannelSSSE3<is_signed>(src, palette);
+    alignas(16) std::array<u8, 16> texels;
+    _mm_store_si128(reinterpret_cast<__m128i*>(texels.data()), _mm_shuffle_epi8(palette, indices));
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        std::memcpy(dst + y * pitch, texels.data() + y * BLOCK_SIZE, BLOCK_SIZE);
+    }
+}
+
+template <bool is_signed>
+void DecodeBc5BlockSSSE3(const u8* src, u8* dst, size_t pitch) {
+    __m128i red_palette;
+    __m128i green_palette;
+    const __m128i red_indices = DecodeChannelSSSE3<is_signed>(src, red_palette);
+    const __m128i green_indices =
+        _mm_add_epi8(DecodeChannelSSSE3<is_signed>(src + 8, green_palette), _mm_set1_epi8(8));
+    // Red entries live in the low half of the palette and green entries in the high half
+    const __m128i palette = _mm_unpacklo_epi64(red_palette, green_palette);
+    const __m128i rows01 =
+        _mm_shuffle_epi8(palette, _mm_unpacklo_epi8(red_indices, green_indices));
+    const __m128i rows23 =
+        _mm_shuffle_epi8(palette, _mm_unpackhi_epi8(red_indices, green_indices));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), rows01);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + pitch), _mm_srli_si128(rows01, 8));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + pitch * 2), rows23);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + pitch * 3), _mm_srli_si128(rows23, 8));
+}
+#endif
+
+/// Returns the whole block decoder for a format, or nullptr when blocks go through bc_decoder.
+FullBlockFn GetFullBlockDecoder(PixelFormat pixel_format) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    if (HasSSSE3()) {
+        switch (pixel_format) {
+        case PixelFormat::BC1_RGBA_UNORM:
+        case PixelFormat::BC1_RGBA_SRGB:
+            return DecodeBc1BlockSSSE3;
+        case PixelFormat::BC3_UNORM:
+        case PixelFormat::BC3_SRGB:
+            return DecodeBc3BlockSSSE3;
+        case PixelFormat::BC4_UNORM:
+            return DecodeBc4BlockSSSE3<false>;
+        case PixelFormat::BC4_SNORM:
+            return DecodeBc4BlockSSSE3<true>;
+        case PixelFormat::BC5_UNORM:
+            return DecodeBc5BlockSSSE3<false>;
+        case PixelFormat::BC5_SNORM:
+            return DecodeBc5BlockSSSE3<true>;
+        default:
+            break;
+        }
+    }
+#endif
+    switch (pixel_format) {
+    case PixelFormat::BC1_RGBA_UNORM:
+    case PixelFormat::BC1_RGBA_SRGB:
+        return DecodeBc1Block;
+    case PixelFormat::BC3_UNORM:
+    case PixelFormat::BC3_SRGB:
+        return DecodeBc3Block;
+    case PixelFormat::BC4_UNORM:
+        return DecodeBc4Block<false>;
+    case PixelFormat::BC4_SNORM:
+        return DecodeBc4Block<true>;
+    case PixelFormat::BC5_UNORM:
+        return DecodeBc5Block<false>;
+    case PixelFormat::BC5_SNORM:
+        return DecodeBc5Block<true>;
+    case PixelFormat::BC6H_UFLOAT:
+        return DecodeBc6hUfloatBlock;
+    case PixelFormat::BC6H_SFLOAT:
+        return DecodeBc6hSfloatBlock;
+    case PixelFormat::BC7_UNORM:
+    case PixelFormat::BC7_SRGB:
+        return DecodeBc7Block;
+    default:
+        return nullptr;
+    }
+}
 } // Anonymous namespace
 
 u32 ConvertedBytesPerBlock(VideoCore::Surface::PixelFormat pixel_format) {
@@ -61,7 +398,7 @@ u32 ConvertedBytesPerBlock(VideoCore::Surface::PixelFormat pixel_format) {
 
 template <auto decompress, PixelFormat pixel_format>
 void DecompressBlocks(std::span<const u8> input, std::span<u8> output, BufferImageCopy& copy,
-                      bool is_signed = false) {
+                      FullBlockFn decompress_full, bool is_signed = false) {
     const u32 out_bpp = ConvertedBytesPerBlock(pixel_format);
     const u32 block_size = BlockSize(pixel_format);
     const u32 width = copy.image_extent.width;
@@ -70,62 +407,91 @@ void DecompressBlocks(std::span<const u8> input, std::span<u8> output, BufferIma
     const u32 block_width = (std::min)(width, BLOCK_SIZE);
     const u32 block_height = (std::min)(height, BLOCK_SIZE);
     const u32 pitch = width * out_bpp;
-    size_t input_offset = 0;
-    size_t output_offset = 0;
-    for (u32 slice = 0; slice < depth; ++slice) {
-        for (u32 y = 0; y < height; y += block_height) {
-            size_t src_offset = input_offset;
-            size_t dst_offset = output_offset;
+    const u32 cols = Common::DivCeil(width, block_width);
+    const u32 rows_per_slice = Common::DivCeil(height, block_height);
+    const u32 rows = rows_per_slice * depth;
+    const size_t input_row_stride = copy.buffer_row_length * block_size / block_width;
+    const size_t output_row_stride = static_cast<size_t>(block_height) * pitch;
+
+    // Rows of blocks are independent, so any range of them can be decoded on its own. Blocks fully
+    // inside the image go through the whole block decoder, edge blocks through the clipping one.
+    const auto decompress_rows = [=](u32 first_row, u32 last_row) {
+        for (u32 row = first_row; row < last_row; ++row) {
+            const u32 y = (row % rows_per_slice) * block_height;
+            const bool full_row = decompress_full && y + BLOCK_SIZE <= height;
+            const u8* src = input.data() + row * input_row_stride;
+            u8* dst = output.data() + row * output_row_stride;
             for (u32 x = 0; x < width; x += block_width) {
-                const u8* src = input.data() + src_offset;
-                u8* const dst = output.data() + dst_offset;
-                if constexpr (IsSigned(pixel_format)) {
+                if (full_row && x + BLOCK_SIZE <= width) {
+                    decompress_full(src, dst, pitch);
+                } else if constexpr (IsSigned(pixel_format)) {
                     decompress(src, dst, x, y, width, height, is_signed);
                 } else {
                     decompress(src, dst, x, y, width, height);
                 }
-                src_offset += block_size;
-                dst_offset += block_width * out_bpp;
+                src += block_size;
+                dst += block_width * out_bpp;
             }
-            input_offset += copy.buffer_row_length * block_size / block_width;
-            output_offset += block_height * pitch;
         }
+    };
+
+    // Tile large images across the transcode workers in bands of block rows, aiming for a couple
+    // of bands per core so uneven bands still balance out
+    const u32 target_bands = (std::max)(std::thread::hardware_concurrency(), 1U) * 2;
+    const u32 band_rows = (std::max)(Common::DivCeil(MIN_BAND_BLOCKS, cols),
+                                     Common::DivCeil(rows, target_bands));
+    if (rows <= band_rows) {
+        decompress_rows(0, rows);
+        return;
+    }
+    Common::ThreadWorker& workers{Tegra::Texture::GetThreadWorkers()};
+    for (u32 first_row = 0; first_row < rows; first_row += band_rows) {
+        const u32 last_row = (std::min)(first_row + band_rows, rows);
+        workers.QueueWork([decompress_rows, first_row, last_row] {
+            decompress_rows(first_row, last_row);
+        });
     }
+    workers.WaitForRequests();
 }
 
 void DecompressBCn(std::span<const u8> input, std::span<u8> output, BufferImageCopy& copy,
                    VideoCore::Surface::PixelFormat pixel_format) {
+    const FullBlockFn decompress_full = GetFullBlockDecoder(pixel_format);
     switch (pixel_format) {
     case PixelFormat::BC1_RGBA_UNORM:
     case PixelFormat::BC1_RGBA_SRGB:
-        DecompressBlocks<bcn::DecodeBc1, PixelFormat::BC1_RGBA_UNORM>(input, output, copy);
+        DecompressBlocks<bcn::DecodeBc1, PixelFormat::BC1_RGBA_UNORM>(input, output, copy,
+                                                                      decompress_full);
         break;
     case PixelFormat::BC2_UNORM:
     case PixelFormat::BC2_SRGB:
-        DecompressBlocks<bcn::DecodeBc2, PixelFormat::BC2_UNORM>(input, output, copy);
+        DecompressBlocks<bcn::DecodeBc2, PixelFormat::BC2_UNORM>(input, output, copy,
+                                                                 decompress_full);
         break;
     case PixelFormat::BC3_UNORM:
     case PixelFormat::BC3_SRGB:
-        DecompressBlocks<bcn::DecodeBc3, PixelFormat::BC3_UNORM>(input, output, copy);
+        DecompressBlocks<bcn::DecodeBc3, PixelFormat::BC3_UNORM>(input, output, copy,
+                                                                 decompress_full);
         break;
     case PixelFormat::BC4_SNORM:
     case PixelFormat::BC4_UNORM:
         DecompressBlocks<bcn::DecodeBc4, PixelFormat::BC4_UNORM>(
-            input, output, copy, pixel_format == PixelFormat::BC4_SNORM);
+            input, output, copy, decompress_full, pixel_format == PixelFormat::BC4_SNORM);
         break;
     case PixelFormat::BC5_SNORM:
     case PixelFormat::BC5_UNORM:
         DecompressBlocks<bcn::DecodeBc5, PixelFormat::BC5_UNORM>(
-            input, output, copy, pixel_format == PixelFormat::BC5_SNORM);
+            input, output, copy, decompress_full, pixel_format == PixelFormat::BC5_SNORM);
         break;
     case PixelFormat::BC6H_SFLOAT:
     case PixelFormat::BC6H_UFLOAT:
         DecompressBlocks<bcn::DecodeBc6, PixelFormat::BC6H_UFLOAT>(
-            input, output, copy, pixel_format == PixelFormat::BC6H_SFLOAT);
+            input, output, copy, decompress_full, pixel_format == PixelFormat::BC6H_SFLOAT);
         break;
     case PixelFormat::BC7_SRGB:
     case PixelFormat::BC7_UNORM:
-        DecompressBlocks<bcn::DecodeBc7, PixelFormat::BC7_UNORM>(input, output, copy);
+        DecompressBlocks<bcn::DecodeBc7, PixelFormat::BC7_UNORM>(input, output, copy,
+                                                                 decompress_full);
         break;
     default:
         LOG_WARNING(HW_GPU, "Unimplemented BCn decompression {}", pixel_format);
@@ -0,0 +1,705 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#if defined(ARCHITECTURE_x86_64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#elif defined(ARCHITECTURE_arm64)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wshadow"
+#include <sse2neon.h>
+#pragma GCC diagnostic pop
+#endif
+
+#include "common/common_types.h"
+#include "video_core/texture_cache/decode_bptc.h"
+
+// BC6H and BC7 blocks are decoded with one kernel per mode, specialized at compile time from the
+// mode tables below. Endpoints are unpacked once per block, then every texel is interpolated with
+// a single multiply-add over its channels. Results match bc_decoder bit for bit.
+
+namespace VideoCommon {
+
+namespace {
+constexpr u32 BLOCK_SIZE = 4;
+constexpr u32 BLOCK_TEXELS = BLOCK_SIZE * BLOCK_SIZE;
+constexpr u32 NUM_PARTITIONS = 64;
+
+/// Subset of each texel in the two subset partitions, two bits per texel.
+constexpr std::array<u32, NUM_PARTITIONS> PARTITIONS2{
+    0x50505050, 0x40404040, 0x54545454, 0x54505040, 0x50404000, 0x55545450, 0x55545040, 0x54504000,
+    0x50400000, 0x55555450, 0x55544000, 0x54400000, 0x55555440, 0x55550000, 0x55555500, 0x55000000,
+    0x55150100, 0x00004054, 0x15010000, 0x00405054, 0x00004050, 0x15050100, 0x05010000, 0x40505054,
+    0x00404050, 0x05010100, 0x14141414, 0x05141450, 0x01155440, 0x00555500, 0x15014054, 0x05414150,
+    0x44444444, 0x55005500, 0x11441144, 0x05055050, 0x05500550, 0x11114444, 0x41144114, 0x44111144,
+    0x15055054, 0x01055040, 0x05041050, 0x05455150, 0x14414114, 0x50050550, 0x41411414, 0x00141400,
+    0x00041504, 0x00105410, 0x10541000, 0x04150400, 0x50410514, 0x41051450, 0x05415014, 0x14054150,
+    0x41050514, 0x41505014, 0x40011554, 0x54150140, 0x50505500, 0x00555050, 0x15151010, 0x54540404,
+};
+
+/// Subset of each texel in the three subset partitions, two bits per texel.
+constexpr std::array<u32, NUM_PARTITIONS> PARTITIONS3{
+    0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+    0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+    0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+    0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+    0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+    0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+    0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+    0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254,
+};
+
+/// Anchor texel of the second subset in the two subset partitions.
+constexpr std::array<u8, NUM_PARTITIONS> ANCHORS2{
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+    15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6,
+    6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15,
+};
+
+/// Anchor texels of the second and third subsets in the three subset partitions.
+constexpr std::array<u8, NUM_PARTITIONS> ANCHORS3_1{
+    3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6, 5, 3, 3,
+    3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15,
+    8, 15, 3, 5, 6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15,
+    3, 15, 5, 5, 5, 8, 5, 10, 5, 10, 8, 13, 15, 12, 3, 3,
+};
+constexpr std::array<u8, NUM_PARTITIONS> ANCHORS3_2{
+    15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15, 15, 15, 15, 8,
+    15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15, 15, 10, 8,
+    15, 3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8,
+    15, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 15, 15, 8,
+};
+
+constexpr std::array<u8, 4> WEIGHTS2{0, 21, 43, 64};
+constexpr std::array<u8, 8> WEIGHTS3{0, 9, 18, 27, 37, 46, 55, 64};
+constexpr std::array<u8, 16> WEIGHTS4{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+/// 128-bit block, read as a little endian bit string.
+struct Block {
+    [[nodiscard]] u32 Get(u32 offset, u32 count) const {
+        const u64 mask = (u64{1} << count) - 1;
+        if (offset + count <= 64) {
+            return static_cast<u32>((low >> offset) & mask);
+        }
+        if (offset >= 64) {
+            return static_cast<u32>((high >> (offset - 64)) & mask);
+        }
+        return static_cast<u32>(((low >> offset) | (high << (64 - offset))) & mask);
+    }
+
+    u64 low;
+    u64 high;
+};
+
+Block LoadBlock(const u8* src) {
+    Block block;
+    std::memcpy(&block.low, src, sizeof(block.low));
+    std::memcpy(&block.high, src + sizeof(block.low), sizeof(block.high));
+    return block;
+}
+
+constexpr u32 Subset(u32 subsets, u32 texel) {
+    return (subsets >> (texel * 2)) & 3;
+}
+
+/// Packs the interpolation weights of a texel as the 16-bit pair (64 - weight, weight).
+constexpr s32 WeightPair(u32 weight) {
+    return static_cast<s32>((weight << 16) | (64 - weight));
+}
+
+constexpr u32 ReverseBits(u32 value, u32 count) {
+    u32 result = 0;
+    for (u32 bit = 0; bit < count; ++bit) {
+        result = (result << 1) | ((value >> bit) & 1);
+    }
+    return result;
+}
+
+/**
+ * Reads sixteen indices of index_bits each starting at offset and returns their weights.
+ * Texels set in anchors have an implicit leading zero bit.
+ */
+template <u32 index_bits>
+std::array<u8, BLOCK_TEXELS> ReadWeights(const Block& block, u32 offset, u32 anchors) {
+    const auto& weights = []() -> const auto& {
+        if constexpr (index_bits == 2) {
+            return WEIGHTS2;
+        } else if constexpr (index_bits == 3) {
+            return WEIGHTS3;
+        } else {
+            return WEIGHTS4;
+        }
+    }();
+    std::array<u8, BLOCK_TEXELS> result;
+    for (u32 texel = 0; texel < BLOCK_TEXELS; ++texel) {
+        const u32 count = index_bits - ((anchors >> texel) & 1);
+        result[texel] = weights[block.Get(offset, count)];
+        offset += count;
+    }
+    return result;
+}
+
+struct Bc7Mode {
+    u32 num_subsets;
+    u32 partition_bits;
+    u32 rotation_bits;
+    u32 selection_bits;
+    u32 color_bits;
+    u32 alpha_bits;
+    u32 endpoint_pbits;
+    u32 shared_pbits;
+    u32 index_bits;
+    u32 index_bits2;
+};
+
+constexpr std::array<Bc7Mode, 8> BC7_MODES{{
+    {3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+    {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+    {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+    {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+    {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+    {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+    {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+    {2, 6, 0, 0, 5, 5, 1, 0, 2, 0},
+}};
+
+/// RGBA endpoints of up to three subsets, two per subset.
+using Bc7Endpoints = std::array<std::array<u32, 4>, 6>;
+
+/**
+ * Interpolates the texels of a BC7 block. The weights of the channel alpha_channel come from
+ * alpha_weights, the weights of the other channels from color_weights.
+ */
+void InterpolateBc7(const Bc7Endpoints& endpoints, u32 subsets,
+                    const std::array<u8, BLOCK_TEXELS>& color_weights,
+                    const std::array<u8, BLOCK_TEXELS>& alpha_weights, u32 alpha_channel, u8* dst,
+                    size_t pitch) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    // Endpoint pairs are interleaved per channel, so a single multiply-add with the weight pairs
+    // of a texel interpolates all of its channels
+    __m128i pairs[3];
+    for (u32 subset = 0; subset < 3; ++subset) {
+        const auto& e0 = endpoints[subset * 2];
+        const auto& e1 = endpoints[subset * 2 + 1];
+        pairs[subset] = _mm_setr_epi16(
+            static_cast<s16>(e0[0]), static_cast<s16>(e1[0]), static_cast<s16>(e0[1]),
+            static_cast<s16>(e1[1]), static_cast<s16>(e0[2]), static_cast<s16>(e1[2]),
+            static_cast<s16>(e0[3]), static_cast<s16>(e1[3]));
+    }
+    const __m128i alpha_mask = _mm_cmpeq_epi32(_mm_setr_epi32(0, 1, 2, 3),
+                                               _mm_set1_epi32(static_cast<s32>(alpha_channel)));
+    const __m128i round = _mm_set1_epi32(32);
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        __m128i texels[BLOCK_SIZE];
+        for (u32 x = 0; x < BLOCK_SIZE; ++x) {
+            const u32 texel = y * BLOCK_SIZE + x;
+            const __m128i color = _mm_set1_epi32(WeightPair(color_weights[texel]));
+            const __m128i alpha = _mm_set1_epi32(WeightPair(alpha_weights[texel]));
+            const __m128i weights =
+                _mm_or_si128(_mm_and_si128(alpha_mask, alpha), _mm_andnot_si128(alpha_mask, color));
+            const __m128i sum = _mm_madd_epi16(pairs[Subset(subsets, texel)], weights);
+            texels[x] = _mm_srli_epi32(_mm_add_epi32(sum, round), 6);
+        }
+        const __m128i row = _mm_packus_epi16(_mm_packs_epi32(texels[0], texels[1]),
+                                             _mm_packs_epi32(texels[2], texels[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + y * pitch), row);
+    }
+#else
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        for (u32 x = 0; x < BLOCK_SIZE; ++x) {
+            const u32 texel = y * BLOCK_SIZE + x;
+            const u32 subset = Subset(subsets, texel);
+            for (u32 channel = 0; channel < 4; ++channel) {
+                const u32 weight =
+                    channel == alpha_channel ? alpha_weights[texel] : color_weights[texel];
+                const u32 e0 = endpoints[subset * 2][channel];
+                const u32 e1 = endpoints[subset * 2 + 1][channel];
+                dst[y * pitch + x * 4 + channel] =
+                    static_cast<u8>(((64 - weight) * e0 + weight * e1 + 32) >> 6);
+            }
+        }
+    }
+#endif
+}
+
+template <u32 mode_index>
+void DecodeBc7Mode(const Block& block, u8* dst, size_t pitch) {
+    constexpr Bc7Mode mode = BC7_MODES[mode_index];
+    constexpr u32 num_endpoints = mode.num_subsets * 2;
+    u32 offset = mode_index + 1;
+    const auto read = [&block, &offset](u32 count) {
+        const u32 value = block.Get(offset, count);
+        offset += count;
+        return value;
+    };
+    const u32 partition = read(mode.partition_bits);
+    const u32 rotation = read(mode.rotation_bits);
+    const u32 selection = read(mode.selection_bits);
+
+    Bc7Endpoints endpoints{};
+    for (u32 channel = 0; channel < 3; ++channel) {
+        for (u32 endpoint = 0; endpoint < num_endpoints; ++endpoint) {
+            endpoints[endpoint][channel] = read(mode.color_bits);
+        }
+    }
+    for (u32 endpoint = 0; endpoint < num_endpoints; ++endpoint) {
+        endpoints[endpoint][3] = mode.alpha_bits > 0 ? read(mode.alpha_bits) : 0xFF;
+    }
+    if constexpr (mode.endpoint_pbits > 0) {
+        for (u32 endpoint = 0; endpoint < num_endpoints; ++endpoint) {
+            const u32 pbit = read(1);
+            auto& channels = endpoints[endpoint];
+            for (u32 channel = 0; channel < (mode.alpha_bits > 0 ? 4U : 3U); ++channel) {
+                channels[channel] = (channels[channel] << 1) | pbit;
+            }
+        }
+    }
+    if constexpr (mode.shared_pbits > 0) {
+        for (u32 subset = 0; subset < mode.num_subsets; ++subset) {
+            const u32 pbit = read(1);
+            for (u32 endpoint = subset * 2; endpoint < subset * 2 + 2; ++endpoint) {
+                for (u32 channel = 0; channel < 3; ++channel) {
+                    endpoints[endpoint][channel] = (endpoints[endpoint][channel] << 1) | pbit;
+                }
+            }
+        }
+    }
+
+    // Replicate the high bits of the endpoints into the low bits
+    constexpr u32 color_bits = mode.color_bits + mode.endpoint_pbits + mode.shared_pbits;
+    constexpr u32 alpha_bits = mode.alpha_bits + mode.endpoint_pbits + mode.shared_pbits;
+    for (u32 endpoint = 0; endpoint < num_endpoints; ++endpoint) {
+        for (u32 channel = 0; channel < (mode.alpha_bits > 0 ? 4U : 3U); ++channel) {
+            const u32 bits = channel < 3 ? color_bits : alpha_bits;
+            const u32 value = (endpoints[endpoint][channel] << (8 - bits)) & 0xFF;
+            endpoints[endpoint][channel] = value | (value >> bits);
+        }
+    }
+
+    // Rotations swap alpha with a color channel, swap their endpoints instead of the results
+    u32 alpha_channel = 3;
+    if (rotation != 0) {
+        alpha_channel = rotation - 1;
+        for (u32 endpoint = 0; endpoint < num_endpoints; ++endpoint) {
+            std::swap(endpoints[endpoint][alpha_channel], endpoints[endpoint][3]);
+        }
+    }
+
+    u32 subsets = 0;
+    u32 anchors = 1;
+    if constexpr (mode.num_subsets == 2) {
+        subsets = PARTITIONS2[partition];
+        anchors |= 1U << ANCHORS2[partition];
+    } else if constexpr (mode.num_subsets == 3) {
+        subsets = PARTITIONS3[partition];
+        anchors |= (1U << ANCHORS3_1[partition]) | (1U << ANCHORS3_2[partition]);
+    }
+    std::array<u8, BLOCK_TEXELS> color_weights =
+        ReadWeights<mode.index_bits>(block, offset, anchors);
+    std::array<u8, BLOCK_TEXELS> alpha_weights = color_weights;
+    if constexpr (mode.index_bits2 > 0) {
+        // The index selection bit picks whether color or alpha uses the secondary indices
+        const u32 secondary_offset = offset + BLOCK_TEXELS * mode.index_bits - mode.num_subsets;
+        const std::array<u8, BLOCK_TEXELS> secondary =
+            ReadWeights<mode.index_bits2>(block, secondary_offset, anchors);
+        if (selection != 0) {
+            color_weights = secondary;
+        } else {
+            alpha_weights = secondary;
+        }
+    }
+    InterpolateBc7(endpoints, subsets, color_weights, alpha_weights, alpha_channel, dst, pitch);
+}
+
+void DecodeBc7Invalid(const Block&, u8* dst, size_t pitch) {
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        std::memset(dst + y * pitch, 0, BLOCK_SIZE * 4);
+    }
+}
+
+using Bc7ModeFn = void (*)(const Block& block, u8* dst, size_t pitch);
+
+/// Decoders indexed by the number of trailing zeros of the first byte, eight being invalid.
+constexpr std::array<Bc7ModeFn, 9> BC7_MODE_DECODERS{
+    DecodeBc7Mode<0>, DecodeBc7Mode<1>, DecodeBc7Mode<2>, DecodeBc7Mode<3>, DecodeBc7Mode<4>,
+    DecodeBc7Mode<5>, DecodeBc7Mode<6>, DecodeBc7Mode<7>, DecodeBc7Invalid,
+};
+
+enum Bc6hTarget : u8 { EP0, EP1, EP2, EP3, PARTITION };
+enum Bc6hChannel : u8 { R, G, B, NONE };
+
+/// Bits read into a field, reversed when msb is lower than lsb.
+struct Bc6hBits {
+    Bc6hTarget target;
+    Bc6hChannel channel;
+    u8 msb;
+    u8 lsb;
+};
+
+struct Bc6hMode {
+    u32 mode_bits;
+    bool has_delta;
+    u32 num_partitions;
+    u32 endpoint_bits;
+    std::array<u32, 3> delta_bits;
+    u32 num_fields;
+    std::array<Bc6hBits, 24> fields;
+};
+
+// clang-format off
+/// Fields of each valid mode in the order they are stored, after the mode bits.
+constexpr std::array<Bc6hMode, 14> BC6H_MODES{{
+    // Mode 0
+    {2, true, 2, 10, {5, 5, 5}, 20, {{
+        {EP2, G, 4, 4}, {EP2, B, 4, 4}, {EP3, B, 4, 4}, {EP0, R, 9, 0}, {EP0, G, 9, 0},
+        {EP0, B, 9, 0}, {EP1, R, 4, 0}, {EP3, G, 4, 4}, {EP2, G, 3, 0}, {EP1, G, 4, 0},
+        {EP3, B, 0, 0}, {EP3, G, 3, 0}, {EP1, B, 4, 0}, {EP3, B, 1, 1}, {EP2, B, 3, 0},
+        {EP2, R, 4, 0}, {EP3, B, 2, 2}, {EP3, R, 4, 0}, {EP3, B, 3, 3}, {PARTITION, NONE, 4, 0}
+    }}},
+    // Mode 1
+    {2, true, 2, 7, {6, 6, 6}, 22, {{
+        {EP2, G, 5, 5}, {EP3, G, 5, 4}, {EP0, R, 6, 0}, {EP3, B, 1, 0}, {EP2, B, 4, 4},
+        {EP0, G, 6, 0}, {EP2, B, 5, 5}, {EP3, B, 2, 2}, {EP2, G, 4, 4}, {EP0, B, 6, 0},
+        {EP3, B, 3, 3}, {EP3, B, 5, 5}, {EP3, B, 4, 4}, {EP1, R, 5, 0}, {EP2, G, 3, 0},
+        {EP1, G, 5, 0}, {EP3, G, 3, 0}, {EP1, B, 5, 0}, {EP2, B, 3, 0}, {EP2, R, 5, 0},
+        {EP3, R, 5, 0}, {PARTITION, NONE, 4, 0}
+    }}},
+    // Mode 2
+    {5, true, 2, 11, {5, 4, 4}, 19, {{
+        {EP0, R, 9, 0}, {EP0, G, 9, 0}, {EP0, B, 9, 0}, {EP1, R, 4, 0}, {EP0, R, 10, 10},
+        {EP2, G, 3, 0}, {EP1, G, 3, 0}, {EP0, G, 10, 10}, {EP3, B, 0, 0}, {EP3, G, 3, 0},
+        {EP1, B, 3, 0}, {EP0, B, 10, 10}, {EP3, B, 1, 1}, {EP2, B, 3, 0}, {EP2, R, 4, 0},
+        {EP3, B, 2, 2}, {EP3, R, 4, 0}, {EP3, B, 3, 3}, {PARTITION, NONE, 4, 0}
+    }}},
+    // Mode 3
+    {5, false, 1, 10, {0, 0, 0}, 6, {{
+        {EP0, R, 9, 0}, {EP0, G, 9, 0}, {EP0, B, 9, 0}, {EP1, R, 9, 0}, {EP1, G, 9, 0},
+        {EP1, B, 9, 0}
+    }}},
+    // Mode 6
+    {5, true, 2, 11, {4, 5, 4}, 21, {{
+        {EP0, R, 9, 0}, {EP0, G, 9, 0}, {EP0, B, 9, 0}, {EP1, R, 3, 0}, {EP0, R, 10, 10},
+        {EP3, G, 4, 4}, {EP2, G, 3, 0}, {EP1, G, 4, 0}, {EP0, G, 10, 10}, {EP3, G, 3, 0},
+        {EP1, B, 3, 0}, {EP0, B, 10, 10}, {EP3, B, 1, 1}, {EP2, B, 3, 0}, {EP2, R, 3, 0},
+        {EP3, B, 0, 0}, {EP3, B, 2, 2}, {EP3, R, 3, 0}, {EP2, G, 4, 4}, {EP3, B, 3, 3},
+        {PARTITION, NONE, 4, 0}
+    }}},
+    // Mode 7
+    {5, true, 1, 11, {9, 9, 9}, 9, {{
+        {EP0, R, 9, 0}, {EP0, G, 9, 0}, {EP0, B, 9, 0}, {EP1, R, 8, 0}, {EP0, R, 10, 10},
+        {EP1, G, 8, 0}, {EP0, G, 10, 10}, {EP1, B, 8, 0}, {EP0, B, 10, 10}
+    }}},
+    // Mode 10
+    {5, true, 2, 11, {4, 4, 5}, 21, {{
+        {EP0, R, 9, 0}, {EP0, G, 9, 0}, {EP0, B, 9, 0}, {EP1, R, 3, 0}, {EP0, R, 10, 10},
+        {EP2, B, 4, 4}, {EP2, G, 3, 0}, {EP1, G, 3, 0}, {EP0, G, 10, 10}, {EP3, B, 0, 0},
+        {EP3, G, 3, 0}, {EP1, B, 4, 0}, {EP0, B, 10, 10}, {EP2, B, 3, 0}, {EP2, R, 3, 0},
+        {EP3, B, 1, 1}, {EP3, B, 2, 2}, {EP3, R, 3, 0}, {EP3, B, 4, 4}, {EP3, B, 3, 3},
+        {PARTITION, NONE, 4, 0}
+    }}},
+    // Mode 11
+    {5, true, 1, 12, {8, 8, 8}, 9, {{
+        {EP0, R, 9, 0}, {EP0, G, 9, 0}, {EP0, B, 9, 0}, {EP1, R, 7, 0}, {EP0, R, 10, 11},
+        {EP1, G, 7, 0}, {EP0, G, 10, 11}, {EP1, B, 7, 0}, {EP0, B, 10, 11}
+    }}},
+    // Mode 14
+    {5, true, 2, 9, {5, 5, 5}, 20, {{
+        {EP0, R, 8, 0}, {EP2, B, 4, 4}, {EP0, G, 8, 0}, {EP2, G, 4, 4}, {EP0, B, 8, 0},
+        {EP3, B, 4, 4}, {EP1, R, 4, 0}, {EP3, G, 4, 4}, {EP2, G, 3, 0}, {EP1, G, 4, 0},
+        {EP3, B, 0, 0}, {EP3, G, 3, 0}, {EP1, B, 4, 0}, {EP3, B, 1, 1}, {EP2, B, 3, 0},
+        {EP2, R, 4, 0}, {EP3, B, 2, 2}, {EP3, R, 4, 0}, {EP3, B, 3, 3}, {PARTITION, NONE, 4, 0}
+    }}},
+    // Mode 15
+    {5, true, 1, 16, {4, 4, 4}, 9, {{
+        {EP0, R, 9, 0}, {EP0, G, 9, 0}, {EP0, B, 9, 0}, {EP1, R, 3, 0}, {EP0, R, 10, 15},
+        {EP1, G, 3, 0}, {EP0, G, 10, 15}, {EP1, B, 3, 0}, {EP0, B, 10, 15}
+    }}},
+    // Mode 18
+    {5, true, 2, 8, {6, 5, 5}, 20, {{
+        {EP0, R, 7, 0}, {EP3, G, 4, 4}, {EP2, B, 4, 4}, {EP0, G, 7, 0}, {EP3, B, 2, 2},
+        {EP2, G, 4, 4}, {EP0, B, 7, 0}, {EP3, B, 3, 3}, {EP3, B, 4, 4}, {EP1, R, 5, 0},
+        {EP2, G, 3, 0}, {EP1, G, 4, 0}, {EP3, B, 0, 0}, {EP3, G, 3, 0}, {EP1, B, 4, 0},
+        {EP3, B, 1, 1}, {EP2, B, 3, 0}, {EP2, R, 5, 0}, {EP3, R, 5, 0}, {PARTITION, NONE, 4, 0}
+    }}},
+    // Mode 22
+    {5, true, 2, 8, {5, 6, 5}, 22, {{
+        {EP0, R, 7, 0}, {EP3, B, 0, 0}, {EP2, B, 4, 4}, {EP0, G, 7, 0}, {EP2, G, 5, 5},
+        {EP2, G, 4, 4}, {EP0, B, 7, 0}, {EP3, G, 5, 5}, {EP3, B, 4, 4}, {EP1, R, 4, 0},
+        {EP3, G, 4, 4}, {EP2, G, 3, 0}, {EP1, G, 5, 0}, {EP3, G, 3, 0}, {EP1, B, 4, 0},
+        {EP3, B, 1, 1}, {EP2, B, 3, 0}, {EP2, R, 4, 0}, {EP3, B, 2, 2}, {EP3, R, 4, 0},
+        {EP3, B, 3, 3}, {PARTITION, NONE, 4, 0}
+    }}},
+    // Mode 26
+    {5, true, 2, 8, {5, 5, 6}, 22, {{
+        {EP0, R, 7, 0}, {EP3, B, 1, 1}, {EP2, B, 4, 4}, {EP0, G, 7, 0}, {EP2, B, 5, 5},
+        {EP2, G, 4, 4}, {EP0, B, 7, 0}, {EP3, B, 5, 5}, {EP3, B, 4, 4}, {EP1, R, 4, 0},
+        {EP3, G, 4, 4}, {EP2, G, 3, 0}, {EP1, G, 4, 0}, {EP3, B, 0, 0}, {EP3, G, 3, 0},
+        {EP1, B, 5, 0}, {EP2, B, 3, 0}, {EP2, R, 4, 0}, {EP3, B, 2, 2}, {EP3, R, 4, 0},
+        {EP3, B, 3, 3}, {PARTITION, NONE, 4, 0}
+    }}},
+    // Mode 30
+    {5, false, 2, 6, {0, 0, 0}, 24, {{
+        {EP0, R, 5, 0}, {EP3, G, 4, 4}, {EP3, B, 0, 0}, {EP3, B, 1, 1}, {EP2, B, 4, 4},
+        {EP0, G, 5, 0}, {EP2, G, 5, 5}, {EP2, B, 5, 5}, {EP3, B, 2, 2}, {EP2, G, 4, 4},
+        {EP0, B, 5, 0}, {EP3, G, 5, 5}, {EP3, B, 3, 3}, {EP3, B, 5, 5}, {EP3, B, 4, 4},
+        {EP1, R, 5, 0}, {EP2, G, 3, 0}, {EP1, G, 5, 0}, {EP3, G, 3, 0}, {EP1, B, 5, 0},
+        {EP2, B, 3, 0}, {EP2, R, 5, 0}, {EP3, R, 5, 0}, {PARTITION, NONE, 4, 0}
+    }}},
+}};
+// clang-format on
+
+/// Index into BC6H_MODES of each value of the five mode bits, invalid modes map past the end.
+constexpr auto BC6H_MODE_INDICES = [] {
+    std::array<u8, 32> indices{};
+    for (u32 value = 0; value < indices.size(); ++value) {
+        // Modes with the second bit clear only use two bits
+        const u32 mode = (value & 2) != 0 ? value : value & 3;
+        if (mode <= 3) {
+            indices[value] = static_cast<u8>(mode);
+        } else if ((mode & 2) != 0 && mode <= 18) {
+            indices[value] = static_cast<u8>(mode / 2 + 1 + (mode & 1));
+        } else if (mode == 22 || mode == 26 || mode == 30) {
+            indices[value] = static_cast<u8>(mode / 4 + 6);
+        } else {
+            indices[value] = static_cast<u8>(BC6H_MODES.size());
+        }
+    }
+    return indices;
+}();
+
+constexpr u16 HALF_ONE = 0x3C00;
+
+/// Sign extends the low size bits of value to sixteen bits.
+constexpr u16 ExtendSign(u32 value, u32 size) {
+    const u32 mask = 1U << (size - 1);
+    return static_cast<u16>((value ^ mask) - mask);
+}
+
+template <bool is_signed>
+constexpr u16 Unquantize(u16 value, u32 size) {
+    if constexpr (is_signed) {
+        if (size >= 16 || value == 0) {
+            return value;
+        }
+        const s32 signed_value = static_cast<s16>(value);
+        const s32 magnitude = signed_value < 0 ? -signed_value : signed_value;
+        s32 result;
+        if (magnitude >= (1 << (size - 1)) - 1) {
+            result = 0x7FFF;
+        } else {
+            result = ((magnitude << 15) + 0x4000) >> (size - 1);
+        }
+        return static_cast<u16>(signed_value < 0 ? -result : result);
+    } else {
+        if (size >= 15 || value == 0) {
+            return value;
+        }
+        if (value == (1U << size) - 1) {
+            return 0xFFFF;
+        }
+        return static_cast<u16>(((u32{value} << 16) + 0x8000) >> size);
+    }
+}
+
+/// RGB endpoints of up to two partitions, two per partition.
+using Bc6hEndpoints = std::array<std::array<u16, 3>, 4>;
+
+/// Interpolates the texels of a BC6H block and scales them into the range of half floats.
+template <bool is_signed>
+void InterpolateBc6h(const Bc6hEndpoints& endpoints, u32 partitions,
+                     const std::array<u8, BLOCK_TEXELS>& weights, u8* dst, size_t pitch) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    // Unsigned endpoints are biased into the signed range of the multiply-add, and the bias is
+    // added back to the sums
+    constexpr u16 bias = is_signed ? 0 : 0x8000;
+    __m128i pairs[2];
+    for (u32 partition = 0; partition < 2; ++partition) {
+        const auto& e0 = endpoints[partition * 2];
+        const auto& e1 = endpoints[partition * 2 + 1];
+        pairs[partition] = _mm_setr_epi16(
+            static_cast<s16>(e0[0] ^ bias), static_cast<s16>(e1[0] ^ bias),
+            static_cast<s16>(e0[1] ^ bias), static_cast<s16>(e1[1] ^ bias),
+            static_cast<s16>(e0[2] ^ bias), static_cast<s16>(e1[2] ^ bias), 0, 0);
+    }
+    const __m128i round = _mm_set1_epi32(is_signed ? 32 : 32 + 0x8000 * 64);
+    const __m128i color_mask = _mm_setr_epi32(-1, -1, -1, 0);
+    const __m128i alpha = _mm_setr_epi32(0, 0, 0, HALF_ONE);
+    const __m128i pack_bias = _mm_set1_epi32(0x8000);
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        __m128i texels[BLOCK_SIZE];
+        for (u32 x = 0; x < BLOCK_SIZE; ++x) {
+            const u32 texel = y * BLOCK_SIZE + x;
+            const __m128i weight_pair = _mm_set1_epi32(WeightPair(weights[texel]));
+            const __m128i sum = _mm_madd_epi16(pairs[Subset(partitions, texel)], weight_pair);
+            const __m128i value = _mm_srai_epi32(_mm_add_epi32(sum, round), 6);
+            __m128i scaled;
+            if constexpr (is_signed) {
+                // Scale the magnitude by 31/32 and keep the sign bit, except on zero
+                const __m128i sign = _mm_srai_epi32(value, 31);
+                const __m128i magnitude = _mm_sub_epi32(_mm_xor_si128(value, sign), sign);
+                scaled = _mm_srli_epi32(_mm_sub_epi32(_mm_slli_epi32(magnitude, 5), magnitude), 5);
+                const __m128i is_zero = _mm_cmpeq_epi32(scaled, _mm_setzero_si128());
+                scaled = _mm_or_si128(
+                    scaled, _mm_andnot_si128(is_zero, _mm_and_si128(sign, pack_bias)));
+            } else {
+                scaled = _mm_srli_epi32(_mm_sub_epi32(_mm_slli_epi32(value, 5), value), 6);
+            }
+            // Bias the values so signed saturation packs them unchanged
+            texels[x] = _mm_sub_epi32(_mm_or_si128(_mm_and_si128(scaled, color_mask), alpha),
+                                      pack_bias);
+        }
+        const __m128i flip = _mm_set1_epi16(static_cast<s16>(0x8000));
+        const __m128i left = _mm_xor_si128(_mm_packs_epi32(texels[0], texels[1]), flip);
+        const __m128i right = _mm_xor_si128(_mm_packs_epi32(texels[2], texels[3]), flip);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + y * pitch), left);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + y * pitch + 16), right);
+    }
+#else
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        for (u32 x = 0; x < BLOCK_SIZE; ++x) {
+            const u32 texel = y * BLOCK_SIZE + x;
+            const u32 partition = Subset(partitions, texel);
+            const s32 weight = weights[texel];
+            std::array<u16, 4> color;
+            for (u32 channel = 0; channel < 3; ++channel) {
+                s32 e0 = endpoints[partition * 2][channel];
+                s32 e1 = endpoints[partition * 2 + 1][channel];
+                if constexpr (is_signed) {
+                    e0 = static_cast<s16>(e0);
+                    e1 = static_cast<s16>(e1);
+                }
+                const s32 value = (e0 * (64 - weight) + e1 * weight + 32) >> 6;
+                if constexpr (is_signed) {
+                    const u32 scaled = static_cast<u32>(value < 0 ? -value : value) * 31 >> 5;
+                    color[channel] = static_cast<u16>(value < 0 && scaled != 0 ? scaled | 0x8000
+                                                                               : scaled);
+                } else {
+                    color[channel] = static_cast<u16>(static_cast<u32>(value) * 31 >> 6);
+                }
+            }
+            color[3] = HALF_ONE;
+            std::memcpy(dst + y * pitch + x * sizeof(color), color.data(), sizeof(color));
+        }
+    }
+#endif
+}
+
+template <size_t mode_index, bool is_signed>
+void DecodeBc6hMode(const Block& block, u8* dst, size_t pitch) {
+    constexpr Bc6hMode mode = BC6H_MODES[mode_index];
+    constexpr u32 num_endpoints = mode.num_partitions * 2;
+    u32 offset = mode.mode_bits;
+    u32 partition = 0;
+    Bc6hEndpoints endpoints{};
+    for (u32 field = 0; field < mode.num_fields; ++field) {
+        const Bc6hBits& bits = mode.fields[field];
+        const u32 lsb = (std::min)(bits.msb, bits.lsb);
+        const u32 count = (std::max)(bits.msb, bits.lsb) - lsb + 1;
+        u32 value = block.Get(offset, count);
+        offset += count;
+        if (bits.msb < bits.lsb) {
+            value = ReverseBits(value, count);
+        }
+        if (bits.target == PARTITION) {
+            partition |= value << lsb;
+        } else {
+            endpoints[bits.target][bits.channel] |= static_cast<u16>(value << lsb);
+        }
+    }
+
+    // Deltas are signed even on unsigned formats, the base endpoint only on signed formats
+    const auto endpoint_bits = [&mode](u32 endpoint, u32 channel) {
+        return endpoint == 0 || !mode.has_delta ? mode.endpoint_bits : mode.delta_bits[channel];
+    };
+    if constexpr (is_signed || mode.has_delta) {
+        for (u32 endpoint = is_signed ? 0 : 1; endpoint < num_endpoints; ++endpoint) {
+            for (u32 channel = 0; channel < 3; ++channel) {
+                endpoints[endpoint][channel] =
+                    ExtendSign(endpoints[endpoint][channel], endpoint_bits(endpoint, channel));
+            }
+        }
+    }
+    if constexpr (mode.has_delta) {
+        constexpr u32 mask = (1U << mode.endpoint_bits) - 1;
+        for (u32 endpoint = 1; endpoint < num_endpoints; ++endpoint) {
+            for (u32 channel = 0; channel < 3; ++channel) {
+                u16& value = endpoints[endpoint][channel];
+                value = static_cast<u16>((endpoints[0][channel] + value) & mask);
+                if constexpr (is_signed) {
+                    value = ExtendSign(value, mode.endpoint_bits);
+                }
+            }
+        }
+    }
+    for (u32 endpoint = 0; endpoint < num_endpoints; ++endpoint) {
+        for (u16& value : endpoints[endpoint]) {
+            value = Unquantize<is_signed>(value, mode.endpoint_bits);
+        }
+    }
+
+    u32 partitions = 0;
+    std::array<u8, BLOCK_TEXELS> weights;
+    if constexpr (mode.num_partitions == 1) {
+        weights = ReadWeights<4>(block, offset, 1);
+    } else {
+        partitions = PARTITIONS2[partition];
+        weights = ReadWeights<3>(block, offset, 1 | (1U << ANCHORS2[partition]));
+    }
+    InterpolateBc6h<is_signed>(endpoints, partitions, weights, dst, pitch);
+}
+
+void DecodeBc6hInvalid(const Block&, u8* dst, size_t pitch) {
+    constexpr std::array<u16, 4> texel{0, 0, 0, HALF_ONE};
+    for (u32 y = 0; y < BLOCK_SIZE; ++y) {
+        for (u32 x = 0; x < BLOCK_SIZE; ++x) {
+            std::memcpy(dst + y * pitch + x * sizeof(texel), texel.data(), sizeof(texel));
+        }
+    }
+}
+
+using Bc6hModeFn = void (*)(const Block& block, u8* dst, size_t pitch);
+
+template <bool is_signed, size_t... indices>
+constexpr std::array<Bc6hModeFn, sizeof...(indices) + 1> MakeBc6hDecoders(
+    std::index_sequence<indices...>) {
+    return {DecodeBc6hMode<indices, is_signed>..., DecodeBc6hInvalid};
+}
+
+/// Decoders indexed by BC6H_MODE_INDICES.
+template <bool is_signed>
+constexpr auto BC6H_MODE_DECODERS =
+    MakeBc6hDecoders<is_signed>(std::make_index_sequence<BC6H_MODES.size()>{});
+
+template <bool is_signed>
+void DecodeBc6hBlock(const u8* src, u8* dst, size_t pitch) {
+    const Block block = LoadBlock(src);
+    BC6H_MODE_DECODERS<is_signed>[BC6H_MODE_INDICES[block.low & 0x1F]](block, dst, pitch);
+}
+} // Anonymous namespace
+
+void DecodeBc6hUfloatBlock(const u8* src, u8* dst, size_t pitch) {
+    DecodeBc6hBlock<false>(src, dst, pitch);
+}
+
+void DecodeBc6hSfloatBlock(const u8* src, u8* dst, size_t pitch) {
+    DecodeBc6hBlock<true>(src, dst, pitch);
+}
+
+void DecodeBc7Block(const u8* src, u8* dst, size_t pitch) {
+    const Block block = LoadBlock(src);
+    BC7_MODE_DECODERS[std::countr_zero(static_cast<u8>(block.low))](block, dst, pitch);
+}
+
+} // namespace VideoCommon
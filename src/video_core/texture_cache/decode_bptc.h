@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/// Decodes a whole BC6H block with unsigned endpoints to RGBA16F texels, writing rows pitch
+/// bytes apart.
+void DecodeBc6hUfloatBlock(const u8* src, u8* dst, size_t pitch);
+
+/// Decodes a whole BC6H block with signed endpoints to RGBA16F texels, see above.
+void DecodeBc6hSfloatBlock(const u8* src, u8* dst, size_t pitch);
+
+/// Decodes a whole BC7 block to RGBA8 texels, writing rows pitch bytes apart.
+void DecodeBc7Block(const u8* src, u8* dst, size_t pitch);
+
+} // namespace VideoCommon
@@ -1,13 +1,20 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include <algorithm>
+#include <optional>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/memory_manager.h"
 #include "video_core/rasterizer_interface.h"
 
@@ -26,10 +33,15 @@ public:
 
     void Invalidate() noexcept {
         std::ranges::fill(read_descriptors, 0);
+        std::ranges::fill(clean_descriptors, 0);
     }
 
     [[nodiscard]] std::pair<Descriptor, bool> Read(u32 index) {
         DEBUG_ASSERT(index <= current_limit);
+        if (IsDescriptorClean(index)) {
+            // Tracked and nothing wrote to it since it was last read
+            return {descriptors[index], false};
+        }
         const GPUVAddr gpu_addr = current_gpu_addr + index * sizeof(Descriptor);
         std::pair<Descriptor, bool> result;
         gpu_memory.ReadBlockUnsafe(gpu_addr, &result.first, sizeof(Descriptor));
@@ -42,6 +54,9 @@ public:
         if (result.second) {
             descriptors[index] = result.first;
         }
+        if (is_tracked) {
+            MarkDescriptorAsClean(index);
+        }
         return result;
     }
 
@@ -49,17 +64,144 @@ public:
         return current_limit;
     }
 
+    /// Returns true when writes to the memory of the table are being watched
+    [[nodiscard]] bool IsTracked() const noexcept {
+        return is_tracked;
+    }
+
+    /// Returns true when Read can return a descriptor without reading it from memory
+    [[nodiscard]] bool IsDescriptorClean(u32 index) const noexcept {
+        return is_tracked && (clean_descriptors[index / 64] & (1ULL << (index % 64))) != 0;
+    }
+
+    /**
+     * Watches writes to the memory of the table, letting Read skip descriptors that were not
+     * written. Tables written too often between two calls are only watched again later, as every
+     * CPU write to watched memory takes the slow path.
+     */
+    void UpdateTracking(Tegra::MaxwellDeviceMemoryManager& device_memory_) {
+        if (TableSize() > MAX_TRACKED_SIZE) {
+            return;
+        }
+        if (is_tracked) {
+            ++num_tracked_syncs;
+            if (num_writes > MAX_WRITES_PER_SYNC) {
+                Untrack();
+                retrack_delay = backoff;
+                backoff = num_tracked_syncs < backoff ? (std::min)(backoff * 2, MAX_BACKOFF)
+                                                      : MIN_BACKOFF;
+            }
+            num_writes = 0;
+            return;
+        }
+        if (retrack_delay > 0) {
+            --retrack_delay;
+            return;
+        }
+        Track(device_memory_);
+    }
+
+    /// Marks the descriptors overlapping memory written by the CPU or the GPU as dirty
+    void OnWrite(DAddr addr, size_t size) noexcept {
+        for (const TrackedRange& range : tracked_ranges) {
+            if (addr >= range.cpu_addr + range.size || addr + size <= range.cpu_addr) {
+                continue;
+            }
+            const size_t begin = range.table_offset + (std::max)(addr, range.cpu_addr) -
+                                 range.cpu_addr;
+            const size_t end = range.table_offset +
+                               (std::min)(addr + size, range.cpu_addr + range.size) -
+                               range.cpu_addr;
+            for (size_t index = begin / sizeof(Descriptor);
+                 index < Common::DivCeil(end, sizeof(Descriptor)); ++index) {
+                MarkDescriptorAsDirty(index);
+            }
+            ++num_writes;
+        }
+    }
+
+    /// Stops watching memory that is being unmapped
+    void OnUnmap(DAddr addr, size_t size) {
+        const bool overlaps = std::ranges::any_of(tracked_ranges, [addr, size](const auto& range) {
+            return addr < range.cpu_addr + range.size && range.cpu_addr < addr + size;
+        });
+        if (overlaps) {
+            Untrack();
+        }
+    }
+
+    /// Stops watching the memory of the table if its GPU mappings change, including remaps
+    void OnUnmapGPU(GPUVAddr gpu_addr, size_t size) {
+        if (is_tracked && gpu_addr < current_gpu_addr + TableSize() &&
+            current_gpu_addr < gpu_addr + size) {
+            Untrack();
+        }
+    }
+
+    /// Reads every descriptor again on its next use, in case it was written by a path that does
+    /// not notify the caches
+    void Revalidate() noexcept {
+        std::ranges::fill(clean_descriptors, 0);
+    }
+
+    void Untrack() {
+        for (const TrackedRange& range : tracked_ranges) {
+            device_memory->UpdatePagesCachedCount(range.cpu_addr, range.size, -1);
+        }
+        tracked_ranges.clear();
+        is_tracked = false;
+        Revalidate();
+    }
+
 private:
+    static constexpr size_t MAX_TRACKED_SIZE = 1ULL << 20;
+    static constexpr u32 MAX_WRITES_PER_SYNC = 64;
+    static constexpr u32 MIN_BACKOFF = 16;
+    static constexpr u32 MAX_BACKOFF = 4096;
+
+    struct TrackedRange {
+        DAddr cpu_addr;
+        size_t size;
+        size_t table_offset;
+    };
+
     void Refresh(GPUVAddr gpu_addr, u32 limit) {
+        Untrack();
         current_gpu_addr = gpu_addr;
         current_limit = limit;
 
         const size_t num_descriptors = static_cast<size_t>(limit) + 1;
         read_descriptors.clear();
         read_descriptors.resize(Common::DivCeil(num_descriptors, 64U), 0);
+        clean_descriptors.clear();
+        clean_descriptors.resize(Common::DivCeil(num_descriptors, 64U), 0);
         descriptors.resize(num_descriptors);
     }
 
+    void Track(Tegra::MaxwellDeviceMemoryManager& device_memory_) {
+        device_memory = &device_memory_;
+        for (const auto& [gpu_addr, size] :
+             gpu_memory.GetSubmappedRange(current_gpu_addr, TableSize())) {
+            const std::optional<DAddr> cpu_addr = gpu_memory.GpuToCpuAddress(gpu_addr);
+            if (!cpu_addr) {
+                continue;
+            }
+            device_memory->UpdatePagesCachedCount(*cpu_addr, size, 1);
+            tracked_ranges.push_back({
+                .cpu_addr = *cpu_addr,
+                .size = size,
+                .table_offset = gpu_addr - current_gpu_addr,
+            });
+        }
+        is_tracked = true;
+        num_tracked_syncs = 0;
+        num_writes = 0;
+    }
+
+    [[nodiscard]] size_t TableSize() const noexcept {
+        return (static_cast<size_t>(current_limit) + 1) * sizeof(Descriptor);
+    }
+
     void MarkDescriptorAsRead(u32 index) noexcept {
         read_descriptors[index / 64] |= 1ULL << (index % 64);
     }
@@ -68,11 +210,29 @@ private:
         return (read_descriptors[index / 64] & (1ULL << (index % 64))) != 0;
     }
 
+    void MarkDescriptorAsClean(u32 index) noexcept {
+        clean_descriptors[index / 64] |= 1ULL << (index % 64);
+    }
+
+    void MarkDescriptorAsDirty(size_t index) noexcept {
+        clean_descriptors[index / 64] &= ~(1ULL << (index % 64));
+    }
+
     Tegra::MemoryManager& gpu_memory;
+    Tegra::MaxwellDeviceMemoryManager* device_memory{};
     GPUVAddr current_gpu_addr{};
     u32 current_limit{};
     std::vector<u64> read_descriptors;
+    /// Descriptors read while tracked and not written since
+    std::vector<u64> clean_descriptors;
     std::vector<Descriptor> descriptors;
+
+    boost::container::small_vector<TrackedRange, 4> tracked_ranges;
+    bool is_tracked{};
+    u32 num_writes{};
+    u32 num_tracked_syncs{};
+    u32 retrack_delay{};
+    u32 backoff{MIN_BACKOFF};
 };
 
 } // namespace VideoCommon
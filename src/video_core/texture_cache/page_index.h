@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/**
+ * Radix index from page numbers to the ids of the objects overlapping them.
+ *
+ * Pages are grouped in leaves allocated on first use and freed when emptied, so lookups are two
+ * array indexings instead of a hash, and range walks skip unused leaves at once. Ids within a page
+ * keep their insertion order, which makes iteration deterministic.
+ */
+template <typename Id, size_t NumInlineIds = 4>
+class PageIndex {
+public:
+    using IdSet = boost::container::small_vector<Id, NumInlineIds>;
+
+    /// Adds id to the ids of page
+    void Insert(u64 page, Id id) {
+        Leaf& leaf = GetOrCreateLeaf(page);
+        IdSet& ids = leaf.pages[page & LEAF_MASK];
+        if (ids.empty()) {
+            ++leaf.num_used_pages;
+        }
+        ids.push_back(id);
+    }
+
+    /// Removes the ids of page matching pred, returns the number of removed ids
+    template <typename Pred>
+    size_t EraseIf(u64 page, Pred&& pred) {
+        Leaf* const leaf = FindLeaf(page);
+        if (!leaf) {
+            return 0;
+        }
+        IdSet& ids = leaf->pages[page & LEAF_MASK];
+        const size_t num_ids = ids.size();
+        ids.erase(std::remove_if(ids.begin(), ids.end(), pred), ids.end());
+        if (num_ids != 0 && ids.empty()) {
+            ReleasePage(page, *leaf);
+        }
+        return num_ids - ids.size();
+    }
+
+    /// Removes the first occurrence of id from page, returns true when it was found
+    bool Erase(u64 page, Id id) {
+        Leaf* const leaf = FindLeaf(page);
+        if (!leaf) {
+            return false;
+        }
+        IdSet& ids = leaf->pages[page & LEAF_MASK];
+        const auto it = std::find(ids.begin(), ids.end(), id);
+        if (it == ids.end()) {
+            return false;
+        }
+        ids.erase(it);
+        if (ids.empty()) {
+            ReleasePage(page, *leaf);
+        }
+        return true;
+    }
+
+    /// Returns the ids of page, or nullptr when it has none
+    [[nodiscard]] const IdSet* Find(u64 page) const {
+        const Leaf* const leaf = FindLeaf(page);
+        if (!leaf) {
+            return nullptr;
+        }
+        const IdSet& ids = leaf->pages[page & LEAF_MASK];
+        return ids.empty() ? nullptr : &ids;
+    }
+
+    /// Calls func(page, ids) for every page in [first_page, last_page] with ids, in page order
+    template <typename Func>
+    void ForEachInRange(u64 first_page, u64 last_page, Func&& func) const {
+        u64 page = first_page;
+        while (page <= last_page) {
+            const auto [leaf_index, leaf] = FindNextLeaf(page >> LEAF_BITS);
+            if (!leaf || leaf_index > (last_page >> LEAF_BITS)) {
+                return;
+            }
+            page = (std::max)(page, leaf_index << LEAF_BITS);
+            const u64 leaf_end = (std::min)(last_page, (leaf_index << LEAF_BITS) | LEAF_MASK);
+            for (; page <= leaf_end; ++page) {
+                const IdSet& ids = leaf->pages[page & LEAF_MASK];
+                if (ids.empty()) {
+                    continue;
+                }
+                func(page, ids);
+            }
+            if (leaf_end == ~u64{0}) {
+                return;
+            }
+        }
+    }
+
+    /// Removes every id
+    void Clear() {
+        leaves.clear();
+        sparse_leaves.clear();
+    }
+
+private:
+    static constexpr u64 LEAF_BITS = 10;
+    static constexpr u64 LEAF_SIZE = u64{1} << LEAF_BITS;
+    static constexpr u64 LEAF_MASK = LEAF_SIZE - 1;
+    static constexpr u64 MAX_LEAVES = u64{1} << 14;
+
+    struct Leaf {
+        std::array<IdSet, LEAF_SIZE> pages;
+        u32 num_used_pages{};
+    };
+
+    [[nodiscard]] Leaf* FindLeaf(u64 page) const {
+        const u64 leaf_index = page >> LEAF_BITS;
+        if (leaf_index < MAX_LEAVES) {
+            return leaf_index < leaves.size() ? leaves[leaf_index].get() : nullptr;
+        }
+        const auto it = FindSparseLeaf(leaf_index);
+        return it != sparse_leaves.end() && it->first == leaf_index ? it->second.get() : nullptr;
+    }
+
+    /// Returns the first allocated leaf at or after leaf_index
+    [[nodiscard]] std::pair<u64, const Leaf*> FindNextLeaf(u64 leaf_index) const {
+        for (; leaf_index < leaves.size(); ++leaf_index) {
+            if (leaves[leaf_index]) {
+                return {leaf_index, leaves[leaf_index].get()};
+            }
+        }
+        const auto it = FindSparseLeaf(leaf_index);
+        if (it == sparse_leaves.end()) {
+            return {0, nullptr};
+        }
+        return {it->first, it->second.get()};
+    }
+
+    [[nodiscard]] auto FindSparseLeaf(u64 leaf_index) const {
+        return std::ranges::lower_bound(sparse_leaves, leaf_index, {},
+                                        [](const auto& pair) { return pair.first; });
+    }
+
+    Leaf& GetOrCreateLeaf(u64 page) {
+        const u64 leaf_index = page >> LEAF_BITS;
+        if (leaf_index < MAX_LEAVES) {
+            if (leaf_index >= leaves.size()) {
+                leaves.resize(leaf_index + 1);
+            }
+            std::unique_ptr<Leaf>& leaf = leaves[leaf_index];
+            if (!leaf) {
+                leaf = std::make_unique<Leaf>();
+            }
+            return *leaf;
+        }
+        auto it = FindSparseLeaf(leaf_index);
+        if (it == sparse_leaves.end() || it->first != leaf_index) {
+            it = sparse_leaves.emplace(it, leaf_index, std::make_unique<Leaf>());
+        }
+        return *it->second;
+    }
+
+    void ReleasePage(u64 page, Leaf& leaf) {
+        // Give back the memory of ids that spilled out of the inline storage
+        leaf.pages[page & LEAF_MASK].shrink_to_fit();
+        if (--leaf.num_used_pages != 0) {
+            return;
+        }
+        const u64 leaf_index = page >> LEAF_BITS;
+        if (leaf_index < MAX_LEAVES) {
+            leaves[leaf_index].reset();
+        } else {
+            sparse_leaves.erase(FindSparseLeaf(leaf_index));
+        }
+    }
+
+    /// Leaves covering the first 2^44 bytes of addresses with pages of 1 MiB
+    std::vector<std::unique_ptr<Leaf>> leaves;
+    /// Leaves past them, like the fake addresses given to unmapped images, sorted by index
+    std::vector<std::pair<u64, std::unique_ptr<Leaf>>> sparse_leaves;
+};
+
+} // namespace VideoCommon
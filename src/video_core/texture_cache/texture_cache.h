@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: 2023 yuzu Emulator Project
@@ -159,6 +159,8 @@ void TextureCache<P>::TickFrame() {
     sentenced_image_view.Tick();
     TickAsyncDecode();
 
+    ForEachDescriptorTable([](auto& table) { table.Revalidate(); });
+
     runtime.TickFrame();
     ++frame_tick;
 
@@ -307,6 +309,8 @@ void TextureCache<P>::SynchronizeGraphicsDescriptors() {
                                                         tic_limit)) {
         channel_state->graphics_image_view_ids.resize(tic_limit + 1, CORRUPT_ID);
     }
+    channel_state->graphics_sampler_table.UpdateTracking(device_memory);
+    channel_state->graphics_image_table.UpdateTracking(device_memory);
 }
 
 template <class P>
@@ -322,6 +326,8 @@ void TextureCache<P>::SynchronizeComputeDescriptors() {
                                                        tic_limit)) {
         channel_state->compute_image_view_ids.resize(tic_limit + 1, CORRUPT_ID);
     }
+    channel_state->compute_sampler_table.UpdateTracking(device_memory);
+    channel_state->compute_image_table.UpdateTracking(device_memory);
 }
 
 template <class P>
@@ -511,7 +517,7 @@ ImageViewId TextureCache<P>::VisitImageView(DescriptorTable<TICEntry>& table,
         image_view_id = FindImageView(descriptor);
     }
     if (image_view_id != NULL_IMAGE_VIEW_ID) {
-        PrepareImageView(image_view_id, false, false);
+        PrepareSampledImageView(image_view_id);
     }
     return image_view_id;
 }
@@ -534,6 +540,7 @@ FramebufferId TextureCache<P>::GetFramebufferId(const RenderTargets& key) {
 
 template <class P>
 void TextureCache<P>::WriteMemory(DAddr cpu_addr, size_t size) {
+    ForEachDescriptorTable([cpu_addr, size](auto& table) { table.OnWrite(cpu_addr, size); });
     ForEachImageInRegion(cpu_addr, size, [this](ImageId image_id, Image& image) {
         if (True(image.flags & ImageFlagBits::CpuModified)) {
             return;
@@ -600,6 +607,7 @@ std::optional<VideoCore::RasterizerDownloadArea> TextureCache<P>::GetFlushArea(D
 
 template <class P>
 void TextureCache<P>::UnmapMemory(DAddr cpu_addr, size_t size) {
+    ForEachDescriptorTable([cpu_addr, size](auto& table) { table.OnUnmap(cpu_addr, size); });
     boost::container::small_vector<ImageId, 16> deleted_images;
     ForEachImageInRegion(cpu_addr, size, [&](ImageId id, Image&) { deleted_images.push_back(id); });
     for (const ImageId id : deleted_images) {
@@ -614,6 +622,15 @@ void TextureCache<P>::UnmapMemory(DAddr cpu_addr, size_t size) {
 
 template <class P>
 void TextureCache<P>::UnmapGPUMemory(size_t as_id, GPUVAddr gpu_addr, size_t size) {
+    for (const size_t id : active_channel_ids) {
+        TextureCacheChannelInfo& channel_info = channel_storage[id];
+        if (channel_info.gpu_memory.GetID() != as_id) {
+            continue;
+        }
+        ForEachDescriptorTable(channel_info, [gpu_addr, size](auto& table) {
+            table.OnUnmapGPU(gpu_addr, size);
+        });
+    }
     boost::container::small_vector<ImageId, 16> deleted_images;
     ForEachImageInRegionGPU(as_id, gpu_addr, size,
                             [&](ImageId id, Image&) { deleted_images.push_back(id); });
@@ -735,13 +752,12 @@ template <class P>
 std::pair<typename P::ImageView*, bool> TextureCache<P>::TryFindFramebufferImageView(
     const Tegra::FramebufferConfig& config, DAddr cpu_addr) {
     // TODO: Properly implement this
-    const auto it = page_table.find(cpu_addr >> YUZU_PAGEBITS);
-    if (it == page_table.end()) {
+    const auto* const image_map_ids = page_table.Find(cpu_addr >> YUZU_PAGEBITS);
+    if (!image_map_ids) {
         return {};
     }
-    const auto& image_map_ids = it->second;
     boost::container::small_vector<ImageId, 4> valid_image_ids;
-    for (const ImageMapId map_id : image_map_ids) {
+    for (const ImageMapId map_id : *image_map_ids) {
         const ImageMapView& map = slot_map_views[map_id];
         const ImageBase& image = slot_images[map.image_id];
         if (image.cpu_addr != cpu_addr) {
@@ -1050,11 +1066,15 @@ void TextureCache<P>::DownloadImageIntoBuffer(typename TextureCache<P>::Image* i
 }
 
 template <class P>
-void TextureCache<P>::RefreshContents(Image& image, ImageId image_id) {
+void TextureCache<P>::RefreshContents(Image& image, ImageId image_id, bool allow_async) {
     if (False(image.flags & ImageFlagBits::CpuModified)) {
         // Only upload modified images
         return;
     }
+    if (True(image.flags & ImageFlagBits::IsDecoding)) {
+        // Keep a single decode in flight per image so uploads land in guest order
+        FinishAsyncDecode(image_id);
+    }
     image.flags &= ~ImageFlagBits::CpuModified;
     TrackImage(image, image_id);
 
@@ -1063,7 +1083,8 @@ void TextureCache<P>::RefreshContents(Image& image, ImageId image_id) {
         runtime.TransitionImageLayout(image);
         return;
     }
-    if (True(image.flags & ImageFlagBits::AsynchronousDecode)) {
+    if (True(image.flags & ImageFlagBits::AsynchronousDecode) ||
+        (allow_async && CanDecodeAsync(image))) {
         QueueAsyncDecode(image, image_id);
         return;
     }
@@ -1279,10 +1300,20 @@ u64 TextureCache<P>::GetScaledImageSizeBytes(const ImageBase& image) {
     return fitted_size;
 }
 
+template <class P>
+bool TextureCache<P>::CanDecodeAsync(const Image& image) const {
+    if (!Settings::values.use_asynchronous_texture_decode.GetValue()) {
+        return false;
+    }
+    // Accelerated uploads are decoded by the host GPU, and unswizzling linear images reads guest
+    // memory, which is not safe away from the GPU thread
+    return False(image.flags & ImageFlagBits::AcceleratedUpload) &&
+           image.info.type != ImageType::Linear;
+}
+
 template <class P>
 void TextureCache<P>::QueueAsyncDecode(Image& image, ImageId image_id) {
-    UNIMPLEMENTED_IF(False(image.flags & ImageFlagBits::Converted));
-    LOG_INFO(HW_GPU, "Queuing async texture decode");
+    LOG_DEBUG(HW_GPU, "Queuing async texture decode");
 
     image.flags |= ImageFlagBits::IsDecoding;
     auto decode = std::make_unique<AsyncDecodeContext>();
@@ -1290,55 +1321,80 @@ void TextureCache<P>::QueueAsyncDecode(Image& image, ImageId image_id) {
     decode->image_id = image_id;
     async_decodes.push_back(std::move(decode));
 
-    static Common::ScratchBuffer<u8> local_unswizzle_data_buffer;
-    local_unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
-    Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::UnsafeRead> swizzle_data(
-        *gpu_memory, image.gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
-
-    auto copies = UnswizzleImage(*gpu_memory, image.gpu_addr, image.info, swizzle_data,
-                                 local_unswizzle_data_buffer);
-    const size_t out_size = MapSizeBytes(image);
+    // Guest memory is only read here, later guest writes are picked up by the next refresh
+    Common::ScratchBuffer<u8> input(image.guest_size_bytes);
+    gpu_memory->ReadBlockUnsafe(image.gpu_addr, input.data(), image.guest_size_bytes);
 
-    auto func = [out_size, copies, info = image.info,
-                 input = std::move(local_unswizzle_data_buffer),
-                 async_decode = decode_ptr]() mutable {
+    auto func = [&gpu_memory = *gpu_memory, out_size = MapSizeBytes(image),
+                 unswizzled_size = image.unswizzled_size_bytes, gpu_addr = image.gpu_addr,
+                 info = image.info, is_converted = True(image.flags & ImageFlagBits::Converted),
+                 input = std::move(input), async_decode = decode_ptr]() mutable {
         async_decode->decoded_data.resize_destructive(out_size);
-        std::span copies_span{copies.data(), copies.size()};
-        ConvertImage(input, info, async_decode->decoded_data, copies_span);
-
-        // TODO: Do we need this lock?
-        std::unique_lock lock{async_decode->mutex};
-        async_decode->copies = std::move(copies);
-        async_decode->complete = true;
+        boost::container::small_vector<BufferImageCopy, 16> copies;
+        if (is_converted) {
+            Common::ScratchBuffer<u8> unswizzled(unswizzled_size);
+            copies = UnswizzleImage(gpu_memory, gpu_addr, info, input, unswizzled);
+            std::span copies_span{copies.data(), copies.size()};
+            ConvertImage(unswizzled, info, async_decode->decoded_data, copies_span);
+        } else {
+            copies = UnswizzleImage(gpu_memory, gpu_addr, info, input, async_decode->decoded_data);
+        }
+        {
+            std::scoped_lock lock{async_decode->mutex};
+            async_decode->copies = std::move(copies);
+            async_decode->complete = true;
+        }
+        async_decode->complete.notify_all();
     };
     texture_decode_worker.QueueWork(std::move(func));
 }
 
 template <class P>
 void TextureCache<P>::TickAsyncDecode() {
-    bool has_uploads{};
+    // Completed decodes are uploaded in queue order until the budget of the frame runs out
+    size_t uploaded_bytes = 0;
     auto i = async_decodes.begin();
-    while (i != async_decodes.end()) {
-        auto* async_decode = i->get();
-        std::unique_lock lock{async_decode->mutex};
-        if (!async_decode->complete) {
+    while (i != async_decodes.end() && uploaded_bytes < ASYNC_DECODE_UPLOAD_BUDGET) {
+        AsyncDecodeContext& async_decode = **i;
+        if (!async_decode.complete) {
             ++i;
             continue;
         }
-        Image& image = slot_images[async_decode->image_id];
-        auto staging = runtime.UploadStagingBuffer(MapSizeBytes(image));
-        std::memcpy(staging.mapped_span.data(), async_decode->decoded_data.data(),
-                    async_decode->decoded_data.size());
-        image.UploadMemory(staging, async_decode->copies);
-        image.flags &= ~ImageFlagBits::IsDecoding;
-        has_uploads = true;
+        uploaded_bytes += async_decode.decoded_data.size();
+        UploadAsyncDecode(async_decode);
         i = async_decodes.erase(i);
     }
-    if (has_uploads) {
+    if (uploaded_bytes > 0) {
         runtime.InsertUploadMemoryBarrier();
     }
 }
 
+template <class P>
+void TextureCache<P>::FinishAsyncDecode(ImageId image_id) {
+    const auto it = std::ranges::find(async_decodes, image_id, [](const auto& async_decode) {
+        return async_decode->image_id;
+    });
+    if (it == async_decodes.end()) {
+        return;
+    }
+    AsyncDecodeContext& async_decode = **it;
+    async_decode.complete.wait(false);
+    UploadAsyncDecode(async_decode);
+    async_decodes.erase(it);
+    runtime.InsertUploadMemoryBarrier();
+}
+
+template <class P>
+void TextureCache<P>::UploadAsyncDecode(AsyncDecodeContext& async_decode) {
+    std::scoped_lock lock{async_decode.mutex};
+    Image& image = slot_images[async_decode.image_id];
+    auto staging = runtime.UploadStagingBuffer(MapSizeBytes(image));
+    std::memcpy(staging.mapped_span.data(), async_decode.decoded_data.data(),
+                async_decode.decoded_data.size());
+    image.UploadMemory(staging, async_decode.copies);
+    image.flags &= ~ImageFlagBits::IsDecoding;
+}
+
 template <class P>
 bool TextureCache<P>::ScaleUp(Image& image) {
     const bool has_copy = image.HasScaled();
@@ -1814,16 +1870,11 @@ void TextureCache<P>::ForEachImageInRegion(DAddr cpu_addr, size_t size, Func&& f
     static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
     boost::container::small_vector<ImageId, 32> images;
     boost::container::small_vector<ImageMapId, 32> maps;
-    ForEachCPUPage(cpu_addr, size, [this, &images, &maps, cpu_addr, size, func](u64 page) {
-        const auto it = page_table.find(page);
-        if (it == page_table.end()) {
-            if constexpr (BOOL_BREAK) {
-                return false;
-            } else {
-                return;
-            }
-        }
-        for (const ImageMapId map_id : it->second) {
+    const u64 first_page = cpu_addr >> YUZU_PAGEBITS;
+    const u64 last_page = (cpu_addr + size - 1) >> YUZU_PAGEBITS;
+    page_table.ForEachInRange(first_page, last_page, [this, &images, &maps, cpu_addr, size,
+                                                      func](u64, const auto& map_ids) {
+        for (const ImageMapId map_id : map_ids) {
             ImageMapView& map = slot_map_views[map_id];
             if (map.picked) {
                 continue;
@@ -1841,15 +1892,12 @@ void TextureCache<P>::ForEachImageInRegion(DAddr cpu_addr, size_t size, Func&& f
             images.push_back(map.image_id);
             if constexpr (BOOL_BREAK) {
                 if (func(map.image_id, image)) {
-                    return true;
+                    return;
                 }
             } else {
                 func(map.image_id, image);
             }
         }
-        if constexpr (BOOL_BREAK) {
-            return false;
-        }
     });
     for (const ImageId image_id : images) {
         slot_images[image_id].flags &= ~ImageFlagBits::Picked;
@@ -1871,38 +1919,29 @@ void TextureCache<P>::ForEachImageInRegionGPU(size_t as_id, GPUVAddr gpu_addr, s
         return;
     }
     auto& gpu_page_table = gpu_page_table_storage[*storage_id * 2];
-    ForEachGPUPage(gpu_addr, size,
-                   [this, &gpu_page_table, &images, gpu_addr, size, func](u64 page) {
-                       const auto it = gpu_page_table.find(page);
-                       if (it == gpu_page_table.end()) {
-                           if constexpr (BOOL_BREAK) {
-                               return false;
-                           } else {
-                               return;
-                           }
-                       }
-                       for (const ImageId image_id : it->second) {
-                           Image& image = slot_images[image_id];
-                           if (True(image.flags & ImageFlagBits::Picked)) {
-                               continue;
-                           }
-                           if (!image.OverlapsGPU(gpu_addr, size)) {
-                               continue;
-                           }
-                           image.flags |= ImageFlagBits::Picked;
-                           images.push_back(image_id);
-                           if constexpr (BOOL_BREAK) {
-                               if (func(image_id, image)) {
-                                   return true;
-                               }
-                           } else {
-                               func(image_id, image);
-                           }
-                       }
-                       if constexpr (BOOL_BREAK) {
-                           return false;
-                       }
-                   });
+    const u64 first_page = gpu_addr >> YUZU_PAGEBITS;
+    const u64 last_page = (gpu_addr + size - 1) >> YUZU_PAGEBITS;
+    gpu_page_table.ForEachInRange(first_page, last_page, [this, &images, gpu_addr, size,
+                                                         func](u64, const auto& image_ids) {
+        for (const ImageId image_id : image_ids) {
+            Image& image = slot_images[image_id];
+            if (True(image.flags & ImageFlagBits::Picked)) {
+                continue;
+            }
+            if (!image.OverlapsGPU(gpu_addr, size)) {
+                continue;
+            }
+            image.flags |= ImageFlagBits::Picked;
+            images.push_back(image_id);
+            if constexpr (BOOL_BREAK) {
+                if (func(image_id, image)) {
+                    return;
+                }
+            } else {
+                func(image_id, image);
+            }
+        }
+    });
     for (const ImageId image_id : images) {
         slot_images[image_id].flags &= ~ImageFlagBits::Picked;
     }
@@ -1920,38 +1959,29 @@ void TextureCache<P>::ForEachSparseImageInRegion(size_t as_id, GPUVAddr gpu_addr
         return;
     }
     auto& sparse_page_table = gpu_page_table_storage[*storage_id * 2 + 1];
-    ForEachGPUPage(gpu_addr, size,
-                   [this, &sparse_page_table, &images, gpu_addr, size, func](u64 page) {
-                       const auto it = sparse_page_table.find(page);
-                       if (it == sparse_page_table.end()) {
-                           if constexpr (BOOL_BREAK) {
-                               return false;
-                           } else {
-                               return;
-                           }
-                       }
-                       for (const ImageId image_id : it->second) {
-                           Image& image = slot_images[image_id];
-                           if (True(image.flags & ImageFlagBits::Picked)) {
-                               continue;
-                           }
-                           if (!image.OverlapsGPU(gpu_addr, size)) {
-                               continue;
-                           }
-                           image.flags |= ImageFlagBits::Picked;
-                           images.push_back(image_id);
-                           if constexpr (BOOL_BREAK) {
-                               if (func(image_id, image)) {
-                                   return true;
-                               }
-                           } else {
-                               func(image_id, image);
-                           }
-                       }
-                       if constexpr (BOOL_BREAK) {
-                           return false;
-                       }
-                   });
+    const u64 first_page = gpu_addr >> YUZU_PAGEBITS;
+    const u64 last_page = (gpu_addr + size - 1) >> YUZU_PAGEBITS;
+    sparse_page_table.ForEachInRange(first_page, last_page, [this, &images, gpu_addr, size,
+                                                            func](u64, const auto& image_ids) {
+        for (const ImageId image_id : image_ids) {
+            Image& image = slot_images[image_id];
+            if (True(image.flags & ImageFlagBits::Picked)) {
+                continue;
+            }
+            if (!image.OverlapsGPU(gpu_addr, size)) {
+                continue;
+            }
+            image.flags |= ImageFlagBits::Picked;
+            images.push_back(image_id);
+            if constexpr (BOOL_BREAK) {
+                if (func(image_id, image)) {
+                    return;
+                }
+            } else {
+                func(image_id, image);
+            }
+        }
+    });
     for (const ImageId image_id : images) {
         slot_images[image_id].flags &= ~ImageFlagBits::Picked;
     }
@@ -2004,13 +2034,13 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
     image.lru_index = lru_cache.Insert(image_id, frame_tick);
 
     ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
-        (*channel_state->gpu_page_table)[page].push_back(image_id);
+        channel_state->gpu_page_table->Insert(page, image_id);
     });
     if (False(image.flags & ImageFlagBits::Sparse)) {
         auto map_id =
             slot_map_views.insert(image.gpu_addr, image.cpu_addr, image.guest_size_bytes, image_id);
         ForEachCPUPage(image.cpu_addr, image.guest_size_bytes,
-                       [this, map_id](u64 page) { page_table[page].push_back(map_id); });
+                       [this, map_id](u64 page) { page_table.Insert(page, map_id); });
         image.map_view_id = map_id;
         return;
     }
@@ -2019,12 +2049,12 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
         image, [this, image_id, &sparse_maps](GPUVAddr gpu_addr, DAddr cpu_addr, size_t size) {
             auto map_id = slot_map_views.insert(gpu_addr, cpu_addr, size, image_id);
             ForEachCPUPage(cpu_addr, size,
-                           [this, map_id](u64 page) { page_table[page].push_back(map_id); });
+                           [this, map_id](u64 page) { page_table.Insert(page, map_id); });
             sparse_maps.push_back(map_id);
         });
     sparse_views.emplace(image_id, std::move(sparse_maps));
     ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
-        (*channel_state->sparse_page_table)[page].push_back(image_id);
+        channel_state->sparse_page_table->Insert(page, image_id);
     });
 }
 
@@ -2036,43 +2066,22 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
     image.flags &= ~ImageFlagBits::Registered;
     image.flags &= ~ImageFlagBits::BadOverlap;
     lru_cache.Free(image.lru_index);
-    const auto& clear_page_table =
-        [image_id](u64 page,
-                   std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>&
-                       selected_page_table) {
-            const auto page_it = selected_page_table.find(page);
-            if (page_it == selected_page_table.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
-                return;
-            }
-            std::vector<ImageId>& image_ids = page_it->second;
-            const auto vector_it = std::ranges::find(image_ids, image_id);
-            if (vector_it == image_ids.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
-                           page << YUZU_PAGEBITS);
-                return;
-            }
-            image_ids.erase(vector_it);
-        };
+    const auto& clear_page_table = [image_id](u64 page, TextureCacheGPUMap& selected_page_table) {
+        if (!selected_page_table.Erase(page, image_id)) {
+            ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
+                       page << YUZU_PAGEBITS);
+        }
+    };
     ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, &clear_page_table](u64 page) {
         clear_page_table(page, (*channel_state->gpu_page_table));
     });
     if (False(image.flags & ImageFlagBits::Sparse)) {
         const auto map_id = image.map_view_id;
         ForEachCPUPage(image.cpu_addr, image.guest_size_bytes, [this, map_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
-                return;
-            }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            const auto vector_it = std::ranges::find(image_map_ids, map_id);
-            if (vector_it == image_map_ids.end()) {
+            if (!page_table.Erase(page, map_id)) {
                 ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
                            page << YUZU_PAGEBITS);
-                return;
             }
-            image_map_ids.erase(vector_it);
         });
         slot_map_views.erase(map_id);
         return;
@@ -2088,24 +2097,15 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
         const DAddr cpu_addr = map_range.cpu_addr;
         const std::size_t size = map_range.size;
         ForEachCPUPage(cpu_addr, size, [this, image_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
-                return;
-            }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            auto vector_it = image_map_ids.begin();
-            while (vector_it != image_map_ids.end()) {
-                ImageMapView& map = slot_map_views[*vector_it];
+            // Maps of the same image can share pages, the first one erases them all
+            page_table.EraseIf(page, [this, image_id](ImageMapId map_id) {
+                ImageMapView& map = slot_map_views[map_id];
                 if (map.image_id != image_id) {
-                    vector_it++;
-                    continue;
-                }
-                if (!map.picked) {
-                    map.picked = true;
+                    return false;
                 }
-                vector_it = image_map_ids.erase(vector_it);
-            }
+                map.picked = true;
+                return true;
+            });
         });
         slot_map_views.erase(map_view_id);
     }
@@ -2164,6 +2164,10 @@ void TextureCache<P>::UntrackImage(ImageBase& image, ImageId image_id) {
 
 template <class P>
 void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
+    if (True(slot_images[image_id].flags & ImageFlagBits::IsDecoding)) {
+        // The decoder thread writes to the context of the image, wait for it before freeing
+        FinishAsyncDecode(image_id);
+    }
     ImageBase& image = slot_images[image_id];
     if (image.HasScaled()) {
         total_used_memory -= GetScaledImageSizeBytes(image);
@@ -2348,6 +2352,10 @@ void TextureCache<P>::SynchronizeAliases(ImageId image_id) {
 template <class P>
 void TextureCache<P>::PrepareImage(ImageId image_id, bool is_modification, bool invalidate) {
     Image& image = slot_images[image_id];
+    if (True(image.flags & ImageFlagBits::IsDecoding)) {
+        // Anything else than sampling has to see the decoded contents
+        FinishAsyncDecode(image_id);
+    }
     if (invalidate) {
         image.flags &= ~(ImageFlagBits::CpuModified | ImageFlagBits::GpuModified);
         if (False(image.flags & ImageFlagBits::Tracked)) {
@@ -2376,8 +2384,27 @@ void TextureCache<P>::PrepareImageView(ImageViewId image_view_id, bool is_modifi
     PrepareImage(image_view.image_id, is_modification, invalidate);
 }
 
+template <class P>
+void TextureCache<P>::PrepareSampledImageView(ImageViewId image_view_id) {
+    const ImageViewBase& image_view = slot_image_views[image_view_id];
+    if (image_view.IsBuffer()) {
+        return;
+    }
+    const ImageId image_id = image_view.image_id;
+    Image& image = slot_images[image_id];
+    RefreshContents(image, image_id, true);
+    SynchronizeAliases(image_id);
+    lru_cache.Touch(image.lru_index, frame_tick);
+}
+
 template <class P>
 void TextureCache<P>::CopyImage(ImageId dst_id, ImageId src_id, std::vector<ImageCopy> copies) {
+    // Copies are recorded in guest order, so both images must hold their decoded contents
+    for (const ImageId image_id : {dst_id, src_id}) {
+        if (True(slot_images[image_id].flags & ImageFlagBits::IsDecoding)) {
+            FinishAsyncDecode(image_id);
+        }
+    }
     Image& dst = slot_images[dst_id];
     Image& src = slot_images[src_id];
     const bool is_rescaled = True(src.flags & ImageFlagBits::Rescaled);
@@ -2540,6 +2567,32 @@ void TextureCache<P>::CreateChannel(struct Tegra::Control::ChannelState& channel
     this_state->sparse_page_table = &gpu_page_table_storage[this_as_ref.storage_id * 2 + 1];
 }
 
+template <class P>
+void TextureCache<P>::EraseChannel(s32 id) {
+    const auto it = channel_map.find(id);
+    if (it != channel_map.end()) {
+        ForEachDescriptorTable(channel_storage[it->second], [](auto& table) { table.Untrack(); });
+    }
+    VideoCommon::ChannelSetupCaches<TextureCacheChannelInfo>::EraseChannel(id);
+}
+
+template <class P>
+template <typename Func>
+void TextureCache<P>::ForEachDescriptorTable(TextureCacheChannelInfo& channel_info, Func&& func) {
+    func(channel_info.graphics_image_table);
+    func(channel_info.graphics_sampler_table);
+    func(channel_info.compute_image_table);
+    func(channel_info.compute_sampler_table);
+}
+
+template <class P>
+template <typename Func>
+void TextureCache<P>::ForEachDescriptorTable(Func&& func) {
+    for (const size_t id : active_channel_ids) {
+        ForEachDescriptorTable(channel_storage[id], func);
+    }
+}
+
 /// Bind a channel for execution.
 template <class P>
 void TextureCache<P>::OnGPUASRegister([[maybe_unused]] size_t map_id) {
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 // SPDX-FileCopyrightText: 2023 yuzu Emulator Project
@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <deque>
 #include <limits>
 #include <mutex>
 #include <span>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -35,6 +37,7 @@
 #include "video_core/texture_cache/image_base.h"
 #include "video_core/texture_cache/image_info.h"
 #include "video_core/texture_cache/image_view_base.h"
+#include "video_core/texture_cache/page_index.h"
 #include "video_core/texture_cache/render_targets.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/textures/texture.h"
@@ -66,7 +69,7 @@ struct AsyncDecodeContext {
     std::atomic_bool complete;
 };
 
-using TextureCacheGPUMap = std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>;
+using TextureCacheGPUMap = PageIndex<ImageId>;
 
 class TextureCacheChannelInfo : public ChannelInfo {
 public:
@@ -114,6 +117,8 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
     static constexpr s64 DEFAULT_EXPECTED_MEMORY = 1_GiB + 125_MiB;
     static constexpr s64 DEFAULT_CRITICAL_MEMORY = 1_GiB + 625_MiB;
     static constexpr size_t GC_EMERGENCY_COUNTS = 2;
+    /// Bytes of decoded textures uploaded per frame, the rest waits for the next frames
+    static constexpr size_t ASYNC_DECODE_UPLOAD_BUDGET = 64_MiB;
 
     using Runtime = typename P::Runtime;
     using Image = typename P::Image;
@@ -250,6 +255,9 @@ public:
     /// Create channel state.
     void CreateChannel(Tegra::Control::ChannelState& channel) final override;
 
+    /// Erase channel state, releasing the memory tracked by its descriptor tables.
+    void EraseChannel(s32 id);
+
     /// Prepare an image to be used
     void PrepareImage(ImageId image_id, bool is_modification, bool invalidate);
 
@@ -259,7 +267,7 @@ private:
     /// Iterate over all page indices in a range
     template <typename Func>
     static void ForEachCPUPage(DAddr addr, size_t size, Func&& func) {
-        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result<Func, u64>, bool>;
+        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result_t<Func, u64>, bool>;
         const u64 page_end = (addr + size - 1) >> YUZU_PAGEBITS;
         for (u64 page = addr >> YUZU_PAGEBITS; page <= page_end; ++page) {
             if constexpr (RETURNS_BOOL) {
@@ -274,7 +282,7 @@ private:
 
     template <typename Func>
     static void ForEachGPUPage(GPUVAddr addr, size_t size, Func&& func) {
-        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result<Func, u64>, bool>;
+        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result_t<Func, u64>, bool>;
         const u64 page_end = (addr + size - 1) >> YUZU_PAGEBITS;
         for (u64 page = addr >> YUZU_PAGEBITS; page <= page_end; ++page) {
             if constexpr (RETURNS_BOOL) {
@@ -289,6 +297,14 @@ private:
 
     void OnGPUASRegister(size_t map_id) final override;
 
+    /// Calls func on every descriptor table of a channel
+    template <typename Func>
+    static void ForEachDescriptorTable(TextureCacheChannelInfo& channel_info, Func&& func);
+
+    /// Calls func on every descriptor table of the active channels
+    template <typename Func>
+    void ForEachDescriptorTable(Func&& func);
+
     /// Runs the Garbage Collector.
     void RunGarbageCollector();
 
@@ -305,8 +321,9 @@ private:
     /// Find or create a framebuffer with the given render target parameters
     FramebufferId GetFramebufferId(const RenderTargets& key);
 
-    /// Refresh the contents (pixel data) of an image
-    void RefreshContents(Image& image, ImageId image_id);
+    /// Refresh the contents (pixel data) of an image, allow_async lets the upload be decoded in
+    /// the background when the image is only going to be sampled
+    void RefreshContents(Image& image, ImageId image_id, bool allow_async = false);
 
     /// Upload data from guest to an image
     template <typename StagingBuffer>
@@ -400,6 +417,9 @@ private:
     /// Prepare an image view to be used
     void PrepareImageView(ImageViewId image_view_id, bool is_modification, bool invalidate);
 
+    /// Prepare an image view to be sampled, its contents may still be decoding after this call
+    void PrepareSampledImageView(ImageViewId image_view_id);
+
     /// Execute copies from one image to the other, even if they are incompatible
     void CopyImage(ImageId dst_id, ImageId src_id, std::vector<ImageCopy> copies);
 
@@ -422,9 +442,16 @@ private:
     bool ScaleDown(Image& image);
     u64 GetScaledImageSizeBytes(const ImageBase& image);
 
+    [[nodiscard]] bool CanDecodeAsync(const Image& image) const;
     void QueueAsyncDecode(Image& image, ImageId image_id);
     void TickAsyncDecode();
 
+    /// Waits for the pending decode of an image and uploads it, so it can be used for anything
+    /// else than sampling
+    void FinishAsyncDecode(ImageId image_id);
+
+    void UploadAsyncDecode(AsyncDecodeContext& async_decode);
+
     Runtime& runtime;
 
     Tegra::MaxwellDeviceMemoryManager& device_memory;
@@ -434,7 +461,7 @@ private:
 
     std::unordered_map<RenderTargets, FramebufferId> framebuffers;
 
-    std::unordered_map<u64, std::vector<ImageMapId>, Common::IdentityHash<u64>> page_table;
+    PageIndex<ImageMapId> page_table;
     std::unordered_map<ImageId, boost::container::small_vector<ImageViewId, 16>> sparse_views;
 
     DAddr virtual_invalid_space{};
@@ -492,7 +519,8 @@ private:
     u64 modification_tick = 0;
     u64 frame_tick = 0;
 
-    Common::ThreadWorker texture_decode_worker{1, "TextureDecoder"};
+    Common::ThreadWorker texture_decode_worker{
+        std::clamp<size_t>(std::thread::hardware_concurrency() / 4, 1, 4), "TextureDecoder"};
     std::vector<std::unique_ptr<AsyncDecodeContext>> async_decodes;
 
     // Join caching
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2016 The University of North Carolina at Chapel Hill
 // SPDX-License-Identifier: Apache-2.0
 
@@ -5,6 +8,7 @@
 // <http://gamma.cs.unc.edu/FasTC/>
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <cstring>
@@ -13,106 +17,85 @@
 
 #include <boost/container/static_vector.hpp>
 
+#if defined(ARCHITECTURE_x86_64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#elif defined(ARCHITECTURE_arm64)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wshadow"
+#include <sse2neon.h>
+#pragma GCC diagnostic pop
+#endif
+
 #include "common/alignment.h"
 #include "common/common_types.h"
 #include "common/polyfill_ranges.h"
+#include "common/swap.h"
 #include "video_core/textures/astc.h"
 #include "video_core/textures/workers.h"
 
+#if defined(ARCHITECTURE_x86_64)
+#include "common/x64/cpu_detect.h"
+#endif
+
+// Reads bits LSB first out of a single 128-bit ASTC block, reads past the end return zeros.
 class InputBitStream {
 public:
-    constexpr explicit InputBitStream(std::span<const u8> data, size_t start_offset = 0)
-        : cur_byte{data.data()}, total_bits{data.size()}, next_bit{start_offset % 8} {}
+    constexpr explicit InputBitStream(u64 lo_, u64 hi_) : lo{lo_}, hi{hi_} {}
+
+    explicit InputBitStream(std::span<const u8, 16> data) {
+        std::memcpy(&lo, data.data(), sizeof(lo));
+        std::memcpy(&hi, data.data() + sizeof(lo), sizeof(hi));
+    }
 
     constexpr size_t GetBitsRead() const {
         return bits_read;
     }
 
     constexpr bool ReadBit() {
-        if (bits_read >= total_bits * 8) {
-            return 0;
-        }
-        const bool bit = ((*cur_byte >> next_bit) & 1) != 0;
-        ++next_bit;
-        while (next_bit >= 8) {
-            next_bit -= 8;
-            ++cur_byte;
-        }
-        ++bits_read;
-        return bit;
+        return ReadBits64(1) != 0;
     }
 
     constexpr u32 ReadBits(std::size_t nBits) {
-        u32 ret = 0;
-        for (std::size_t i = 0; i < nBits; ++i) {
-            ret |= (ReadBit() & 1) << i;
-        }
-        return ret;
+        assert(nBits <= 32);
+        return static_cast<u32>(ReadBits64(nBits));
     }
 
     template <std::size_t nBits>
     constexpr u32 ReadBits() {
-        u32 ret = 0;
-        for (std::size_t i = 0; i < nBits; ++i) {
-            ret |= (ReadBit() & 1) << i;
-        }
-        return ret;
-    }
-
-private:
-    const u8* cur_byte;
-    size_t total_bits = 0;
-    size_t next_bit = 0;
-    size_t bits_read = 0;
-};
-
-class OutputBitStream {
-public:
-    constexpr explicit OutputBitStream(u8* ptr, std::size_t bits = 0, std::size_t start_offset = 0)
-        : cur_byte{ptr}, num_bits{bits}, next_bit{start_offset % 8} {}
-
-    constexpr std::size_t GetBitsWritten() const {
-        return bits_written;
+        static_assert(nBits <= 32);
+        return static_cast<u32>(ReadBits64(nBits));
     }
 
-    constexpr void WriteBitsR(u32 val, u32 nBits) {
-        for (u32 i = 0; i < nBits; i++) {
-            WriteBit((val >> (nBits - i - 1)) & 1);
-        }
-    }
-
-    constexpr void WriteBits(u32 val, u32 nBits) {
-        for (u32 i = 0; i < nBits; i++) {
-            WriteBit((val >> i) & 1);
-        }
+    constexpr u64 ReadBits64(std::size_t nBits) {
+        const u64 mask = nBits >= 64 ? ~u64{0} : (u64{1} << nBits) - 1;
+        const u64 value = Peek() & mask;
+        bits_read += nBits;
+        return value;
     }
 
 private:
-    constexpr void WriteBit(bool b) {
-        if (bits_written >= num_bits) {
-            return;
+    constexpr u64 Peek() const {
+        if (bits_read >= 128) {
+            return 0;
         }
-
-        const u32 mask = 1 << next_bit++;
-
-        // clear the bit
-        *cur_byte &= static_cast<u8>(~mask);
-
-        // Write the bit, if necessary
-        if (b)
-            *cur_byte |= static_cast<u8>(mask);
-
-        // Next byte?
-        if (next_bit >= 8) {
-            cur_byte += 1;
-            next_bit = 0;
+        if (bits_read >= 64) {
+            return hi >> (bits_read - 64);
         }
+        if (bits_read == 0) {
+            return lo;
+        }
+        return (lo >> bits_read) | (hi << (64 - bits_read));
     }
 
-    u8* cur_byte;
-    std::size_t num_bits;
-    std::size_t bits_written = 0;
-    std::size_t next_bit = 0;
+    u64 lo = 0;
+    u64 hi = 0;
+    size_t bits_read = 0;
 };
 
 template <typename IntType>
@@ -157,7 +140,7 @@ struct IntegerEncodedValue {
     }
 
     // Returns the number of bits required to encode num_vals values.
-    u32 GetBitLength(u32 num_vals) const {
+    constexpr u32 GetBitLength(u32 num_vals) const {
         u32 total_bits = num_bits * num_vals;
         if (encoding == IntegerEncoding::Trit) {
             total_bits += (num_vals * 8 + 4) / 5;
@@ -362,11 +345,12 @@ struct TexelWeightParams {
     u32 m_Height = 0;
     bool m_bDualPlane = false;
     u32 m_MaxWeight = 0;
+    u32 m_PackedBitSize = 0;
     bool m_bError = false;
     bool m_bVoidExtentLDR = false;
     bool m_bVoidExtentHDR = false;
 
-    u32 GetPackedBitSize() const {
+    constexpr u32 GetPackedBitSize() const {
         // How many indices do we have?
         u32 nIdxs = m_Height * m_Width;
         if (m_bDualPlane) {
@@ -376,7 +360,7 @@ struct TexelWeightParams {
         return ASTC_ENCODINGS_VALUES[m_MaxWeight].GetBitLength(nIdxs);
     }
 
-    u32 GetNumWeightValues() const {
+    constexpr u32 GetNumWeightValues() const {
         u32 ret = m_Width * m_Height;
         if (m_bDualPlane) {
             ret *= 2;
@@ -385,12 +369,11 @@ struct TexelWeightParams {
     }
 };
 
-static TexelWeightParams DecodeBlockInfo(InputBitStream& strm) {
+// Decodes the 11 bits of a block mode, the bit following a void extent block mode has to be
+// checked by the caller.
+static constexpr TexelWeightParams MakeBlockInfo(u32 modeBits) {
     TexelWeightParams params;
 
-    // Read the entire block mode all at once
-    u16 modeBits = static_cast<u16>(strm.ReadBits<11>());
-
     // Does this match the void extent block mode?
     if ((modeBits & 0x01FF) == 0x1FC) {
         if (modeBits & 0x200) {
@@ -400,7 +383,7 @@ static TexelWeightParams DecodeBlockInfo(InputBitStream& strm) {
         }
 
         // Next two bits must be one.
-        if (!(modeBits & 0x400) || !strm.ReadBit()) {
+        if (!(modeBits & 0x400)) {
             params.m_bError = true;
         }
 
@@ -454,7 +437,6 @@ static TexelWeightParams DecodeBlockInfo(InputBitStream& strm) {
             // layout is in [7-9]
             if (modeBits & 0x80) {
                 // layout is in [7-8]
-                assert((modeBits & 0x40) == 0U);
                 if (modeBits & 0x20) {
                     layout = 8;
                 } else {
@@ -473,8 +455,6 @@ static TexelWeightParams DecodeBlockInfo(InputBitStream& strm) {
         }
     }
 
-    assert(layout < 10);
-
     // Determine R
     u32 R = !!(modeBits & 0x10);
     if (layout < 5) {
@@ -482,7 +462,6 @@ static TexelWeightParams DecodeBlockInfo(InputBitStream& strm) {
     } else {
         R |= (modeBits & 0xC) >> 1;
     }
-    assert(2 <= R && R <= 7);
 
     // Determine width & height
     switch (layout) {
@@ -561,7 +540,6 @@ static TexelWeightParams DecodeBlockInfo(InputBitStream& strm) {
     }
 
     default:
-        assert(false && "Don't know this layout...");
         params.m_bError = true;
         break;
     }
@@ -580,10 +558,30 @@ static TexelWeightParams DecodeBlockInfo(InputBitStream& strm) {
     }
 
     params.m_bDualPlane = D;
+    params.m_PackedBitSize = params.GetPackedBitSize();
 
     return params;
 }
 
+static constexpr std::array<TexelWeightParams, 2048> MakeBlockInfoTable() {
+    std::array<TexelWeightParams, 2048> table{};
+    for (u32 modeBits = 0; modeBits < table.size(); ++modeBits) {
+        table[modeBits] = MakeBlockInfo(modeBits);
+    }
+    return table;
+}
+
+static constexpr std::array<TexelWeightParams, 2048> BLOCK_INFO_TABLE = MakeBlockInfoTable();
+
+static TexelWeightParams DecodeBlockInfo(InputBitStream& strm) {
+    TexelWeightParams params = BLOCK_INFO_TABLE[strm.ReadBits<11>()];
+    if ((params.m_bVoidExtentLDR || params.m_bVoidExtentHDR) && !params.m_bError &&
+        !strm.ReadBit()) {
+        params.m_bError = true;
+    }
+    return params;
+}
+
 // Replicates low num_bits such that [(to_bit - 1):(to_bit - 1 - from_bit)]
 // is the same as [(num_bits - 1):0] and repeats all the way down.
 template <typename IntType>
@@ -815,194 +813,129 @@ public:
     }
 };
 
-static void DecodeColorValues(u32* out, std::span<u8> data, const u32* modes, const u32 nPartitions,
-                              const u32 nBitsForColorData) {
-    // First figure out how many color values we have
-    u32 nValues = 0;
-    for (u32 i = 0; i < nPartitions; i++) {
-        nValues += ((modes[i] >> 2) + 1) << 1;
-    }
-
-    // Then based on the number of values and the remaining number of bits,
-    // figure out the max value for each of them...
-    u32 range = 256;
-    while (--range > 0) {
-        IntegerEncodedValue val = ASTC_ENCODINGS_VALUES[range];
-        u32 bitLength = val.GetBitLength(nValues);
-        if (bitLength <= nBitsForColorData) {
-            // Find the smallest possible range that matches the given encoding
-            while (--range > 0) {
-                IntegerEncodedValue newval = ASTC_ENCODINGS_VALUES[range];
-                if (!newval.MatchesEncoding(val)) {
-                    break;
-                }
-            }
+// Unquantizes a color endpoint value to the 0-255 range, this procedure is outlined in ASTC spec
+// C.2.13
+static constexpr u32 UnquantizeColorValue(IntegerEncoding encoding, u32 bitlen, u32 bitval,
+                                          u32 D) {
+    u32 A = 0, B = 0, C = 0;
+    // A is just the lsb replicated 9 times.
+    A = ReplicateBitTo9(bitval & 1);
 
-            // Return to last matching range.
-            range++;
-            break;
-        }
-    }
+    switch (encoding) {
+    // Replicate bits
+    case IntegerEncoding::JustBits:
+        return FastReplicateTo8(bitval, bitlen);
 
-    // We now have enough to decode our integer sequence.
-    IntegerEncodedVector decodedColorValues;
+    // Use algorithm in C.2.13
+    case IntegerEncoding::Trit: {
+        switch (bitlen) {
+        case 1: {
+            C = 204;
+        } break;
 
-    InputBitStream colorStream(data, 0);
-    DecodeIntegerSequence(decodedColorValues, colorStream, range, nValues);
+        case 2: {
+            C = 93;
+            // B = b000b0bb0
+            u32 b = (bitval >> 1) & 1;
+            B = (b << 8) | (b << 4) | (b << 2) | (b << 1);
+        } break;
 
-    // Once we have the decoded values, we need to dequantize them to the 0-255 range
-    // This procedure is outlined in ASTC spec C.2.13
-    u32 outIdx = 0;
-    for (auto itr = decodedColorValues.begin(); itr != decodedColorValues.end(); ++itr) {
-        // Have we already decoded all that we need?
-        if (outIdx >= nValues) {
-            break;
-        }
+        case 3: {
+            C = 44;
+            // B = cb000cbcb
+            u32 cb = (bitval >> 1) & 3;
+            B = (cb << 7) | (cb << 2) | cb;
+        } break;
 
-        const IntegerEncodedValue& val = *itr;
-        u32 bitlen = val.num_bits;
-        u32 bitval = val.bit_value;
+        case 4: {
+            C = 22;
+            // B = dcb000dcb
+            u32 dcb = (bitval >> 1) & 7;
+            B = (dcb << 6) | dcb;
+        } break;
 
-        assert(bitlen >= 1);
+        case 5: {
+            C = 11;
+            // B = edcb000ed
+            u32 edcb = (bitval >> 1) & 0xF;
+            B = (edcb << 5) | (edcb >> 2);
+        } break;
 
-        u32 A = 0, B = 0, C = 0, D = 0;
-        // A is just the lsb replicated 9 times.
-        A = ReplicateBitTo9(bitval & 1);
+        case 6: {
+            C = 5;
+            // B = fedcb000f
+            u32 fedcb = (bitval >> 1) & 0x1F;
+            B = (fedcb << 4) | (fedcb >> 4);
+        } break;
 
-        switch (val.encoding) {
-        // Replicate bits
-        case IntegerEncoding::JustBits:
-            out[outIdx++] = FastReplicateTo8(bitval, bitlen);
+        default:
+            // Unsupported trit encoding for color values
             break;
+        } // switch(bitlen)
+    }     // case IntegerEncoding::Trit
+    break;
 
-        // Use algorithm in C.2.13
-        case IntegerEncoding::Trit: {
-
-            D = val.trit_value;
-
-            switch (bitlen) {
-            case 1: {
-                C = 204;
-            } break;
-
-            case 2: {
-                C = 93;
-                // B = b000b0bb0
-                u32 b = (bitval >> 1) & 1;
-                B = (b << 8) | (b << 4) | (b << 2) | (b << 1);
-            } break;
-
-            case 3: {
-                C = 44;
-                // B = cb000cbcb
-                u32 cb = (bitval >> 1) & 3;
-                B = (cb << 7) | (cb << 2) | cb;
-            } break;
-
-            case 4: {
-                C = 22;
-                // B = dcb000dcb
-                u32 dcb = (bitval >> 1) & 7;
-                B = (dcb << 6) | dcb;
-            } break;
-
-            case 5: {
-                C = 11;
-                // B = edcb000ed
-                u32 edcb = (bitval >> 1) & 0xF;
-                B = (edcb << 5) | (edcb >> 2);
-            } break;
-
-            case 6: {
-                C = 5;
-                // B = fedcb000f
-                u32 fedcb = (bitval >> 1) & 0x1F;
-                B = (fedcb << 4) | (fedcb >> 4);
-            } break;
-
-            default:
-                assert(false && "Unsupported trit encoding for color values!");
-                break;
-            } // switch(bitlen)
-        }     // case IntegerEncoding::Trit
-        break;
+    case IntegerEncoding::Quint: {
+        switch (bitlen) {
+        case 1: {
+            C = 113;
+        } break;
 
-        case IntegerEncoding::Quint: {
-
-            D = val.quint_value;
-
-            switch (bitlen) {
-            case 1: {
-                C = 113;
-            } break;
-
-            case 2: {
-                C = 54;
-                // B = b0000bb00
-                u32 b = (bitval >> 1) & 1;
-                B = (b << 8) | (b << 3) | (b << 2);
-            } break;
-
-            case 3: {
-                C = 26;
-                // B = cb0000cbc
-                u32 cb = (bitval >> 1) & 3;
-                B = (cb << 7) | (cb << 1) | (cb >> 1);
-            } break;
-
-            case 4: {
-                C = 13;
-                // B = dcb0000dc
-                u32 dcb = (bitval >> 1) & 7;
-                B = (dcb << 6) | (dcb >> 1);
-            } break;
-
-            case 5: {
-                C = 6;
-                // B = edcb0000e
-                u32 edcb = (bitval >> 1) & 0xF;
-                B = (edcb << 5) | (edcb >> 3);
-            } break;
-
-            default:
-                assert(false && "Unsupported quint encoding for color values!");
-                break;
-            } // switch(bitlen)
-        }     // case IntegerEncoding::Quint
-        break;
-        } // switch(val.encoding)
+        case 2: {
+            C = 54;
+            // B = b0000bb00
+            u32 b = (bitval >> 1) & 1;
+            B = (b << 8) | (b << 3) | (b << 2);
+        } break;
 
-        if (val.encoding != IntegerEncoding::JustBits) {
-            u32 T = D * C + B;
-            T ^= A;
-            T = (A & 0x80) | (T >> 2);
-            out[outIdx++] = T;
-        }
-    }
+        case 3: {
+            C = 26;
+            // B = cb0000cbc
+            u32 cb = (bitval >> 1) & 3;
+            B = (cb << 7) | (cb << 1) | (cb >> 1);
+        } break;
 
-    // Make sure that each of our values is in the proper range...
-    for (u32 i = 0; i < nValues; i++) {
-        assert(out[i] <= 255);
-    }
-}
+        case 4: {
+            C = 13;
+            // B = dcb0000dc
+            u32 dcb = (bitval >> 1) & 7;
+            B = (dcb << 6) | (dcb >> 1);
+        } break;
 
-static u32 UnquantizeTexelWeight(const IntegerEncodedValue& val) {
-    u32 bitval = val.bit_value;
-    u32 bitlen = val.num_bits;
+        case 5: {
+            C = 6;
+            // B = edcb0000e
+            u32 edcb = (bitval >> 1) & 0xF;
+            B = (edcb << 5) | (edcb >> 3);
+        } break;
 
+        default:
+            // Unsupported quint encoding for color values
+            break;
+        } // switch(bitlen)
+    }     // case IntegerEncoding::Quint
+    break;
+    } // switch(encoding)
+
+    u32 T = D * C + B;
+    T ^= A;
+    T = (A & 0x80) | (T >> 2);
+    return T;
+}
+
+// Unquantizes a texel weight to the 0-64 range
+static constexpr u32 UnquantizeTexelWeight(IntegerEncoding encoding, u32 bitlen, u32 bitval,
+                                           u32 D) {
     u32 A = ReplicateBitTo7(bitval & 1);
-    u32 B = 0, C = 0, D = 0;
+    u32 B = 0, C = 0;
 
     u32 result = 0;
-    switch (val.encoding) {
+    switch (encoding) {
     case IntegerEncoding::JustBits:
         result = FastReplicateTo6(bitval, bitlen);
         break;
 
     case IntegerEncoding::Trit: {
-        D = val.trit_value;
-        assert(D < 3);
-
         switch (bitlen) {
         case 0: {
             u32 results[3] = {0, 32, 63};
@@ -1026,15 +959,12 @@ static u32 UnquantizeTexelWeight(const IntegerEncodedValue& val) {
         } break;
 
         default:
-            assert(false && "Invalid trit encoding for texel weight");
+            // Invalid trit encoding for texel weight
             break;
         }
     } break;
 
     case IntegerEncoding::Quint: {
-        D = val.quint_value;
-        assert(D < 5);
-
         switch (bitlen) {
         case 0: {
             u32 results[5] = {0, 16, 32, 47, 63};
@@ -1052,21 +982,19 @@ static u32 UnquantizeTexelWeight(const IntegerEncodedValue& val) {
         } break;
 
         default:
-            assert(false && "Invalid quint encoding for texel weight");
+            // Invalid quint encoding for texel weight
             break;
         }
     } break;
     }
 
-    if (val.encoding != IntegerEncoding::JustBits && bitlen > 0) {
+    if (encoding != IntegerEncoding::JustBits && bitlen > 0) {
         // Decode the value...
         result = D * C + B;
         result ^= A;
         result = (A & 0x20) | (result >> 2);
     }
 
-    assert(result < 64);
-
     // Change from [0,63] to [0,64]
     if (result > 32) {
         result += 1;
@@ -1075,72 +1003,242 @@ static u32 UnquantizeTexelWeight(const IntegerEncodedValue& val) {
     return result;
 }
 
-static void UnquantizeTexelWeights(u32 out[2][144], const IntegerEncodedVector& weights,
-                                   const TexelWeightParams& params, const u32 blockWidth,
-                                   const u32 blockHeight) {
-    u32 weightIdx = 0;
-    u32 unquantized[2][144];
+// Unquantization tables indexed by encoding, number of bits and (trit/quint << bits) | bits.
+// Every combination the integer sequence encodings can produce fits in 8 bits.
+template <std::size_t MAX_BITS, std::size_t NUM_VALUES>
+using UnquantizeTable = std::array<std::array<std::array<u8, NUM_VALUES>, MAX_BITS + 1>, 3>;
+
+template <std::size_t MAX_BITS, std::size_t NUM_VALUES, typename Func>
+static constexpr UnquantizeTable<MAX_BITS, NUM_VALUES> MakeUnquantizeTable(Func&& unquantize) {
+    UnquantizeTable<MAX_BITS, NUM_VALUES> table{};
+    for (const IntegerEncoding encoding :
+         {IntegerEncoding::JustBits, IntegerEncoding::Quint, IntegerEncoding::Trit}) {
+        const u32 num_symbols = encoding == IntegerEncoding::Trit    ? 3
+                                : encoding == IntegerEncoding::Quint ? 5
+                                                                     : 1;
+        for (u32 bitlen = 0; bitlen <= MAX_BITS; ++bitlen) {
+            for (u32 D = 0; D < num_symbols; ++D) {
+                for (u32 bitval = 0; bitval < (1U << bitlen); ++bitval) {
+                    const u32 index = (D << bitlen) | bitval;
+                    if (index < NUM_VALUES) {
+                        table[static_cast<size_t>(encoding)][bitlen][index] =
+                            static_cast<u8>(unquantize(encoding, bitlen, bitval, D));
+                    }
+                }
+            }
+        }
+    }
+    return table;
+}
 
-    for (auto itr = weights.begin(); itr != weights.end(); ++itr) {
-        unquantized[0][weightIdx] = UnquantizeTexelWeight(*itr);
+static constexpr auto COLOR_UNQUANTIZE_TABLE =
+    MakeUnquantizeTable<8, 256>([](IntegerEncoding encoding, u32 bitlen, u32 bitval, u32 D) {
+        return UnquantizeColorValue(encoding, bitlen, bitval, D);
+    });
 
-        if (params.m_bDualPlane) {
-            ++itr;
-            unquantized[1][weightIdx] = UnquantizeTexelWeight(*itr);
-            if (itr == weights.end()) {
-                break;
+static constexpr auto WEIGHT_UNQUANTIZE_TABLE =
+    MakeUnquantizeTable<5, 64>([](IntegerEncoding encoding, u32 bitlen, u32 bitval, u32 D) {
+        return UnquantizeTexelWeight(encoding, bitlen, bitval, D);
+    });
+
+template <typename Table>
+static u32 Unquantize(const Table& table, const IntegerEncodedValue& val) {
+    const u32 index = (val.trit_value << val.num_bits) | val.bit_value;
+    return table[static_cast<size_t>(val.encoding)][val.num_bits][index];
+}
+
+// Finds the smallest range with the largest encoding that fits nValues in the given bits
+static constexpr u32 FindColorRange(u32 nValues, u32 nBitsForColorData) {
+    u32 range = 256;
+    while (--range > 0) {
+        IntegerEncodedValue val = ASTC_ENCODINGS_VALUES[range];
+        u32 bitLength = val.GetBitLength(nValues);
+        if (bitLength <= nBitsForColorData) {
+            // Find the smallest possible range that matches the given encoding
+            while (--range > 0) {
+                IntegerEncodedValue newval = ASTC_ENCODINGS_VALUES[range];
+                if (!newval.MatchesEncoding(val)) {
+                    break;
+                }
             }
+
+            // Return to last matching range.
+            range++;
+            break;
         }
+    }
+    return range;
+}
+
+// Color ranges indexed by the number of value pairs and the available bits. No sequence of
+// color values is longer than 256 bits, so that is as far as the bit count has to go.
+// This is too much work for a constant expression, it is built once at startup instead.
+static constexpr u32 MAX_COLOR_VALUES = 32;
+static constexpr u32 MAX_COLOR_BITS = 256;
+
+static const auto COLOR_RANGE_TABLE = [] {
+    std::array<std::array<u8, MAX_COLOR_BITS + 1>, MAX_COLOR_VALUES / 2 + 1> table{};
+    for (u32 pairs = 1; pairs < table.size(); ++pairs) {
+        for (u32 bits = 0; bits <= MAX_COLOR_BITS; ++bits) {
+            table[pairs][bits] = static_cast<u8>(FindColorRange(pairs * 2, bits));
+        }
+    }
+    return table;
+}();
 
-        if (++weightIdx >= (params.m_Width * params.m_Height))
+static void DecodeColorValues(u32* out, InputBitStream colorStream, const u32* modes,
+                              const u32 nPartitions, const u32 nBitsForColorData) {
+    // First figure out how many color values we have
+    u32 nValues = 0;
+    for (u32 i = 0; i < nPartitions; i++) {
+        nValues += ((modes[i] >> 2) + 1) << 1;
+    }
+
+    // Then based on the number of values and the remaining number of bits,
+    // figure out the max value for each of them...
+    const u32 range =
+        COLOR_RANGE_TABLE[nValues / 2][(std::min)(nBitsForColorData, MAX_COLOR_BITS)];
+
+    // We now have enough to decode our integer sequence.
+    IntegerEncodedVector decodedColorValues;
+    DecodeIntegerSequence(decodedColorValues, colorStream, range, nValues);
+
+    // Once we have the decoded values, we need to dequantize them to the 0-255 range
+    u32 outIdx = 0;
+    for (const IntegerEncodedValue& val : decodedColorValues) {
+        // Have we already decoded all that we need?
+        if (outIdx >= nValues) {
             break;
+        }
+        assert(val.num_bits >= 1);
+        out[outIdx++] = Unquantize(COLOR_UNQUANTIZE_TABLE, val);
     }
+}
+
+// Sentinel weight index for texels sampling outside of the weight grid, it always holds zero
+static constexpr u32 ZERO_WEIGHT_INDEX = 144;
+
+// Bilinear infill footprint of a texel, see Section C.2.18
+struct InfillTexel {
+    std::array<u8, 4> index;
+    std::array<u8, 4> weight;
+};
 
-    // Do infill if necessary (Section C.2.18) ...
+static constexpr InfillTexel ComputeInfillTexel(u32 s, u32 t, u32 blockWidth, u32 blockHeight,
+                                                u32 gridWidth, u32 gridHeight) {
     u32 Ds = (1024 + (blockWidth / 2)) / (blockWidth - 1);
     u32 Dt = (1024 + (blockHeight / 2)) / (blockHeight - 1);
 
-    const u32 kPlaneScale = params.m_bDualPlane ? 2U : 1U;
-    for (u32 plane = 0; plane < kPlaneScale; plane++)
-        for (u32 t = 0; t < blockHeight; t++)
-            for (u32 s = 0; s < blockWidth; s++) {
-                u32 cs = Ds * s;
-                u32 ct = Dt * t;
+    u32 cs = Ds * s;
+    u32 ct = Dt * t;
 
-                u32 gs = (cs * (params.m_Width - 1) + 32) >> 6;
-                u32 gt = (ct * (params.m_Height - 1) + 32) >> 6;
+    u32 gs = (cs * (gridWidth - 1) + 32) >> 6;
+    u32 gt = (ct * (gridHeight - 1) + 32) >> 6;
 
-                u32 js = gs >> 4;
-                u32 fs = gs & 0xF;
+    u32 js = gs >> 4;
+    u32 fs = gs & 0xF;
 
-                u32 jt = gt >> 4;
-                u32 ft = gt & 0x0F;
+    u32 jt = gt >> 4;
+    u32 ft = gt & 0x0F;
 
-                u32 w11 = (fs * ft + 8) >> 4;
-                u32 w10 = ft - w11;
-                u32 w01 = fs - w11;
-                u32 w00 = 16 - fs - ft + w11;
+    u32 w11 = (fs * ft + 8) >> 4;
+    u32 w10 = ft - w11;
+    u32 w01 = fs - w11;
+    u32 w00 = 16 - fs - ft + w11;
 
-                u32 v0 = js + jt * params.m_Width;
+    u32 v0 = js + jt * gridWidth;
 
-#define FIND_TEXEL(tidx, bidx)                                                                     \
-    u32 p##bidx = 0;                                                                               \
-    do {                                                                                           \
-        if ((tidx) < (params.m_Width * params.m_Height)) {                                         \
-            p##bidx = unquantized[plane][(tidx)];                                                  \
-        }                                                                                          \
-    } while (0)
+    const auto find_texel = [gridWidth, gridHeight](u32 tidx) {
+        return static_cast<u8>(tidx < gridWidth * gridHeight ? tidx : ZERO_WEIGHT_INDEX);
+    };
+    return InfillTexel{
+        .index{find_texel(v0), find_texel(v0 + 1), find_texel(v0 + gridWidth),
+               find_texel(v0 + gridWidth + 1)},
+        .weight{static_cast<u8>(w00), static_cast<u8>(w01), static_cast<u8>(w10),
+                static_cast<u8>(w11)},
+    };
+}
+
+// Infill footprints of every texel for all the weight grids that fit in a block footprint
+template <u32 BLOCK_WIDTH, u32 BLOCK_HEIGHT>
+struct InfillTable {
+    static constexpr u32 NUM_TEXELS = BLOCK_WIDTH * BLOCK_HEIGHT;
+
+    InfillTable() {
+        for (u32 grid_width = 2; grid_width <= BLOCK_WIDTH; ++grid_width) {
+            for (u32 grid_height = 2; grid_height <= BLOCK_HEIGHT; ++grid_height) {
+                auto& texels = grids[grid_width * (BLOCK_HEIGHT + 1) + grid_height];
+                for (u32 t = 0; t < BLOCK_HEIGHT; ++t) {
+                    for (u32 s = 0; s < BLOCK_WIDTH; ++s) {
+                        texels[t * BLOCK_WIDTH + s] = ComputeInfillTexel(
+                            s, t, BLOCK_WIDTH, BLOCK_HEIGHT, grid_width, grid_height);
+                    }
+                }
+            }
+        }
+    }
+
+    const std::array<InfillTexel, NUM_TEXELS>& Get(u32 grid_width, u32 grid_height) const {
+        return grids[grid_width * (BLOCK_HEIGHT + 1) + grid_height];
+    }
+
+    std::array<std::array<InfillTexel, NUM_TEXELS>, (BLOCK_WIDTH + 1) * (BLOCK_HEIGHT + 1)> grids{};
+};
+
+template <u32 BLOCK_WIDTH, u32 BLOCK_HEIGHT>
+static const InfillTable<BLOCK_WIDTH, BLOCK_HEIGHT>& GetInfillTable() {
+    static const InfillTable<BLOCK_WIDTH, BLOCK_HEIGHT> table;
+    return table;
+}
+
+// A footprint size of zero means the block dimensions are only known at runtime
+template <u32 FOOTPRINT_WIDTH, u32 FOOTPRINT_HEIGHT>
+static void UnquantizeTexelWeights(u32 out[2][144], const IntegerEncodedVector& weights,
+                                   const TexelWeightParams& params, const u32 blockWidth,
+                                   const u32 blockHeight) {
+    const u32 nWeights = params.m_Width * params.m_Height;
+    const u32 kPlaneScale = params.m_bDualPlane ? 2U : 1U;
 
-                FIND_TEXEL(v0, 00);
-                FIND_TEXEL(v0 + 1, 01);
-                FIND_TEXEL(v0 + params.m_Width, 10);
-                FIND_TEXEL(v0 + params.m_Width + 1, 11);
+    u8 unquantized[2][ZERO_WEIGHT_INDEX + 1]{};
+    for (u32 plane = 0; plane < kPlaneScale; ++plane) {
+        for (u32 weightIdx = 0; weightIdx < nWeights; ++weightIdx) {
+            const u32 valueIdx = weightIdx * kPlaneScale + plane;
+            if (valueIdx >= weights.size()) {
+                break;
+            }
+            unquantized[plane][weightIdx] =
+                static_cast<u8>(Unquantize(WEIGHT_UNQUANTIZE_TABLE, weights[valueIdx]));
+        }
+    }
 
-#undef FIND_TEXEL
+    const auto infill = [&](u32 plane, u32 texel, const InfillTexel& footprint) {
+        const u8* const grid = unquantized[plane];
+        out[plane][texel] = (grid[footprint.index[0]] * footprint.weight[0] +
+                             grid[footprint.index[1]] * footprint.weight[1] +
+                             grid[footprint.index[2]] * footprint.weight[2] +
+                             grid[footprint.index[3]] * footprint.weight[3] + 8) >>
+                            4;
+    };
 
-                out[plane][t * blockWidth + s] =
-                    (p00 * w00 + p01 * w01 + p10 * w10 + p11 * w11 + 8) >> 4;
+    if constexpr (FOOTPRINT_WIDTH != 0) {
+        const auto& footprints = GetInfillTable<FOOTPRINT_WIDTH, FOOTPRINT_HEIGHT>().Get(
+            params.m_Width, params.m_Height);
+        for (u32 plane = 0; plane < kPlaneScale; plane++) {
+            for (u32 texel = 0; texel < FOOTPRINT_WIDTH * FOOTPRINT_HEIGHT; ++texel) {
+                infill(plane, texel, footprints[texel]);
             }
+        }
+    } else {
+        for (u32 plane = 0; plane < kPlaneScale; plane++) {
+            for (u32 t = 0; t < blockHeight; t++) {
+                for (u32 s = 0; s < blockWidth; s++) {
+                    infill(plane, t * blockWidth + s,
+                           ComputeInfillTexel(s, t, blockWidth, blockHeight, params.m_Width,
+                                              params.m_Height));
+                }
+            }
+        }
+    }
 }
 
 // Transfers a bit as described in C.2.14
@@ -1176,95 +1274,69 @@ static inline u32 hash52(u32 p) {
     return p;
 }
 
-static u32 SelectPartition(s32 seed, s32 x, s32 y, s32 z, s32 partitionCount, s32 smallBlock) {
-    if (1 == partitionCount)
-        return 0;
+// Selects the partition of each texel in a 2D block. The hash only depends on the block, so it is
+// evaluated once and each texel is left with four multiply-adds.
+class PartitionSelector {
+public:
+    PartitionSelector(u32 seed, u32 partitionCount, bool smallBlock)
+        : partition_count{partitionCount}, coordinate_shift{smallBlock ? 1U : 0U} {
+        if (partitionCount == 1) {
+            return;
+        }
+        seed += (partitionCount - 1) * 1024;
 
-    if (smallBlock) {
-        x <<= 1;
-        y <<= 1;
-        z <<= 1;
-    }
-
-    seed += (partitionCount - 1) * 1024;
-
-    u32 rnum = hash52(static_cast<u32>(seed));
-    u8 seed1 = static_cast<u8>(rnum & 0xF);
-    u8 seed2 = static_cast<u8>((rnum >> 4) & 0xF);
-    u8 seed3 = static_cast<u8>((rnum >> 8) & 0xF);
-    u8 seed4 = static_cast<u8>((rnum >> 12) & 0xF);
-    u8 seed5 = static_cast<u8>((rnum >> 16) & 0xF);
-    u8 seed6 = static_cast<u8>((rnum >> 20) & 0xF);
-    u8 seed7 = static_cast<u8>((rnum >> 24) & 0xF);
-    u8 seed8 = static_cast<u8>((rnum >> 28) & 0xF);
-    u8 seed9 = static_cast<u8>((rnum >> 18) & 0xF);
-    u8 seed10 = static_cast<u8>((rnum >> 22) & 0xF);
-    u8 seed11 = static_cast<u8>((rnum >> 26) & 0xF);
-    u8 seed12 = static_cast<u8>(((rnum >> 30) | (rnum << 2)) & 0xF);
-
-    seed1 = static_cast<u8>(seed1 * seed1);
-    seed2 = static_cast<u8>(seed2 * seed2);
-    seed3 = static_cast<u8>(seed3 * seed3);
-    seed4 = static_cast<u8>(seed4 * seed4);
-    seed5 = static_cast<u8>(seed5 * seed5);
-    seed6 = static_cast<u8>(seed6 * seed6);
-    seed7 = static_cast<u8>(seed7 * seed7);
-    seed8 = static_cast<u8>(seed8 * seed8);
-    seed9 = static_cast<u8>(seed9 * seed9);
-    seed10 = static_cast<u8>(seed10 * seed10);
-    seed11 = static_cast<u8>(seed11 * seed11);
-    seed12 = static_cast<u8>(seed12 * seed12);
-
-    s32 sh1, sh2, sh3;
-    if (seed & 1) {
-        sh1 = (seed & 2) ? 4 : 5;
-        sh2 = (partitionCount == 3) ? 6 : 5;
-    } else {
-        sh1 = (partitionCount == 3) ? 6 : 5;
-        sh2 = (seed & 2) ? 4 : 5;
-    }
-    sh3 = (seed & 0x10) ? sh1 : sh2;
-
-    seed1 = static_cast<u8>(seed1 >> sh1);
-    seed2 = static_cast<u8>(seed2 >> sh2);
-    seed3 = static_cast<u8>(seed3 >> sh1);
-    seed4 = static_cast<u8>(seed4 >> sh2);
-    seed5 = static_cast<u8>(seed5 >> sh1);
-    seed6 = static_cast<u8>(seed6 >> sh2);
-    seed7 = static_cast<u8>(seed7 >> sh1);
-    seed8 = static_cast<u8>(seed8 >> sh2);
-    seed9 = static_cast<u8>(seed9 >> sh3);
-    seed10 = static_cast<u8>(seed10 >> sh3);
-    seed11 = static_cast<u8>(seed11 >> sh3);
-    seed12 = static_cast<u8>(seed12 >> sh3);
-
-    s32 a = seed1 * x + seed2 * y + seed11 * z + (rnum >> 14);
-    s32 b = seed3 * x + seed4 * y + seed12 * z + (rnum >> 10);
-    s32 c = seed5 * x + seed6 * y + seed9 * z + (rnum >> 6);
-    s32 d = seed7 * x + seed8 * y + seed10 * z + (rnum >> 2);
+        const u32 rnum = hash52(seed);
+        std::array<u32, 8> seeds;
+        for (u32 i = 0; i < 8; ++i) {
+            const u32 value = (rnum >> (i * 4)) & 0xF;
+            seeds[i] = value * value;
+        }
 
-    a &= 0x3F;
-    b &= 0x3F;
-    c &= 0x3F;
-    d &= 0x3F;
+        u32 sh1, sh2;
+        if (seed & 1) {
+            sh1 = (seed & 2) ? 4 : 5;
+            sh2 = (partitionCount == 3) ? 6 : 5;
+        } else {
+            sh1 = (partitionCount == 3) ? 6 : 5;
+            sh2 = (seed & 2) ? 4 : 5;
+        }
+        for (u32 i = 0; i < 4; ++i) {
+            x_factors[i] = seeds[i * 2] >> sh1;
+            y_factors[i] = seeds[i * 2 + 1] >> sh2;
+        }
+        offsets = {rnum >> 14, rnum >> 10, rnum >> 6, rnum >> 2};
+    }
 
-    if (partitionCount < 4)
-        d = 0;
-    if (partitionCount < 3)
-        c = 0;
+    u32 Select(u32 x, u32 y) const {
+        if (partition_count == 1) {
+            return 0;
+        }
+        x <<= coordinate_shift;
+        y <<= coordinate_shift;
 
-    if (a >= b && a >= c && a >= d)
-        return 0;
-    else if (b >= c && b >= d)
-        return 1;
-    else if (c >= d)
-        return 2;
-    return 3;
-}
+        const u32 a = (x_factors[0] * x + y_factors[0] * y + offsets[0]) & 0x3F;
+        const u32 b = (x_factors[1] * x + y_factors[1] * y + offsets[1]) & 0x3F;
+        const u32 c =
+            partition_count < 3 ? 0 : (x_factors[2] * x + y_factors[2] * y + offsets[2]) & 0x3F;
+        const u32 d =
+            partition_count < 4 ? 0 : (x_factors[3] * x + y_factors[3] * y + offsets[3]) & 0x3F;
 
-static inline u32 Select2DPartition(s32 seed, s32 x, s32 y, s32 partitionCount, s32 smallBlock) {
-    return SelectPartition(seed, x, y, 0, partitionCount, smallBlock);
-}
+        if (a >= b && a >= c && a >= d)
+            return 0;
+        else if (b >= c && b >= d)
+            return 1;
+        else if (c >= d)
+            return 2;
+        return 3;
+    }
+
+private:
+    u32 partition_count;
+    u32 coordinate_shift;
+    std::array<u32, 4> x_factors{};
+    std::array<u32, 4> y_factors{};
+    std::array<u32, 4> offsets{};
+};
 
 // Section C.2.14
 static void ComputeEndpoints(Pixel& ep1, Pixel& ep2, const u32*& colorValues,
@@ -1419,8 +1491,56 @@ static void FillError(std::span<u32> outBuf, u32 blockWidth, u32 blockHeight) {
     }
 }
 
-static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
-                            const u32 blockHeight, std::span<u32, 12 * 12> outBuf) {
+// Reverses the bits of a 64-bit word
+static u64 ReverseBits(u64 value) {
+    value = ((value >> 1) & 0x5555555555555555ULL) | ((value & 0x5555555555555555ULL) << 1);
+    value = ((value >> 2) & 0x3333333333333333ULL) | ((value & 0x3333333333333333ULL) << 2);
+    value = ((value >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return Common::swap64(value);
+}
+
+// Color endpoints of a partition, expanded to 16 bits and stored in RGBA order
+struct alignas(16) EndpointPair {
+    std::array<u32, 4> low;
+    std::array<u32, 4> high;
+};
+
+// Interpolates a texel between its endpoints and converts the result to 8 bits per channel.
+// The conversion is the integer form of 255 * C / 65536 rounded to nearest.
+static u32 InterpolateTexel(const EndpointPair& endpoints, const std::array<u32, 4>& weights) {
+    u32 packed = 0;
+    for (u32 lane = 0; lane < 4; ++lane) {
+        const u32 weight = weights[lane];
+        const u32 C = (endpoints.low[lane] * (64 - weight) + endpoints.high[lane] * weight + 32) / 64;
+        packed |= ((C * 255 + 32768) >> 16) << (lane * 8);
+    }
+    return packed;
+}
+
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+static u32 InterpolateTexelSIMD(const EndpointPair& endpoints, __m128i weights) {
+    const __m128i low = _mm_load_si128(reinterpret_cast<const __m128i*>(endpoints.low.data()));
+    const __m128i high = _mm_load_si128(reinterpret_cast<const __m128i*>(endpoints.high.data()));
+    const __m128i inverse_weights = _mm_sub_epi32(_mm_set1_epi32(64), weights);
+    __m128i color = _mm_add_epi32(_mm_mullo_epi32(low, inverse_weights),
+                                  _mm_mullo_epi32(high, weights));
+    color = _mm_srli_epi32(_mm_add_epi32(color, _mm_set1_epi32(32)), 6);
+    color = _mm_mullo_epi32(color, _mm_set1_epi32(255));
+    color = _mm_srli_epi32(_mm_add_epi32(color, _mm_set1_epi32(32768)), 16);
+    color = _mm_packus_epi32(color, color);
+    color = _mm_packus_epi16(color, color);
+    return static_cast<u32>(_mm_cvtsi128_si32(color));
+}
+#endif
+
+// A footprint size of zero means the block dimensions are only known at runtime
+template <u32 FOOTPRINT_WIDTH, u32 FOOTPRINT_HEIGHT, bool USE_SIMD>
+static void DecompressBlock(std::span<const u8, 16> inBuf, u32 blockWidth, u32 blockHeight,
+                            std::span<u32, 12 * 12> outBuf) {
+    if constexpr (FOOTPRINT_WIDTH != 0) {
+        blockWidth = FOOTPRINT_WIDTH;
+        blockHeight = FOOTPRINT_HEIGHT;
+    }
     InputBitStream strm(inBuf);
     TexelWeightParams weightParams = DecodeBlockInfo(strm);
 
@@ -1472,11 +1592,6 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
     u32 partitionIndex{};
     u32 colorEndpointMode[4] = {0, 0, 0, 0};
 
-    // Define color data.
-    u8 colorEndpointData[16];
-    memset(colorEndpointData, 0, sizeof(colorEndpointData));
-    OutputBitStream colorEndpointStream(colorEndpointData, 16 * 8, 0);
-
     // Read extra config data...
     u32 baseCEM = 0;
     if (nPartitions == 1) {
@@ -1489,7 +1604,7 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
     u32 baseMode = (baseCEM & 3);
 
     // Remaining bits are color endpoint data...
-    u32 nWeightBits = weightParams.GetPackedBitSize();
+    u32 nWeightBits = weightParams.m_PackedBitSize;
     s32 remainingBits = 128 - nWeightBits - static_cast<int>(strm.GetBitsRead());
 
     // Consider extra bits prior to texel data...
@@ -1521,11 +1636,13 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
 
     // Read color data...
     u32 colorDataBits = remainingBits;
-    while (remainingBits > 0) {
-        u32 nb = (std::min)(remainingBits, 8);
-        u32 b = strm.ReadBits(nb);
-        colorEndpointStream.WriteBits(b, nb);
-        remainingBits -= 8;
+    u64 colorDataLo = 0;
+    u64 colorDataHi = 0;
+    if (remainingBits > 0) {
+        colorDataLo = strm.ReadBits64((std::min)(remainingBits, 64));
+        if (remainingBits > 64) {
+            colorDataHi = strm.ReadBits64(remainingBits - 64);
+        }
     }
 
     // Read the plane selection bits
@@ -1568,93 +1685,131 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
     for (u32 i = 0; i < nPartitions; i++) {
         assert(colorEndpointMode[i] < 16);
     }
-    assert(strm.GetBitsRead() + weightParams.GetPackedBitSize() == 128);
+    assert(strm.GetBitsRead() + weightParams.m_PackedBitSize == 128);
 
     // Decode both color data and texel weight data
     u32 colorValues[32]; // Four values, two endpoints, four maximum partitions
-    DecodeColorValues(colorValues, colorEndpointData, colorEndpointMode, nPartitions,
-                      colorDataBits);
+    DecodeColorValues(colorValues, InputBitStream(colorDataLo, colorDataHi), colorEndpointMode,
+                      nPartitions, colorDataBits);
 
-    Pixel endpoints[4][2];
+    EndpointPair endpoints[4];
     const u32* colorValuesPtr = colorValues;
     for (u32 i = 0; i < nPartitions; i++) {
-        ComputeEndpoints(endpoints[i][0], endpoints[i][1], colorValuesPtr, colorEndpointMode[i]);
+        Pixel ep1;
+        Pixel ep2;
+        ComputeEndpoints(ep1, ep2, colorValuesPtr, colorEndpointMode[i]);
+        for (u32 c = 0; c < 4; c++) {
+            // Pixels are stored as ARGB, endpoints as RGBA
+            const u32 lane = (c + 3) & 3;
+            endpoints[i].low[lane] = ReplicateByteTo16(ep1.Component(c));
+            endpoints[i].high[lane] = ReplicateByteTo16(ep2.Component(c));
+        }
     }
 
-    // Read the texel weight data..
-    std::array<u8, 16> texelWeightData;
-    std::ranges::copy(inBuf, texelWeightData.begin());
-
-    // Reverse everything
-    for (u32 i = 0; i < 8; i++) {
-// Taken from http://graphics.stanford.edu/~seander/bithacks.html#ReverseByteWith64Bits
-#define REVERSE_BYTE(b) (((b)*0x80200802ULL) & 0x0884422110ULL) * 0x0101010101ULL >> 32
-        u8 a = static_cast<u8>(REVERSE_BYTE(texelWeightData[i]));
-        u8 b = static_cast<u8>(REVERSE_BYTE(texelWeightData[15 - i]));
-#undef REVERSE_BYTE
-
-        texelWeightData[i] = b;
-        texelWeightData[15 - i] = a;
-    }
+    // The texel weight data is stored backwards from the end of the block
+    u64 blockLo = 0;
+    u64 blockHi = 0;
+    std::memcpy(&blockLo, inBuf.data(), sizeof(blockLo));
+    std::memcpy(&blockHi, inBuf.data() + sizeof(blockLo), sizeof(blockHi));
+    u64 weightLo = ReverseBits(blockHi);
+    u64 weightHi = ReverseBits(blockLo);
 
     // Make sure that higher non-texel bits are set to zero
-    const u32 clearByteStart = (weightParams.GetPackedBitSize() >> 3) + 1;
-    if (clearByteStart > 0 && clearByteStart <= texelWeightData.size()) {
-        texelWeightData[clearByteStart - 1] &=
-            static_cast<u8>((1 << (weightParams.GetPackedBitSize() % 8)) - 1);
-        std::memset(texelWeightData.data() + clearByteStart, 0,
-                    (std::min)(16U - clearByteStart, 16U));
+    const u32 packedBitSize = weightParams.m_PackedBitSize;
+    if (packedBitSize < 64) {
+        weightLo &= (u64{1} << packedBitSize) - 1;
+        weightHi = 0;
+    } else if (packedBitSize < 128) {
+        weightHi &= (u64{1} << (packedBitSize - 64)) - 1;
     }
 
     IntegerEncodedVector texelWeightValues;
 
-    InputBitStream weightStream(texelWeightData);
+    InputBitStream weightStream(weightLo, weightHi);
 
     DecodeIntegerSequence(texelWeightValues, weightStream, weightParams.m_MaxWeight,
                           weightParams.GetNumWeightValues());
 
     // Blocks can be at most 12x12, so we can have as many as 144 weights
     u32 weights[2][144];
-    UnquantizeTexelWeights(weights, texelWeightValues, weightParams, blockWidth, blockHeight);
+    UnquantizeTexelWeights<FOOTPRINT_WIDTH, FOOTPRINT_HEIGHT>(weights, texelWeightValues,
+                                                              weightParams, blockWidth, blockHeight);
 
     // Now that we have endpoints and weights, we can interpolate and generate
     // the proper decoding...
-    for (u32 j = 0; j < blockHeight; j++)
+    const PartitionSelector partitions(partitionIndex, nPartitions,
+                                       (blockHeight * blockWidth) < 32);
+    const bool dualPlane = weightParams.m_bDualPlane;
+    const u32 dualPlaneLane = planeIdx & 3;
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    alignas(16) std::array<u32, 4> dualPlaneMask{};
+    dualPlaneMask[dualPlaneLane] = ~0U;
+    const __m128i dualPlaneSelect =
+        _mm_load_si128(reinterpret_cast<const __m128i*>(dualPlaneMask.data()));
+#endif
+    for (u32 j = 0; j < blockHeight; j++) {
         for (u32 i = 0; i < blockWidth; i++) {
-            u32 partition = Select2DPartition(partitionIndex, i, j, nPartitions,
-                                              (blockHeight * blockWidth) < 32);
+            const u32 texel = j * blockWidth + i;
+            const u32 partition = partitions.Select(i, j);
             assert(partition < nPartitions);
 
-            Pixel p;
-            for (u32 c = 0; c < 4; c++) {
-                u32 C0 = endpoints[partition][0].Component(c);
-                C0 = ReplicateByteTo16(C0);
-                u32 C1 = endpoints[partition][1].Component(c);
-                C1 = ReplicateByteTo16(C1);
-
-                u32 plane = 0;
-                if (weightParams.m_bDualPlane && (((planeIdx + 1) & 3) == c)) {
-                    plane = 1;
-                }
-
-                u32 weight = weights[plane][j * blockWidth + i];
-                u32 C = (C0 * (64 - weight) + C1 * weight + 32) / 64;
-                if (C == 65535) {
-                    p.Component(c) = 255;
-                } else {
-                    double Cf = static_cast<double>(C);
-                    p.Component(c) = static_cast<u16>(255.0 * (Cf / 65536.0) + 0.5);
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+            if constexpr (USE_SIMD) {
+                __m128i texelWeights = _mm_set1_epi32(static_cast<int>(weights[0][texel]));
+                if (dualPlane) {
+                    texelWeights = _mm_blendv_epi8(
+                        texelWeights, _mm_set1_epi32(static_cast<int>(weights[1][texel])),
+                        dualPlaneSelect);
                 }
+                outBuf[texel] = InterpolateTexelSIMD(endpoints[partition], texelWeights);
+                continue;
             }
-
-            outBuf[j * blockWidth + i] = p.Pack();
+#endif
+            std::array<u32, 4> texelWeights;
+            texelWeights.fill(weights[0][texel]);
+            if (dualPlane) {
+                texelWeights[dualPlaneLane] = weights[1][texel];
+            }
+            outBuf[texel] = InterpolateTexel(endpoints[partition], texelWeights);
         }
+    }
+}
+
+using DecompressBlockFn = void (*)(std::span<const u8, 16>, u32, u32, std::span<u32, 12 * 12>);
+
+// Picks a decoder specialized for the most common footprints
+template <bool USE_SIMD>
+static DecompressBlockFn SelectFootprint(u32 block_width, u32 block_height) {
+    if (block_width == 4 && block_height == 4) {
+        return &DecompressBlock<4, 4, USE_SIMD>;
+    }
+    if (block_width == 6 && block_height == 6) {
+        return &DecompressBlock<6, 6, USE_SIMD>;
+    }
+    if (block_width == 8 && block_height == 8) {
+        return &DecompressBlock<8, 8, USE_SIMD>;
+    }
+    return &DecompressBlock<0, 0, USE_SIMD>;
+}
+
+static DecompressBlockFn GetDecompressBlock(u32 block_width, u32 block_height) {
+#if defined(ARCHITECTURE_x86_64)
+    if (Common::GetCPUCaps().sse4_1) {
+        return SelectFootprint<true>(block_width, block_height);
+    }
+    return SelectFootprint<false>(block_width, block_height);
+#elif defined(ARCHITECTURE_arm64)
+    return SelectFootprint<true>(block_width, block_height);
+#else
+    return SelectFootprint<false>(block_width, block_height);
+#endif
 }
 
 void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height, uint32_t depth,
                 uint32_t block_width, uint32_t block_height, std::span<uint8_t> output) {
     const u32 rows = Common::DivideUp(height, block_height);
     const u32 cols = Common::DivideUp(width, block_width);
+    const DecompressBlockFn decompress_block = GetDecompressBlock(block_width, block_height);
 
     Common::ThreadWorker& workers{GetThreadWorkers()};
 
@@ -1662,7 +1817,7 @@ void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height,
         const u32 depth_offset = z * height * width * 4;
         for (u32 y_index = 0; y_index < rows; ++y_index) {
             auto decompress_stride = [data, width, height, block_width, block_height, output, rows,
-                                      cols, z, depth_offset, y_index] {
+                                      cols, z, depth_offset, y_index, decompress_block] {
                 const u32 y = y_index * block_height;
                 for (u32 x_index = 0; x_index < cols; ++x_index) {
                     const u32 block_index = (z * rows * cols) + (y_index * cols) + x_index;
@@ -1672,7 +1827,7 @@ void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height,
 
                     // Blocks can be at most 12x12
                     std::array<u32, 12 * 12> uncompData;
-                    DecompressBlock(blockPtr, block_width, block_height, uncompData);
+                    decompress_block(blockPtr, block_width, block_height, uncompData);
 
                     u32 decompWidth = (std::min)(block_width, width - x);
                     u32 decompHeight = (std::min)(block_height, height - y);
@@ -1,11 +1,25 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <bit>
 #include <cmath>
 #include <cstring>
 #include <span>
 
+#if defined(ARCHITECTURE_x86_64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/bit_util.h"
@@ -13,6 +27,16 @@
 #include "video_core/gpu.h"
 #include "video_core/textures/decoders.h"
 
+#if defined(ARCHITECTURE_x86_64)
+#include "common/x64/cpu_detect.h"
+#endif
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif
+
 namespace Tegra::Texture {
 namespace {
 template <u32 mask>
@@ -33,6 +57,234 @@ void incrpdep(u32& value) {
     value = ((value | ~mask) + swizzled_incr) & mask;
 }
 
+/// Bytes in a GOB row that are stored contiguously in the swizzled layout.
+constexpr u32 GOB_CHUNK_SIZE = 16;
+constexpr u32 GOB_CHUNKS_PER_ROW = GOB_SIZE_X / GOB_CHUNK_SIZE;
+
+/// Swizzled offset of each row inside a GOB.
+constexpr std::array<u32, GOB_SIZE_Y> GOB_ROW_OFFSETS{
+    pdep<SWIZZLE_Y_BITS>(0), pdep<SWIZZLE_Y_BITS>(1), pdep<SWIZZLE_Y_BITS>(2),
+    pdep<SWIZZLE_Y_BITS>(3), pdep<SWIZZLE_Y_BITS>(4), pdep<SWIZZLE_Y_BITS>(5),
+    pdep<SWIZZLE_Y_BITS>(6), pdep<SWIZZLE_Y_BITS>(7),
+};
+
+/// Swizzled offset of each 16 byte chunk inside a GOB row.
+constexpr std::array<u32, GOB_CHUNKS_PER_ROW> GOB_CHUNK_OFFSETS{
+    pdep<SWIZZLE_X_BITS>(0 * GOB_CHUNK_SIZE),
+    pdep<SWIZZLE_X_BITS>(1 * GOB_CHUNK_SIZE),
+    pdep<SWIZZLE_X_BITS>(2 * GOB_CHUNK_SIZE),
+    pdep<SWIZZLE_X_BITS>(3 * GOB_CHUNK_SIZE),
+};
+
+// Pairs of rows share 32 contiguous bytes per chunk, and chunk pairs are 32 bytes apart, so each
+// GOB is made of 8 runs of 64 contiguous bytes holding two rows of 32 bytes each.
+static_assert(GOB_ROW_OFFSETS[1] == GOB_CHUNK_SIZE);
+static_assert(GOB_CHUNK_OFFSETS[1] == 2 * GOB_CHUNK_SIZE);
+static_assert(GOB_CHUNK_OFFSETS[3] - GOB_CHUNK_OFFSETS[2] == 2 * GOB_CHUNK_SIZE);
+
+/**
+ * Copies a horizontal run of whole GOBs between the swizzled and the linear layout.
+ *
+ * @param dst        Destination, the swizzled GOB when TO_LINEAR is true, the linear data otherwise
+ * @param src        Source, the linear data when TO_LINEAR is true, the swizzled GOB otherwise
+ * @param pitch      Distance in bytes between linear rows
+ * @param gob_stride Distance in bytes between horizontally adjacent swizzled GOBs
+ * @param num_gobs   Number of GOBs to copy
+ */
+using GobCopyFn = void (*)(u8* dst, const u8* src, u32 pitch, u32 gob_stride, u32 num_gobs);
+
+template <bool TO_LINEAR>
+void CopyGobsGeneric(u8* dst, const u8* src, u32 pitch, u32 gob_stride, u32 num_gobs) {
+    for (u32 gob = 0; gob < num_gobs; ++gob) {
+        u8* const gob_dst = dst + gob * (TO_LINEAR ? gob_stride : GOB_SIZE_X);
+        const u8* const gob_src = src + gob * (TO_LINEAR ? GOB_SIZE_X : gob_stride);
+        for (u32 row = 0; row < GOB_SIZE_Y; ++row) {
+            for (u32 chunk = 0; chunk < GOB_CHUNKS_PER_ROW; ++chunk) {
+                const u32 swizzled = GOB_ROW_OFFSETS[row] + GOB_CHUNK_OFFSETS[chunk];
+                const u32 linear = row * pitch + chunk * GOB_CHUNK_SIZE;
+                std::memcpy(gob_dst + (TO_LINEAR ? swizzled : linear),
+                            gob_src + (TO_LINEAR ? linear : swizzled), GOB_CHUNK_SIZE);
+            }
+        }
+    }
+}
+
+#if defined(ARCHITECTURE_x86_64)
+template <bool TO_LINEAR>
+void CopyGobsSSE2(u8* dst, const u8* src, u32 pitch, u32 gob_stride, u32 num_gobs) {
+    for (u32 gob = 0; gob < num_gobs; ++gob) {
+        u8* const gob_dst = dst + gob * (TO_LINEAR ? gob_stride : GOB_SIZE_X);
+        const u8* const gob_src = src + gob * (TO_LINEAR ? GOB_SIZE_X : gob_stride);
+        for (u32 row = 0; row < GOB_SIZE_Y; ++row) {
+            __m128i chunks[GOB_CHUNKS_PER_ROW];
+            for (u32 chunk = 0; chunk < GOB_CHUNKS_PER_ROW; ++chunk) {
+                const u32 offset = TO_LINEAR ? row * pitch + chunk * GOB_CHUNK_SIZE
+                                             : GOB_ROW_OFFSETS[row] + GOB_CHUNK_OFFSETS[chunk];
+                chunks[chunk] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(gob_src + offset));
+            }
+            for (u32 chunk = 0; chunk < GOB_CHUNKS_PER_ROW; ++chunk) {
+                const u32 offset = TO_LINEAR ? GOB_ROW_OFFSETS[row] + GOB_CHUNK_OFFSETS[chunk]
+                                             : row * pitch + chunk * GOB_CHUNK_SIZE;
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(gob_dst + offset), chunks[chunk]);
+            }
+        }
+    }
+}
+
+template <bool TO_LINEAR>
+TARGET_AVX2 void CopyGobsAVX2(u8* dst, const u8* src, u32 pitch, u32 gob_stride, u32 num_gobs) {
+    for (u32 gob = 0; gob < num_gobs; ++gob) {
+        u8* const gob_dst = dst + gob * (TO_LINEAR ? gob_stride : GOB_SIZE_X);
+        const u8* const gob_src = src + gob * (TO_LINEAR ? GOB_SIZE_X : gob_stride);
+        for (u32 row = 0; row < GOB_SIZE_Y; row += 2) {
+            for (u32 half = 0; half < 2; ++half) {
+                // A 64 byte swizzled run holds [row chunk0, row+1 chunk0, row chunk1, row+1 chunk1]
+                // while the linear rows hold [chunk0, chunk1], the transposition is symmetric.
+                const u32 swizzled = GOB_ROW_OFFSETS[row] + GOB_CHUNK_OFFSETS[half * 2];
+                const u32 linear = row * pitch + half * 2 * GOB_CHUNK_SIZE;
+                const u8* const src_lo = gob_src + (TO_LINEAR ? linear : swizzled);
+                const u8* const src_hi =
+                    gob_src + (TO_LINEAR ? linear + pitch : swizzled + 2 * GOB_CHUNK_SIZE);
+                u8* const dst_lo = gob_dst + (TO_LINEAR ? swizzled : linear);
+                u8* const dst_hi =
+                    gob_dst + (TO_LINEAR ? swizzled + 2 * GOB_CHUNK_SIZE : linear + pitch);
+                const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_lo));
+                const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_hi));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_lo),
+                                    _mm256_permute2x128_si256(lo, hi, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_hi),
+                                    _mm256_permute2x128_si256(lo, hi, 0x31));
+            }
+        }
+    }
+}
+#elif defined(ARCHITECTURE_arm64)
+template <bool TO_LINEAR>
+void CopyGobsNEON(u8* dst, const u8* src, u32 pitch, u32 gob_stride, u32 num_gobs) {
+    for (u32 gob = 0; gob < num_gobs; ++gob) {
+        u8* const gob_dst = dst + gob * (TO_LINEAR ? gob_stride : GOB_SIZE_X);
+        const u8* const gob_src = src + gob * (TO_LINEAR ? GOB_SIZE_X : gob_stride);
+        for (u32 row = 0; row < GOB_SIZE_Y; row += 2) {
+            for (u32 half = 0; half < 2; ++half) {
+                const u32 swizzled = GOB_ROW_OFFSETS[row] + GOB_CHUNK_OFFSETS[half * 2];
+                const u32 linear = row * pitch + half * 2 * GOB_CHUNK_SIZE;
+                if constexpr (TO_LINEAR) {
+                    const uint8x16x2_t lo = vld1q_u8_x2(gob_src + linear);
+                    const uint8x16x2_t hi = vld1q_u8_x2(gob_src + linear + pitch);
+                    vst1q_u8_x4(gob_dst + swizzled, uint8x16x4_t{{lo.val[0], hi.val[0], lo.val[1],
+                                                                  hi.val[1]}});
+                } else {
+                    const uint8x16x4_t run = vld1q_u8_x4(gob_src + swizzled);
+                    vst1q_u8_x2(gob_dst + linear, uint8x16x2_t{{run.val[0], run.val[2]}});
+                    vst1q_u8_x2(gob_dst + linear + pitch, uint8x16x2_t{{run.val[1], run.val[3]}});
+                }
+            }
+        }
+    }
+}
+#endif
+
+template <bool TO_LINEAR>
+GobCopyFn SelectGobCopy() {
+#if defined(ARCHITECTURE_x86_64)
+    if (Common::GetCPUCaps().avx2) {
+        return &CopyGobsAVX2<TO_LINEAR>;
+    }
+    return &CopyGobsSSE2<TO_LINEAR>;
+#elif defined(ARCHITECTURE_arm64)
+    return &CopyGobsNEON<TO_LINEAR>;
+#else
+    return &CopyGobsGeneric<TO_LINEAR>;
+#endif
+}
+
+template <bool TO_LINEAR>
+GobCopyFn GetGobCopy() {
+    static const GobCopyFn copy_gobs = SelectGobCopy<TO_LINEAR>();
+    return copy_gobs;
+}
+
+/**
+ * Transforms a range of lines inside one slice.
+ * Whole GOBs covered by the range are moved with the SIMD GOB kernels, the remaining edges are
+ * moved pixel by pixel.
+ */
+template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
+void SwizzleLines(std::span<u8> output, std::span<const u8> input, u32 offset_z, u32 linear_base,
+                  u32 pitch, u32 origin_x, u32 origin_y, u32 extent_x, u32 num_lines,
+                  u32 block_height, u32 block_size, u32 x_shift) {
+    const u32 block_height_mask = (1U << block_height) - 1;
+
+    const auto swizzle_pixels = [&](u32 line, u32 first_column, u32 end_column) {
+        const u32 y = line + origin_y;
+        const u32 swizzled_y = pdep<SWIZZLE_Y_BITS>(y);
+
+        const u32 block_y = y >> GOB_SIZE_Y_SHIFT;
+        const u32 offset_y = (block_y >> block_height) * block_size +
+                             ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
+
+        u32 swizzled_x = pdep<SWIZZLE_X_BITS>((first_column + origin_x) * BYTES_PER_PIXEL);
+        for (u32 column = first_column; column < end_column;
+             ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
+            const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
+            const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
+
+            const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
+            const u32 swizzled_offset = base_swizzled_offset + (swizzled_x | swizzled_y);
+
+            const u32 unswizzled_offset = linear_base + line * pitch + column * BYTES_PER_PIXEL;
+
+            u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
+            const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+
+            std::memcpy(dst, src, BYTES_PER_PIXEL);
+        }
+    };
+
+    // Pixels of non power of two sizes can straddle GOB boundaries, keep them on the slow path.
+    u32 first_gob = 0;
+    u32 end_gob = 0;
+    if constexpr (std::has_single_bit(BYTES_PER_PIXEL)) {
+        const u32 begin_x = origin_x * BYTES_PER_PIXEL;
+        const u32 end_x = (origin_x + extent_x) * BYTES_PER_PIXEL;
+        first_gob = Common::DivCeilLog2(begin_x, GOB_SIZE_X_SHIFT);
+        end_gob = end_x >> GOB_SIZE_X_SHIFT;
+    }
+    if (first_gob >= end_gob) {
+        for (u32 line = 0; line < num_lines; ++line) {
+            swizzle_pixels(line, 0, extent_x);
+        }
+        return;
+    }
+    const u32 first_fast_column = ((first_gob << GOB_SIZE_X_SHIFT) / BYTES_PER_PIXEL) - origin_x;
+    const u32 end_fast_column = ((end_gob << GOB_SIZE_X_SHIFT) / BYTES_PER_PIXEL) - origin_x;
+    const GobCopyFn copy_gobs = GetGobCopy<TO_LINEAR>();
+
+    u32 line = 0;
+    while (line < num_lines) {
+        const u32 y = line + origin_y;
+        if (y % GOB_SIZE_Y != 0 || line + GOB_SIZE_Y > num_lines) {
+            swizzle_pixels(line, 0, extent_x);
+            ++line;
+            continue;
+        }
+        const u32 block_y = y >> GOB_SIZE_Y_SHIFT;
+        const u32 offset_y = (block_y >> block_height) * block_size +
+                             ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
+        const u32 swizzled_offset = offset_z + offset_y + (first_gob << x_shift);
+        const u32 unswizzled_offset = linear_base + line * pitch + first_fast_column * BYTES_PER_PIXEL;
+        u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
+        const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+        copy_gobs(dst, src, pitch, 1U << x_shift, end_gob - first_gob);
+
+        for (u32 gob_line = line; gob_line < line + GOB_SIZE_Y; ++gob_line) {
+            swizzle_pixels(gob_line, 0, first_fast_column);
+            swizzle_pixels(gob_line, end_fast_column, extent_x);
+        }
+        line += GOB_SIZE_Y;
+    }
+}
+
 template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
 void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height, u32 depth,
                  u32 block_height, u32 block_depth, u32 stride) {
@@ -51,7 +303,6 @@ void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32
     const u32 slice_size =
         Common::DivCeilLog2(height, block_height + GOB_SIZE_Y_SHIFT) * block_size;
 
-    const u32 block_height_mask = (1U << block_height) - 1;
     const u32 block_depth_mask = (1U << block_depth) - 1;
     const u32 x_shift = GOB_SIZE_SHIFT + block_height + block_depth;
 
@@ -59,32 +310,9 @@ void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32
         const u32 z = slice + origin_z;
         const u32 offset_z = (z >> block_depth) * slice_size +
                              ((z & block_depth_mask) << (GOB_SIZE_SHIFT + block_height));
-        for (u32 line = 0; line < height; ++line) {
-            const u32 y = line + origin_y;
-            const u32 swizzled_y = pdep<SWIZZLE_Y_BITS>(y);
-
-            const u32 block_y = y >> GOB_SIZE_Y_SHIFT;
-            const u32 offset_y = (block_y >> block_height) * block_size +
-                                 ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
-
-            u32 swizzled_x = pdep<SWIZZLE_X_BITS>(origin_x * BYTES_PER_PIXEL);
-            for (u32 column = 0; column < width;
-                 ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
-                const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
-                const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
-
-                const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
-                const u32 swizzled_offset = base_swizzled_offset + (swizzled_x | swizzled_y);
-
-                const u32 unswizzled_offset =
-                    slice * pitch * height + line * pitch + column * BYTES_PER_PIXEL;
-
-                u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
-                const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
-
-                std::memcpy(dst, src, BYTES_PER_PIXEL);
-            }
-        }
+        SwizzleLines<TO_LINEAR, BYTES_PER_PIXEL>(output, input, offset_z, slice * pitch * height,
+                                                 pitch, origin_x, origin_y, width, height,
+                                                 block_height, block_size, x_shift);
     }
 }
 
@@ -106,7 +334,6 @@ void SwizzleSubrectImpl(std::span<u8> output, std::span<const u8> input, u32 wid
     const u32 slice_size =
         Common::DivCeilLog2(height, block_height + GOB_SIZE_Y_SHIFT) * block_size;
 
-    const u32 block_height_mask = (1U << block_height) - 1;
     const u32 block_depth_mask = (1U << block_depth) - 1;
     const u32 x_shift = GOB_SIZE_SHIFT + block_height + block_depth;
 
@@ -118,32 +345,9 @@ void SwizzleSubrectImpl(std::span<u8> output, std::span<const u8> input, u32 wid
         const u32 offset_z = (z >> block_depth) * slice_size +
                              ((z & block_depth_mask) << (GOB_SIZE_SHIFT + block_height));
         const u32 lines_in_y = (std::min)(unprocessed_lines, extent_y);
-        for (u32 line = 0; line < lines_in_y; ++line) {
-            const u32 y = line + origin_y;
-            const u32 swizzled_y = pdep<SWIZZLE_Y_BITS>(y);
-
-            const u32 block_y = y >> GOB_SIZE_Y_SHIFT;
-            const u32 offset_y = (block_y >> block_height) * block_size +
-                                 ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
-
-            u32 swizzled_x = pdep<SWIZZLE_X_BITS>(origin_x * BYTES_PER_PIXEL);
-            for (u32 column = 0; column < extent_x;
-                 ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
-                const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
-                const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
-
-                const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
-                const u32 swizzled_offset = base_swizzled_offset + (swizzled_x | swizzled_y);
-
-                const u32 unswizzled_offset =
-                    slice * pitch * height + line * pitch + column * BYTES_PER_PIXEL;
-
-                u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
-                const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
-
-                std::memcpy(dst, src, BYTES_PER_PIXEL);
-            }
-        }
+        SwizzleLines<TO_LINEAR, BYTES_PER_PIXEL>(output, input, offset_z, slice * pitch * height,
+                                                 pitch, origin_x, origin_y, extent_x, lines_in_y,
+                                                 block_height, block_size, x_shift);
         unprocessed_lines -= lines_in_y;
         if (unprocessed_lines == 0) {
             return;
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -29,7 +32,8 @@ std::unique_ptr<VideoCore::RendererBase> CreateRenderer(
         return std::make_unique<Vulkan::RendererVulkan>(emu_window, device_memory, gpu,
                                                         std::move(context));
     case Settings::RendererBackend::Null:
-        return std::make_unique<Null::RendererNull>(emu_window, gpu, std::move(context));
+        return std::make_unique<Null::RendererNull>(emu_window, device_memory, gpu,
+                                                    std::move(context));
     default:
         return nullptr;
     }
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Builds the SPIR-V of every pipeline in a recorded pipeline cache ahead of time, without a GPU
+// or a window. The result is picked up by the Vulkan renderer on machines with the same device.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/container/static_vector.hpp>
+
+#include "common/fs/path_util.h"
+#include "common/logging/backend.h"
+#include "common/logging/log.h"
+#include "common/scm_rev.h"
+#include "common/thread_worker.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
+#include "video_core/renderer_vulkan/vk_pipeline_cache.h"
+#include "video_core/renderer_vulkan/vk_spirv_cache.h"
+#include "video_core/shader_environment.h"
+
+#undef _UNICODE
+#include <getopt.h>
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+static void PrintHelp(const char* argv0) {
+    std::cout << "Usage: " << argv0
+              << " [options] <directory>\n"
+                 "Precompiles the Vulkan pipeline cache found in the shader directory of a title\n"
+                 "-h, --help            Display this help and exit\n"
+                 "-j, --jobs            Number of pipelines compiled in parallel\n"
+                 "-o, --output          SPIR-V cache to write, defaults to the given directory\n"
+                 "-t, --target          Device description to compile for, written by the\n"
+                 "                      emulator next to the pipeline cache\n"
+                 "-v, --version         Output version information and exit\n";
+}
+
+static void PrintVersion() {
+    std::cout << "Eden " << Common::g_scm_branch << " " << Common::g_scm_desc << std::endl;
+}
+
+static bool CompilePipeline(const VideoCommon::PipelineCacheRecord& record,
+                            const Vulkan::SpirvCacheTarget& target,
+                            Vulkan::SpirvCache& spirv_cache,
+                            Shader::Maxwell::TranslationCache& translation_cache) try {
+    std::vector<VideoCommon::FileEnvironment> envs{record.DecodeEnvironments()};
+    if (envs.empty()) {
+        return false;
+    }
+    Vulkan::ShaderPools pools;
+    if (record.IsCompute()) {
+        Vulkan::ComputePipelineCacheKey key;
+        if (!record.ReadKey(key)) {
+            return false;
+        }
+        Vulkan::ComputePipelineShader shader{Vulkan::TranslateComputePipeline(
+            pools, key, envs.front(), target.profile, target.host_info, true, &spirv_cache,
+            &translation_cache)};
+        spirv_cache.Insert(key, 0, std::move(shader.stage));
+        return true;
+    }
+    Vulkan::GraphicsPipelineCacheKey key;
+    if (!record.ReadKey(key)) {
+        return false;
+    }
+    boost::container::static_vector<Shader::Environment*, Vulkan::Maxwell::MaxShaderProgram>
+        env_ptrs;
+    for (auto& env : envs) {
+        env_ptrs.push_back(&env);
+    }
+    Vulkan::GraphicsPipelineShaders shaders{Vulkan::TranslateGraphicsPipeline(
+        pools, key, std::span(env_ptrs.data(), env_ptrs.size()), target.profile,
+        target.host_info, true, &spirv_cache, &translation_cache)};
+    for (size_t stage = 0; stage < shaders.stages.size(); ++stage) {
+        if (shaders.enabled[stage]) {
+            spirv_cache.Insert(key, stage, std::move(shaders.stages[stage]));
+        }
+    }
+    return true;
+} catch (const Shader::Exception& exception) {
+    LOG_ERROR(Render_Vulkan, "{}", exception.what());
+    return false;
+}
+
+int main(int argc, char** argv) {
+    Common::Log::Initialize();
+    Common::Log::SetColorConsoleBackendEnabled(true);
+    Common::Log::Start();
+
+    int option_index = 0;
+    std::optional<std::filesystem::path> output_path;
+    std::optional<std::filesystem::path> target_path;
+    std::filesystem::path directory;
+    size_t num_jobs = std::max(std::thread::hardware_concurrency(), 1U);
+
+    static struct option long_options[] = {
+        // clang-format off
+        {"help", no_argument, 0, 'h'},
+        {"jobs", required_argument, 0, 'j'},
+        {"output", required_argument, 0, 'o'},
+        {"target", required_argument, 0, 't'},
+        {"version", no_argument, 0, 'v'},
+        {0, 0, 0, 0},
+        // clang-format on
+    };
+
+    while (optind < argc) {
+        int arg = getopt_long(argc, argv, "hj:o:t:v", long_options, &option_index);
+        if (arg != -1) {
+            switch (static_cast<char>(arg)) {
+            case 'h':
+                PrintHelp(argv[0]);
+                return 0;
+            case 'j':
+                num_jobs = std::max(std::atoi(optarg), 1);
+                break;
+            case 'o':
+                output_path = optarg;
+                break;
+            case 't':
+                target_path = optarg;
+                break;
+            case 'v':
+                PrintVersion();
+                return 0;
+            default:
+                PrintHelp(argv[0]);
+                return -1;
+            }
+        } else {
+            directory = argv[optind];
+            optind++;
+        }
+    }
+    if (directory.empty()) {
+        PrintHelp(argv[0]);
+        return -1;
+    }
+
+    const auto target{
+        Vulkan::LoadSpirvCacheTarget(target_path.value_or(directory /
+                                                          Vulkan::SPIRV_CACHE_TARGET_FILENAME))};
+    if (!target) {
+        std::cerr << "No device description found, run the title once on the target device\n";
+        return -1;
+    }
+    // Shaders are emitted with the resolution scaling and loop safety checks of the emulator
+    Vulkan::ApplySpirvCacheTargetSettings(*target);
+
+    const auto pipeline_cache_path{directory / "vulkan.bin"};
+    const std::vector<VideoCommon::PipelineCacheRecord> records{
+        VideoCommon::ReadPipelines(pipeline_cache_path, Vulkan::PIPELINE_CACHE_VERSION)};
+    if (records.empty()) {
+        std::cerr << "No pipelines found in " << Common::FS::PathToUTF8String(pipeline_cache_path)
+                  << "\n";
+        return -1;
+    }
+
+    // Stages compiled by an earlier run are kept
+    const auto output{output_path.value_or(directory / Vulkan::SPIRV_CACHE_FILENAME)};
+    Vulkan::SpirvCache spirv_cache;
+    spirv_cache.Load(output, Vulkan::PIPELINE_CACHE_VERSION, *target);
+    Shader::Maxwell::TranslationCache translation_cache;
+
+    const auto start{std::chrono::steady_clock::now()};
+    std::atomic<size_t> num_failed{};
+    {
+        Common::ThreadWorker workers(num_jobs, "PipelinePrecompile");
+        for (const VideoCommon::PipelineCacheRecord& record : records) {
+            workers.QueueWork([&record, &target, &spirv_cache, &translation_cache, &num_failed] {
+                if (!CompilePipeline(record, *target, spirv_cache, translation_cache)) {
+                    ++num_failed;
+                }
+            });
+        }
+        workers.WaitForRequests();
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    spirv_cache.Save(output, Vulkan::PIPELINE_CACHE_VERSION, *target);
+    std::cout << "Compiled " << records.size() - num_failed << " of " << records.size()
+              << " pipelines (" << spirv_cache.Size() << " shader stages) in " << elapsed.count()
+              << "s to " << Common::FS::PathToUTF8String(output) << "\n";
+    return num_failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,640 @@
+// SPDX-FileCopyrightText: Copyright 2026 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Benchmarks the shader recompiler on the pipelines of a recorded pipeline cache, without a GPU or
+// a window. Every pipeline is translated and emitted like the renderer does when it builds it, so
+// the results can be compared between builds.
+//
+// Only Vulkan pipeline caches are read. GLSL and GLASM are emitted for their pipelines with the
+// runtime info of the Vulkan renderer and, unless a target is given, an approximate OpenGL device.
+// Those results track changes to the recompiler, they are not the times of the OpenGL renderer.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <boost/container/static_vector.hpp>
+#include <fmt/format.h>
+
+#include "common/fs/path_util.h"
+#include "common/logging/backend.h"
+#include "common/logging/log.h"
+#include "common/scm_rev.h"
+#include "common/settings.h"
+#include "common/thread_worker.h"
+#include "shader_recompiler/arena.h"
+#include "shader_recompiler/backend/glasm/emit_glasm.h"
+#include "shader_recompiler/backend/glsl/emit_glsl.h"
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/compile_statistics.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/frontend/maxwell/translation_cache.h"
+#include "video_core/renderer_vulkan/vk_pipeline_cache.h"
+#include "video_core/renderer_vulkan/vk_spirv_cache.h"
+#include "video_core/shader_environment.h"
+
+#ifdef _WIN32
+#include <windows.h>
+// windows.h has to be included first
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#undef _UNICODE
+#include <getopt.h>
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+namespace {
+
+enum class Backend {
+    SpirV,
+    Glsl,
+    Glasm,
+};
+
+struct Options {
+    Backend backend{Backend::SpirV};
+    std::vector<size_t> jobs;
+    size_t iterations{3};
+    bool optimize{true};
+    bool reuse_decoded{};
+    bool collect_statistics{};
+    std::optional<std::filesystem::path> target_path;
+    std::optional<std::filesystem::path> csv_path;
+    std::optional<std::filesystem::path> baseline_path;
+    double tolerance{5.0};
+};
+
+/// Pipeline of the cache with its environments decoded ahead of time, so decompression is not
+/// part of the measurements
+struct Pipeline {
+    std::vector<VideoCommon::FileEnvironment> envs;
+    bool is_compute{};
+    Vulkan::ComputePipelineCacheKey compute_key{};
+    Vulkan::GraphicsPipelineCacheKey graphics_key{};
+};
+
+struct RunResult {
+    Backend backend;
+    size_t jobs;
+    size_t num_pipelines;
+    size_t num_failed;
+    double seconds;
+
+    double PipelinesPerSecond() const {
+        return seconds > 0.0 ? static_cast<double>(num_pipelines) / seconds : 0.0;
+    }
+};
+
+std::string_view BackendName(Backend backend) {
+    switch (backend) {
+    case Backend::SpirV:
+        return "spirv";
+    case Backend::Glsl:
+        return "glsl";
+    case Backend::Glasm:
+        return "glasm";
+    }
+    return "unknown";
+}
+
+std::optional<Backend> ParseBackend(std::string_view name) {
+    for (const Backend backend : {Backend::SpirV, Backend::Glsl, Backend::Glasm}) {
+        if (name == BackendName(backend)) {
+            return backend;
+        }
+    }
+    return std::nullopt;
+}
+
+/// Parses a comma separated list of thread counts
+std::vector<size_t> ParseJobs(const char* list) {
+    std::vector<size_t> jobs;
+    std::stringstream stream{list};
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        jobs.push_back(static_cast<size_t>(std::max(std::atoi(item.c_str()), 1)));
+    }
+    return jobs;
+}
+
+/// Host a desktop GPU presents to the Vulkan renderer, used when no target is given so results
+/// do not depend on the machine running the benchmark
+Vulkan::SpirvCacheTarget DefaultVulkanTarget() {
+    return {
+        .profile{
+            .supported_spirv = 0x00010600,
+            .unified_descriptor_binding = true,
+            .support_descriptor_aliasing = true,
+            .support_int8 = true,
+            .support_int16 = true,
+            .support_int64 = true,
+            .support_vertex_instance_id = false,
+            .support_float_controls = true,
+            .support_separate_denorm_behavior = true,
+            .support_separate_rounding_mode = true,
+            .support_fp16_denorm_preserve = true,
+            .support_fp32_denorm_preserve = true,
+            .support_fp16_denorm_flush = false,
+            .support_fp32_denorm_flush = true,
+            .support_fp16_signed_zero_nan_preserve = true,
+            .support_fp32_signed_zero_nan_preserve = true,
+            .support_fp64_signed_zero_nan_preserve = true,
+            .support_explicit_workgroup_layout = true,
+            .support_vote = true,
+            .support_viewport_index_layer_non_geometry = true,
+            .support_viewport_mask = false,
+            .support_typeless_image_loads = true,
+            .support_demote_to_helper_invocation = true,
+            .support_int64_atomics = true,
+            .support_derivative_control = true,
+            .support_geometry_shader_passthrough = false,
+            .support_native_ndc = true,
+            .support_scaled_attributes = true,
+            .support_multi_viewport = true,
+            .support_geometry_streams = true,
+            .warp_size_potentially_larger_than_guest = false,
+            .lower_left_origin_mode = false,
+            .need_declared_frag_colors = false,
+            .min_ssbo_alignment = 16,
+            .max_user_clip_distances = 8,
+        },
+        .host_info{
+            .support_float64 = true,
+            .support_float16 = true,
+            .support_int64 = true,
+            .needs_demote_reorder = false,
+            .support_snorm_render_buffer = true,
+            .support_viewport_index_layer = true,
+            .min_ssbo_alignment = 16,
+            .support_geometry_shader_passthrough = false,
+            .support_conditional_barrier = true,
+        },
+    };
+}
+
+/// Approximation of the profile the OpenGL renderer builds for a desktop GPU. The OpenGL renderer
+/// does not record its target, so this is kept in line with gl_shader_cache.cpp by hand.
+Vulkan::SpirvCacheTarget DefaultOpenGLTarget() {
+    return {
+        .profile{
+            .supported_spirv = 0x00010000,
+            .support_int64 = true,
+            .support_vertex_instance_id = true,
+            .support_vote = true,
+            .support_viewport_index_layer_non_geometry = true,
+            .support_typeless_image_loads = true,
+            .support_derivative_control = true,
+            .support_native_ndc = true,
+            .support_gl_nv_gpu_shader_5 = true,
+            .support_gl_texture_shadow_lod = true,
+            .support_gl_variable_aoffi = true,
+            .support_gl_sparse_textures = true,
+            .support_gl_derivative_control = true,
+            .support_geometry_streams = true,
+            .lower_left_origin_mode = true,
+            .need_declared_frag_colors = true,
+            .has_broken_spirv_clamp = true,
+            .has_broken_unsigned_image_offsets = true,
+            .has_broken_signed_operations = true,
+            .ignore_nan_fp_comparisons = true,
+            .gl_max_compute_smem_size = 0xc000,
+            .min_ssbo_alignment = 16,
+            .max_user_clip_distances = 8,
+        },
+        .host_info{
+            .support_float64 = true,
+            .support_float16 = false,
+            .support_int64 = true,
+            .needs_demote_reorder = false,
+            .support_snorm_render_buffer = false,
+            .support_viewport_index_layer = true,
+            .min_ssbo_alignment = 16,
+            .support_geometry_shader_passthrough = false,
+            .support_conditional_barrier = true,
+        },
+    };
+}
+
+/// Returns the peak resident memory of the process since it started in bytes, zero when it is not
+/// known
+u64 PeakMemoryUsage() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return static_cast<u64>(counters.PeakWorkingSetSize);
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<u64>(usage.ru_maxrss);
+#else
+    return static_cast<u64>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+std::vector<Pipeline> DecodePipelines(const std::vector<VideoCommon::PipelineCacheRecord>& records,
+                                      size_t& num_invalid) {
+    std::vector<Pipeline> pipelines;
+    pipelines.reserve(records.size());
+    for (const VideoCommon::PipelineCacheRecord& record : records) {
+        Pipeline pipeline{
+            .envs = record.DecodeEnvironments(),
+            .is_compute = record.IsCompute(),
+        };
+        const bool has_key{pipeline.is_compute ? record.ReadKey(pipeline.compute_key)
+                                               : record.ReadKey(pipeline.graphics_key)};
+        if (pipeline.envs.empty() || !has_key) {
+            ++num_invalid;
+            continue;
+        }
+        pipelines.push_back(std::move(pipeline));
+    }
+    return pipelines;
+}
+
+/// Emits code for a translated program, returns the size of the code in bytes
+size_t EmitProgram(Backend backend, const Shader::Profile& profile,
+                   const Shader::RuntimeInfo& runtime_info, Shader::IR::Program& program,
+                   Shader::Backend::Bindings& bindings, bool optimize) {
+    switch (backend) {
+    case Backend::SpirV:
+        return Shader::Backend::SPIRV::EmitSPIRV(profile, runtime_info, program, bindings,
+                                                 optimize)
+                   .size() *
+               sizeof(u32);
+    case Backend::Glsl:
+        return Shader::Backend::GLSL::EmitGLSL(profile, runtime_info, program, bindings).size();
+    case Backend::Glasm: {
+        // The OpenGL renderer only falls back to global memory past the device limit
+        Shader::RuntimeInfo glasm_info{runtime_info};
+        glasm_info.glasm_use_storage_buffers = true;
+        return Shader::Backend::GLASM::EmitGLASM(profile, glasm_info, program, bindings).size();
+    }
+    }
+    return 0;
+}
+
+bool CompilePipeline(Vulkan::ShaderPools& pools, Pipeline& pipeline,
+                     const Vulkan::SpirvCacheTarget& target, const Options& options,
+                     Shader::Maxwell::TranslationCache* translation_cache) try {
+    pools.ReleaseContents();
+    const Shader::ArenaScope arena_scope{&pools.arena};
+    Shader::CompileStatistics::PipelineTimer pipeline_timer;
+    if (pipeline.is_compute) {
+        Shader::IR::Program program{Vulkan::TranslateComputeProgram(
+            pools, pipeline.compute_key, pipeline.envs.front(), target.host_info,
+            translation_cache)};
+        Shader::Backend::Bindings bindings;
+        pipeline_timer.AddOutputSize(EmitProgram(options.backend, target.profile, {}, program,
+                                                 bindings, options.optimize));
+        return true;
+    }
+    boost::container::static_vector<Shader::Environment*, Vulkan::Maxwell::MaxShaderProgram>
+        env_ptrs;
+    for (auto& env : pipeline.envs) {
+        env_ptrs.push_back(&env);
+    }
+    const Vulkan::GraphicsPipelineCacheKey& key{pipeline.graphics_key};
+    Vulkan::GraphicsPipelineShaders shaders{
+        Vulkan::TranslateGraphicsPrograms(pools, key, std::span(env_ptrs.data(), env_ptrs.size()),
+                                          target.host_info, translation_cache)};
+    const Shader::IR::Program* previous_stage{};
+    Shader::Backend::Bindings bindings;
+    for (size_t stage_index = 0; stage_index < shaders.enabled.size(); ++stage_index) {
+        if (!shaders.enabled[stage_index]) {
+            continue;
+        }
+        Shader::IR::Program& program{shaders.programs[stage_index + 1]};
+        const auto runtime_info{
+            Vulkan::MakeGraphicsRuntimeInfo(shaders.programs, key, program, previous_stage)};
+        if (options.backend != Backend::Glasm) {
+            Shader::Maxwell::ConvertLegacyToGeneric(program, runtime_info);
+        }
+        pipeline_timer.AddOutputSize(EmitProgram(options.backend, target.profile, runtime_info,
+                                                 program, bindings, options.optimize));
+        previous_stage = &program;
+    }
+    return true;
+} catch (const Shader::Exception& exception) {
+    LOG_ERROR(Shader, "{}", exception.what());
+    return false;
+}
+
+RunResult Run(std::vector<Pipeline>& pipelines, const Vulkan::SpirvCacheTarget& target,
+           const Options& options, size_t num_jobs) {
+    std::optional<Shader::Maxwell::TranslationCache> translation_cache;
+    if (options.reuse_decoded) {
+        translation_cache.emplace();
+    }
+    Shader::Maxwell::TranslationCache* const translation_cache_ptr{
+        translation_cache ? &*translation_cache : nullptr};
+
+    std::atomic<size_t> num_failed{};
+    const auto start{std::chrono::steady_clock::now()};
+    {
+        // Like the renderer, every worker reuses its pools between pipelines
+        Common::StatefulThreadWorker<Vulkan::ShaderPools> workers(
+            num_jobs, "ShaderBench", [] { return Vulkan::ShaderPools(); });
+        for (Pipeline& pipeline : pipelines) {
+            workers.QueueWork([&pipeline, &target, &options, translation_cache_ptr,
+                               &num_failed](Vulkan::ShaderPools* pools) {
+                if (!CompilePipeline(*pools, pipeline, target, options, translation_cache_ptr)) {
+                    ++num_failed;
+                }
+            });
+        }
+        workers.WaitForRequests();
+    }
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    return {
+        .backend = options.backend,
+        .jobs = num_jobs,
+        .num_pipelines = pipelines.size(),
+        .num_failed = num_failed,
+        .seconds = elapsed.count(),
+    };
+}
+
+std::string ResultsCsv(const std::vector<RunResult>& results) {
+    std::string csv{"backend,jobs,pipelines,failed,seconds,pipelines_per_second\n"};
+    for (const RunResult& result : results) {
+        csv += fmt::format("{},{},{},{},{:.6f},{:.3f}\n", BackendName(result.backend),
+                           result.jobs, result.num_pipelines, result.num_failed, result.seconds,
+                           result.PipelinesPerSecond());
+    }
+    return csv;
+}
+
+/// Compares the throughput of results with a CSV written by an earlier run on the same machine.
+/// Returns false when any of them is slower than the tolerance allows, when the baseline ran on a
+/// different number of pipelines or when no result has a baseline.
+bool CheckBaseline(const std::filesystem::path& path, const std::vector<RunResult>& results,
+                   double tolerance) {
+    std::ifstream file{path};
+    if (!file) {
+        std::cerr << "Failed to open baseline " << Common::FS::PathToUTF8String(path) << "\n";
+        return false;
+    }
+    bool passed{true};
+    size_t num_compared{};
+    std::string line;
+    std::getline(file, line);
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields;
+        std::stringstream stream{line};
+        std::string field;
+        while (std::getline(stream, field, ',')) {
+            fields.push_back(field);
+        }
+        if (fields.size() < 6) {
+            continue;
+        }
+        const auto jobs{static_cast<size_t>(std::atoi(fields[1].c_str()))};
+        const double baseline_rate{std::atof(fields[5].c_str())};
+        const auto it{std::ranges::find_if(results, [&](const RunResult& result) {
+            return BackendName(result.backend) == fields[0] && result.jobs == jobs;
+        })};
+        if (it == results.end()) {
+            continue;
+        }
+        ++num_compared;
+        const auto num_pipelines{static_cast<size_t>(std::atoi(fields[2].c_str()))};
+        if (num_pipelines != it->num_pipelines) {
+            // A different cache or cache version, the rates do not measure the same work
+            std::cout << fmt::format("{} with {} jobs: baseline ran {} pipelines, this run {}\n",
+                                     fields[0], jobs, num_pipelines, it->num_pipelines);
+            passed = false;
+            continue;
+        }
+        const double rate{it->PipelinesPerSecond()};
+        const double change{baseline_rate > 0.0 ? (rate / baseline_rate - 1.0) * 100.0 : 0.0};
+        const bool is_slower{change < -tolerance};
+        std::cout << fmt::format("{} with {} jobs: {:.1f} pipelines/s, baseline {:.1f} ({:+.1f}%)"
+                                 "{}\n",
+                                 fields[0], jobs, rate, baseline_rate, change,
+                                 is_slower ? ", slower than allowed" : "");
+        passed &= !is_slower;
+    }
+    if (num_compared == 0) {
+        std::cerr << "No result has a baseline in " << Common::FS::PathToUTF8String(path) << "\n";
+        return false;
+    }
+    return passed;
+}
+
+void PrintHelp(const char* argv0) {
+    std::cout << "Usage: " << argv0
+              << " [options] <pipeline cache>\n"
+                 "Benchmarks the shader recompiler on every pipeline of a Vulkan pipeline cache\n"
+                 "-b, --backend         Backend to emit code with: spirv (default), glsl, glasm.\n"
+                 "                      GLSL and GLASM use the pipelines of the Vulkan cache and\n"
+                 "                      an approximate OpenGL device, not the OpenGL renderer's\n"
+                 "-c, --csv             File to write the results to as comma separated values\n"
+                 "-h, --help            Display this help and exit\n"
+                 "-j, --jobs            Comma separated thread counts to run with, defaults to\n"
+                 "                      the number of hardware threads\n"
+                 "-n, --iterations      Runs per thread count, the fastest one is reported\n"
+                 "-r, --reuse-decoded   Share decoded programs between pipelines, like the\n"
+                 "                      renderer does\n"
+                 "-s, --no-optimize     Do not run the SPIR-V optimizer\n"
+                 "-S, --statistics      Time each compilation phase in an extra run after the\n"
+                 "                      measured ones, which are never instrumented\n"
+                 "-t, --target          Device description to compile for, written by the\n"
+                 "                      Vulkan renderer next to the pipeline cache. Defaults to\n"
+                 "                      a fixed desktop GPU\n"
+                 "-B, --baseline        Results of an earlier run on the same machine to compare\n"
+                 "                      against, fails when the throughput drops by more than\n"
+                 "                      the tolerance\n"
+                 "-T, --tolerance       Allowed throughput drop in percent, defaults to 5\n"
+                 "-v, --version         Output version information and exit\n";
+}
+
+void PrintVersion() {
+    std::cout << "Eden " << Common::g_scm_branch << " " << Common::g_scm_desc << std::endl;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    Common::Log::Initialize();
+    Common::Log::SetColorConsoleBackendEnabled(true);
+    Common::Log::Start();
+
+    int option_index = 0;
+    Options options;
+    std::filesystem::path cache_path;
+
+    static struct option long_options[] = {
+        // clang-format off
+        {"backend", required_argument, 0, 'b'},
+        {"csv", required_argument, 0, 'c'},
+        {"help", no_argument, 0, 'h'},
+        {"jobs", required_argument, 0, 'j'},
+        {"iterations", required_argument, 0, 'n'},
+        {"reuse-decoded", no_argument, 0, 'r'},
+        {"no-optimize", no_argument, 0, 's'},
+        {"statistics", no_argument, 0, 'S'},
+        {"target", required_argument, 0, 't'},
+        {"baseline", required_argument, 0, 'B'},
+        {"tolerance", required_argument, 0, 'T'},
+        {"version", no_argument, 0, 'v'},
+        {0, 0, 0, 0},
+        // clang-format on
+    };
+
+    while (optind < argc) {
+        int arg = getopt_long(argc, argv, "b:c:hj:n:rsSt:B:T:v", long_options, &option_index);
+        if (arg != -1) {
+            switch (static_cast<char>(arg)) {
+            case 'b': {
+                const std::optional<Backend> backend{ParseBackend(optarg)};
+                if (!backend) {
+                    PrintHelp(argv[0]);
+                    return -1;
+                }
+                options.backend = *backend;
+                break;
+            }
+            case 'c':
+                options.csv_path = optarg;
+                break;
+            case 'h':
+                PrintHelp(argv[0]);
+                return 0;
+            case 'j':
+                options.jobs = ParseJobs(optarg);
+                break;
+            case 'n':
+                options.iterations = std::max(std::atoi(optarg), 1);
+                break;
+            case 'r':
+                options.reuse_decoded = true;
+                break;
+            case 's':
+                options.optimize = false;
+                break;
+            case 'S':
+                options.collect_statistics = true;
+                break;
+            case 't':
+                options.target_path = optarg;
+                break;
+            case 'B':
+                options.baseline_path = optarg;
+                break;
+            case 'T':
+                options.tolerance = std::atof(optarg);
+                break;
+            case 'v':
+                PrintVersion();
+                return 0;
+            default:
+                PrintHelp(argv[0]);
+                return -1;
+            }
+        } else {
+            cache_path = argv[optind];
+            optind++;
+        }
+    }
+    if (cache_path.empty()) {
+        PrintHelp(argv[0]);
+        return -1;
+    }
+    if (options.jobs.empty()) {
+        options.jobs.push_back(std::max(std::thread::hardware_concurrency(), 1U));
+    }
+
+    std::optional<Vulkan::SpirvCacheTarget> target;
+    if (options.target_path) {
+        target = Vulkan::LoadSpirvCacheTarget(*options.target_path);
+        if (!target) {
+            std::cerr << "Failed to load the device description "
+                      << Common::FS::PathToUTF8String(*options.target_path) << "\n";
+            return -1;
+        }
+    } else if (options.backend == Backend::SpirV) {
+        target = DefaultVulkanTarget();
+    } else {
+        target = DefaultOpenGLTarget();
+    }
+    if (options.backend != Backend::SpirV) {
+        std::cout << fmt::format("Emitting {} for Vulkan pipelines, results are only comparable "
+                                 "with other runs of this benchmark\n",
+                                 BackendName(options.backend));
+    }
+    Vulkan::ApplySpirvCacheTargetSettings(*target);
+
+    const std::vector<VideoCommon::PipelineCacheRecord> records{
+        VideoCommon::ReadPipelines(cache_path, Vulkan::PIPELINE_CACHE_VERSION)};
+    if (records.empty()) {
+        std::cerr << "No pipelines found in " << Common::FS::PathToUTF8String(cache_path) << "\n";
+        return -1;
+    }
+    size_t num_invalid{};
+    std::vector<Pipeline> pipelines{DecodePipelines(records, num_invalid)};
+    const u64 loaded_memory{PeakMemoryUsage()};
+    std::cout << fmt::format("Loaded {} pipelines ({} invalid), peak memory {} MiB\n",
+                             pipelines.size(), num_invalid, loaded_memory >> 20);
+
+    std::vector<RunResult> results;
+    size_t num_failed{};
+    for (const size_t num_jobs : options.jobs) {
+        Settings::values.shader_compile_statistics.SetValue(false);
+        std::optional<RunResult> best;
+        for (size_t iteration = 0; iteration < options.iterations; ++iteration) {
+            const RunResult result{Run(pipelines, *target, options, num_jobs)};
+            if (!best || result.seconds < best->seconds) {
+                best = result;
+            }
+        }
+        num_failed = std::max(num_failed, best->num_failed);
+        results.push_back(*best);
+        std::cout << fmt::format("{} with {} jobs: {:.1f} pipelines/s, {:.3f}s, {} failed\n",
+                                 BackendName(options.backend), num_jobs,
+                                 best->PipelinesPerSecond(), best->seconds, best->num_failed);
+        if (options.collect_statistics) {
+            // Timing phases takes a lock per phase, so it is kept out of the measured runs
+            Shader::CompileStatistics::Clear();
+            Settings::values.shader_compile_statistics.SetValue(true);
+            (void)Run(pipelines, *target, options, num_jobs);
+            std::cout << Shader::CompileStatistics::Report() << "\n";
+        }
+    }
+    std::cout << fmt::format("Peak memory of the process {} MiB\n", PeakMemoryUsage() >> 20);
+
+    if (options.csv_path) {
+        std::ofstream file{*options.csv_path};
+        file << ResultsCsv(results);
+        if (!file) {
+            std::cerr << "Failed to write " << Common::FS::PathToUTF8String(*options.csv_path)
+                      << "\n";
+            return -1;
+        }
+    }
+    if (options.baseline_path &&
+        !CheckBaseline(*options.baseline_path, results, options.tolerance)) {
+        return 1;
+    }
+    return num_failed == 0 ? 0 : 1;
+}